@@ -0,0 +1,406 @@
+import Foundation
+
+/// Download priorities. Higher priorities are always started before lower ones.
+public enum FileDownloadPriority: Int, Comparable, CaseIterable {
+    /// Background offloading of original files.
+    case backgroundOffload = 0
+    /// Prefetching of thumbnails, for example for items just outside a visible grid.
+    case thumbnailPrefetch = 1
+    /// A preview the user has explicitly asked to see.
+    case userRequested = 2
+
+    public static func < (lhs: FileDownloadPriority, rhs: FileDownloadPriority) -> Bool {
+        return lhs.rawValue < rhs.rawValue
+    }
+}
+
+/// What a download request fetches.
+public enum FileDownloadKind {
+    /// The item's thumbnail, delivered as JPEG data.
+    case thumbnail
+    /// The item's preview, delivered as JPEG data.
+    case preview
+    /// The item's original file, streamed to the given local file URL.
+    case file(destination: URL)
+}
+
+/// States that a download request can be in.
+public enum FileDownloadState: Int {
+    /// The request is waiting for a transfer slot.
+    case pending
+    /// The request is being transferred.
+    case inProgress
+    /// The request completed successfully.
+    case complete
+    /// The request failed.
+    case failed
+    /// The request was cancelled before it completed.
+    case cancelled
+}
+
+/// The block callback signature for a completed or failed download request.
+///
+/// @param request The request that completed.
+/// @param error If the request failed or was cancelled, an error describing the failure.
+/// @param imageData For thumbnail and preview requests that succeeded, the image's JPEG data. Otherwise `nil`.
+public typealias FileDownloadCompletion = (_ request: FileDownloadRequest, _ error: Error?, _ imageData: Data?) -> Void
+
+/// A single download managed by a `FileDownloadManager`.
+public final class FileDownloadRequest {
+
+    internal init(item: FileSystemItem, kind: FileDownloadKind, priority: FileDownloadPriority,
+                  completion: FileDownloadCompletion?) {
+        self.item = item
+        self.kind = kind
+        self.priority = priority
+        self.completion = completion
+    }
+
+    /// The item being downloaded.
+    public let item: FileSystemItem
+
+    /// What is being downloaded.
+    public let kind: FileDownloadKind
+
+    /// The request's current priority. Change it with `FileDownloadManager.reprioritize(_:to:)`.
+    public internal(set) var priority: FileDownloadPriority
+
+    /// The request's current state.
+    public internal(set) var state: FileDownloadState = .pending
+
+    /// The number of bytes transferred for this request so far.
+    public internal(set) var bytesTransferred: UInt64 = 0
+
+    // Internal state, only touched on the manager's state queue.
+    internal let completion: FileDownloadCompletion?
+    internal var cancelRequested: Bool = false
+
+    internal var storageKey: ObjectIdentifier? {
+        return item.storage.map({ ObjectIdentifier($0) })
+    }
+}
+
+/// A snapshot of a download manager's overall activity.
+public struct FileDownloadStatistics {
+    /// The number of requests waiting for a transfer slot.
+    public let pendingCount: Int
+    /// The number of requests being transferred.
+    public let inProgressCount: Int
+    /// The number of requests that have completed successfully.
+    public let completedCount: Int
+    /// The number of requests that failed or were cancelled.
+    public let failedCount: Int
+    /// The total number of bytes transferred.
+    public let bytesTransferred: UInt64
+    /// The transfer rate over the last few seconds, in bytes per second.
+    public let bytesPerSecond: Double
+}
+
+/// Schedules thumbnail, preview and file downloads from camera storage.
+///
+/// Requests are started strictly in priority order — a user-requested preview jumps ahead of any number of queued
+/// thumbnail prefetches or offloads — and first-in, first-out within a priority. The number of transfers in flight
+/// on any one storage device is limited, so large offloads keep the camera's link saturated without flooding it with
+/// requests, and transfers on different storage devices (or cameras) proceed independently.
+public final class FileDownloadManager {
+
+    /// The default maximum number of transfers in flight per storage device.
+    public static let defaultMaximumTransfersPerStorage: Int = 2
+
+    /// Create a download manager.
+    ///
+    /// @param maximumTransfersPerStorage The maximum number of transfers in flight on any one storage device.
+    /// @param callbackQueue The queue on which request completion handlers are called.
+    public init(maximumTransfersPerStorage: Int = defaultMaximumTransfersPerStorage, callbackQueue: DispatchQueue = .main) {
+        self.maximumTransfersPerStorage = max(1, maximumTransfersPerStorage)
+        self.callbackQueue = callbackQueue
+    }
+
+    /// The maximum number of transfers in flight on any one storage device.
+    public let maximumTransfersPerStorage: Int
+
+    /// Add a batch of downloads.
+    ///
+    /// @param items The items to download.
+    /// @param kind What to download for each item. For `.file`, the destination is treated as a directory and each
+    /// item is written inside it at its path on the storage (for example, `DCIM/100CANON/IMG_0001.JPG`). If that file is
+    /// already the destination of another of the manager's unfinished requests, a number is added to the file's name.
+    /// @param priority The priority of the requests.
+    /// @param completion A block to be called as each request completes, fails or is cancelled.
+    /// @return Returns the created requests, in the same order as the given items.
+    @discardableResult
+    public func enqueue(_ items: [FileSystemItem], kind: FileDownloadKind, priority: FileDownloadPriority,
+                        completion: FileDownloadCompletion? = nil) -> [FileDownloadRequest] {
+        return stateQueue.sync {
+            let requests: [FileDownloadRequest] = items.map({ item in
+                nextSequence += 1
+                let itemKind: FileDownloadKind
+                if case .file(let directory) = kind {
+                    itemKind = .file(destination: reserveDestination(for: item, in: directory))
+                } else {
+                    itemKind = kind
+                }
+                return FileDownloadRequest(item: item, kind: itemKind, priority: priority, completion: completion)
+            })
+            pending[priority, default: []].append(contentsOf: requests)
+            startTransfers()
+            return requests
+        }
+    }
+
+    /// Change the priority of a pending request. Requests that have already started aren't affected.
+    ///
+    /// When moved, the request is placed at the front of its new priority — this is usually called because the user
+    /// has just scrolled to the item.
+    public func reprioritize(_ request: FileDownloadRequest, to priority: FileDownloadPriority) {
+        stateQueue.async {
+            guard request.state == .pending, request.priority != priority,
+                  let index = self.pending[request.priority]?.firstIndex(where: { $0 === request }) else { return }
+            self.pending[request.priority]?.remove(at: index)
+            request.priority = priority
+            self.pending[priority, default: []].insert(request, at: 0)
+            self.startTransfers()
+        }
+    }
+
+    /// Cancel a request. Pending requests and in-progress thumbnail and preview requests finish immediately, and
+    /// in-progress file requests are stopped as soon as the camera allows. The request's completion handler will be
+    /// called with a `.cancelledByUser` error.
+    public func cancel(_ request: FileDownloadRequest) {
+        stateQueue.async {
+            request.cancelRequested = true
+            if request.state == .inProgress {
+                self.finishCancelledImageTransfer(request)
+                return
+            }
+            guard request.state == .pending,
+                  let index = self.pending[request.priority]?.firstIndex(where: { $0 === request }) else { return }
+            self.pending[request.priority]?.remove(at: index)
+            self.finish(request, state: .cancelled, error: NSError(cblErrorCode: .cancelledByUser), imageData: nil)
+        }
+    }
+
+    /// Cancel all pending and in-progress requests.
+    public func cancelAll() {
+        stateQueue.async {
+            let allPending = FileDownloadPriority.allCases.flatMap({ self.pending[$0] ?? [] })
+            self.pending.removeAll()
+            for request in self.inProgress where request.state == .inProgress {
+                request.cancelRequested = true
+                self.finishCancelledImageTransfer(request)
+            }
+            for request in allPending {
+                request.cancelRequested = true
+                self.finish(request, state: .cancelled, error: NSError(cblErrorCode: .cancelledByUser), imageData: nil)
+            }
+        }
+    }
+
+    /// Returns a snapshot of the manager's activity.
+    public var statistics: FileDownloadStatistics {
+        return stateQueue.sync {
+            let now = DispatchTime.now().uptimeNanoseconds
+            trimThroughputSamples(now: now)
+            let windowBytes = throughputSamples.reduce(UInt64(0), { $0 + $1.bytes })
+            let windowStart = throughputSamples.first?.time ?? now
+            let elapsed = max(Double(now - windowStart) / 1_000_000_000.0, 1.0)
+            return FileDownloadStatistics(pendingCount: pending.values.reduce(0, { $0 + $1.count }),
+                                          inProgressCount: inProgress.count,
+                                          completedCount: completedCount,
+                                          failedCount: failedCount,
+                                          bytesTransferred: totalBytesTransferred,
+                                          bytesPerSecond: Double(windowBytes) / elapsed)
+        }
+    }
+
+    // MARK: - Internal
+
+    private struct ThroughputSample {
+        let time: UInt64
+        let bytes: UInt64
+    }
+
+    private static let throughputWindow: UInt64 = 5_000_000_000
+
+    private let callbackQueue: DispatchQueue
+    private let stateQueue = DispatchQueue(label: "CascableCore File Download Manager")
+    private let transferQueue = DispatchQueue(label: "CascableCore File Download Manager Transfers", qos: .utility)
+
+    // State is only touched on the state queue.
+    private var pending: [FileDownloadPriority: [FileDownloadRequest]] = [:]
+    private var inProgress: [FileDownloadRequest] = []
+    private var inFlightPerStorage: [ObjectIdentifier: Int] = [:]
+    private var nextSequence: UInt64 = 0
+    private var reservedDestinations: Set<String> = []
+    private var completedCount: Int = 0
+    private var failedCount: Int = 0
+    private var totalBytesTransferred: UInt64 = 0
+    private var throughputSamples: [ThroughputSample] = []
+
+    // Must be called on the state queue.
+    private func startTransfers() {
+        for priority in FileDownloadPriority.allCases.reversed() {
+            guard var queue = pending[priority], !queue.isEmpty else { continue }
+            var index = 0
+            while index < queue.count {
+                let request = queue[index]
+                let storageKey = request.storageKey
+                if let storageKey, inFlightPerStorage[storageKey, default: 0] >= maximumTransfersPerStorage {
+                    // This storage is saturated — look further down the queue for work on another one.
+                    index += 1
+                    continue
+                }
+                queue.remove(at: index)
+                if let storageKey { inFlightPerStorage[storageKey, default: 0] += 1 }
+                inProgress.append(request)
+                request.state = .inProgress
+                start(request)
+            }
+            pending[priority] = queue
+        }
+    }
+
+    // Must be called on the state queue.
+    private func start(_ request: FileDownloadRequest) {
+        // Items may call preflight blocks synchronously, and those take the state queue — so kick off from elsewhere.
+        transferQueue.async { self.beginTransfer(of: request) }
+    }
+
+    // Must be called on the transfer queue.
+    private func beginTransfer(of request: FileDownloadRequest) {
+        switch request.kind {
+        case .thumbnail:
+            request.item.fetchThumbnail(preflightBlock: { _ in
+                return self.stateQueue.sync { !request.cancelRequested }
+            }, thumbnailDeliveryBlock: { _, error, data in
+                self.stateQueue.async { self.imageTransferDidFinish(request, error: error, data: data) }
+            }, deliveryQueue: transferQueue)
+
+        case .preview:
+            request.item.fetchPreview(preflightBlock: { _ in
+                return self.stateQueue.sync { !request.cancelRequested }
+            }, previewDeliveryBlock: { _, error, data in
+                self.stateQueue.async { self.imageTransferDidFinish(request, error: error, data: data) }
+            }, deliveryQueue: transferQueue)
+
+        case .file(let destination):
+            _ = request.item.streamItem(preflightBlock: { _ in
+                try? FileManager.default.createDirectory(at: destination.deletingLastPathComponent(), withIntermediateDirectories: true)
+                guard FileManager.default.createFile(atPath: destination.path, contents: nil, attributes: nil) else { return nil }
+                return try? FileHandle(forWritingTo: destination)
+            }, preflightQueue: transferQueue, chunkDeliveryBlock: { _, chunk, context in
+                guard let fileHandle = context as? FileHandle else { return .cancel }
+                fileHandle.write(chunk)
+                let byteCount = UInt64(chunk.count)
+                let cancelled: Bool = self.stateQueue.sync {
+                    self.recordTransfer(of: byteCount, for: request)
+                    return request.cancelRequested
+                }
+                return cancelled ? .cancel : .continue
+            }, deliveryQueue: transferQueue, complete: { _, error, context in
+                (context as? FileHandle)?.closeFile()
+                let finalError = error ?? (context == nil ? NSError(cblErrorCode: .writeProtected) : nil)
+                if finalError != nil { try? FileManager.default.removeItem(at: destination) }
+                self.stateQueue.async { self.transferDidFinish(request, error: finalError, imageData: nil) }
+            }, complete: transferQueue)
+        }
+    }
+
+    // Must be called on the state queue.
+    private func imageTransferDidFinish(_ request: FileDownloadRequest, error: Error?, data: Data?) {
+        if let data, request.state == .inProgress { recordTransfer(of: UInt64(data.count), for: request) }
+        transferDidFinish(request, error: error, imageData: data)
+    }
+
+    // Must be called on the state queue.
+    private func finishCancelledImageTransfer(_ request: FileDownloadRequest) {
+        // Thumbnail and preview fetches can't be stopped once the camera has started them, so the request finishes
+        // now and whatever the camera delivers later is dropped. The transfer keeps its slot until then, since the
+        // camera is still busy with it. File transfers stop at their next chunk, and finish then.
+        if case .file = request.kind { return }
+        finish(request, state: .cancelled, error: NSError(cblErrorCode: .cancelledByUser), imageData: nil)
+    }
+
+    // Must be called on the state queue.
+    private func transferDidFinish(_ request: FileDownloadRequest, error: Error?, imageData: Data?) {
+        inProgress.removeAll(where: { $0 === request })
+        if let storageKey = request.storageKey {
+            inFlightPerStorage[storageKey, default: 1] -= 1
+            if inFlightPerStorage[storageKey] == 0 { inFlightPerStorage.removeValue(forKey: storageKey) }
+        }
+
+        guard request.state == .inProgress else {
+            // Already finished by being cancelled.
+            startTransfers()
+            return
+        }
+
+        let state: FileDownloadState
+        if error == nil {
+            state = .complete
+        } else if request.cancelRequested {
+            state = .cancelled
+        } else {
+            state = .failed
+        }
+        finish(request, state: state, error: error, imageData: imageData)
+        startTransfers()
+    }
+
+    // Must be called on the state queue.
+    private func finish(_ request: FileDownloadRequest, state: FileDownloadState, error: Error?, imageData: Data?) {
+        request.state = state
+        if case .file(let destination) = request.kind { reservedDestinations.remove(destination.standardizedFileURL.path) }
+        if state == .complete { completedCount += 1 } else { failedCount += 1 }
+        guard let completion = request.completion else { return }
+        callbackQueue.async { completion(request, error, imageData) }
+    }
+
+    // Must be called on the state queue.
+    private func reserveDestination(for item: FileSystemItem, in directory: URL) -> URL {
+        // Mirror the item's path on its storage, so same-named files from different folders don't collide. The root
+        // folder's name isn't part of the path.
+        var components: [String] = [FileDownloadManager.safePathComponent(item.name) ?? "Item \(nextSequence)"]
+        var ancestor = item.parent
+        while let folder = ancestor, folder.parent != nil {
+            if let name = FileDownloadManager.safePathComponent(folder.name) { components.insert(name, at: 0) }
+            ancestor = folder.parent
+        }
+
+        let preferred = components.reduce(directory, { $0.appendingPathComponent($1) })
+        var destination = preferred
+        var attempt = 1
+        while reservedDestinations.contains(destination.standardizedFileURL.path) {
+            attempt += 1
+            let name = "\(preferred.deletingPathExtension().lastPathComponent) \(attempt)"
+            destination = preferred.deletingLastPathComponent().appendingPathComponent(name)
+            if !preferred.pathExtension.isEmpty { destination.appendPathExtension(preferred.pathExtension) }
+        }
+        reservedDestinations.insert(destination.standardizedFileURL.path)
+        return destination
+    }
+
+    private static func safePathComponent(_ name: String?) -> String? {
+        guard let name, !name.isEmpty, name != ".", name != ".." else { return nil }
+        return name.replacingOccurrences(of: "/", with: "_").replacingOccurrences(of: "\\", with: "_")
+    }
+
+    // Must be called on the state queue.
+    private func recordTransfer(of byteCount: UInt64, for request: FileDownloadRequest) {
+        let now = DispatchTime.now().uptimeNanoseconds
+        request.bytesTransferred += byteCount
+        totalBytesTransferred += byteCount
+        throughputSamples.append(ThroughputSample(time: now, bytes: byteCount))
+        trimThroughputSamples(now: now)
+    }
+
+    // Must be called on the state queue.
+    private func trimThroughputSamples(now: UInt64) {
+        let cutoff = now > FileDownloadManager.throughputWindow ? now - FileDownloadManager.throughputWindow : 0
+        if let firstRecent = throughputSamples.firstIndex(where: { $0.time >= cutoff }) {
+            throughputSamples.removeFirst(firstRecent)
+        } else {
+            throughputSamples.removeAll()
+        }
+    }
+}
@@ -51,6 +51,16 @@ public typealias EXIFDelivery = (_ item: FileSystemItem, _ error: Error?, _ imag
 ///         to be written to later.
 public typealias FileStreamPreflight = (_ item: FileSystemItem) -> Any?
 
+/// The callback block preflight signature for streaming a byte range of a file from the camera. This will be called just
+/// before the stream is about to begin.
+///
+/// @param item The filesystem item that will be streamed.
+/// @param totalSize The total size of the file, in bytes.
+/// @param range The byte range of the file that will be streamed. This is the requested range clamped to the file's size.
+/// @return Return any object to use as a "context" for the operation, including `nil`. This object will be passed to chunk
+///         delivery callbacks.
+public typealias FileStreamRangePreflight = (_ item: FileSystemItem, _ totalSize: UInt64, _ range: Range<UInt64>) -> Any?
+
 /// The callback block signature for data chunk delivery when streaming files from the camera. This will be called multiple
 /// times in sequence once an operation starts.
 ///
@@ -241,4 +251,92 @@ public protocol FileSystemItem {
                     deliveryQueue: DispatchQueue,
                     complete: @escaping FileStreamCompletion,
                     complete completeQueue: DispatchQueue) -> Progress
+
+    /// Stream a byte range of a file from the device.
+    ///
+    /// This works in the same way as the other streaming methods, except that streaming starts at the given offset
+    /// and stops after the given length. This allows an interrupted transfer to be resumed from where it left off
+    /// rather than restarted, or a large file to be fetched as several ranges in parallel. The preflight block is
+    /// given the file's total size and the range that will actually be streamed.
+    ///
+    /// @param offset The offset into the file, in bytes, at which to start streaming. If this is at or beyond the end
+    /// of the file, the stream will complete without delivering any data.
+    ///
+    /// @param length The maximum number of bytes to stream, or `nil` to stream to the end of the file.
+    ///
+    /// @param preflight Block to be called exactly once before the stream is started. The value returned
+    /// here will be passed as the `context` parameter of the `chunkDelivery` and `complete` blocks.
+    ///
+    /// @param preflightQueue The queue on which to execute the preflight block.
+    ///
+    /// @param chunkDelivery This block will be called zero or more times in succession to deliver the range's data.
+    ///
+    /// @param deliveryQueue The queue on which to execute the delivery block.
+    ///
+    /// @param complete Block to be called exactly once after the last data chunk has been delivered (if any).
+    ///
+    /// @param completeQueue The queue on which to execute the completion block.
+    ///
+    /// @returns Returns a progress object that can be use to track the progress of the transfer, measured in bytes
+    /// of the range.
+    func streamItem(fromOffset offset: UInt64,
+                    length: UInt64?,
+                    preflightBlock: @escaping FileStreamRangePreflight,
+                    preflightQueue: DispatchQueue,
+                    chunkDeliveryBlock chunkDelivery: @escaping FileStreamChunkDelivery,
+                    deliveryQueue: DispatchQueue,
+                    complete: @escaping FileStreamCompletion,
+                    complete completeQueue: DispatchQueue) -> Progress
+}
+
+public extension FileSystemItem {
+
+    /// Stream a byte range of a file from the device.
+    ///
+    /// This default implementation is for items that can only stream whole files. It streams the whole file and only
+    /// passes on the chunks (or parts of chunks) inside the range, stopping once the range has been delivered. The data
+    /// before the range still has to come from the device, and the returned progress tracks the whole file rather than
+    /// the range, so items that can start a stream at an offset should implement this themselves.
+    func streamItem(fromOffset offset: UInt64,
+                    length: UInt64?,
+                    preflightBlock preflight: @escaping FileStreamRangePreflight,
+                    preflightQueue: DispatchQueue,
+                    chunkDeliveryBlock chunkDelivery: @escaping FileStreamChunkDelivery,
+                    deliveryQueue: DispatchQueue,
+                    complete: @escaping FileStreamCompletion,
+                    complete completeQueue: DispatchQueue) -> Progress {
+        let totalSize = UInt64(size)
+        let start = min(offset, totalSize)
+        let end = start + min(totalSize - start, length ?? UInt64.max)
+
+        // Chunks are delivered one at a time, and the completion comes after the last of them, so these aren't
+        // touched concurrently.
+        var position: UInt64 = 0
+        var deliveredRange: Bool = false
+
+        return streamItem(preflightBlock: { item in
+            return preflight(item, totalSize, start..<end)
+        }, preflightQueue: preflightQueue, chunkDeliveryBlock: { item, chunk, context in
+            let chunkStart = position
+            position += UInt64(chunk.count)
+            guard chunkStart < end else {
+                deliveredRange = true
+                return .cancel
+            }
+            guard position > start else { return .continue }
+
+            let lower = Int(max(start, chunkStart) - chunkStart)
+            let upper = Int(min(end, position) - chunkStart)
+            let rangeChunk: Data = (lower == 0 && upper == chunk.count ? chunk :
+                chunk.subdata(in: (chunk.startIndex + lower)..<(chunk.startIndex + upper)))
+            let instruction = chunkDelivery(item, rangeChunk, context)
+            guard instruction == .continue, position >= end else { return instruction }
+            // The rest of the file isn't needed, so stop streaming it.
+            deliveredRange = true
+            return .cancel
+        }, deliveryQueue: deliveryQueue, complete: { item, error, context in
+            // Stopping once the range was delivered isn't a failure, even though the stream reports it as a cancellation.
+            complete(item, deliveredRange ? nil : error, context)
+        }, complete: completeQueue)
+    }
 }
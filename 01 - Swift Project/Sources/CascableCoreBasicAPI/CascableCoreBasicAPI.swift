@@ -13,7 +13,9 @@ import CascableCoreSimulatedCamera
  - Enum cases with more than one associated value disallow that enum to be exposed to C++.
 
  - Closures/callbacks aren't exposed to C++. This is particulary troublesome since we use this pattern a lot for
-   observation and live view streaming.
+   observation and live view streaming. C function pointers are, though, so push-style APIs here take a
+   `@convention(c)` callback alongside an opaque `context` pointer and a `releaseContext` function, which SwiftToCLR
+   turns into methods taking a `std::function`.
 
  - Types from other modules don't appear to be exposed to C++. For instance, when compiling the
    CascableCoreSimulatedCamera module, methods/properties exposing types from the CascableCore module (Camera, etc)
@@ -52,9 +54,15 @@ public struct BasicSimulatedCameraConfiguration {
             manufacturer: wrappedDefault.manufacturer,
             model: wrappedDefault.model,
             identifier: wrappedDefault.identifier,
+            cameraCount: wrappedDefault.cameraCount,
             liveViewImageContainerPath: (bundle.resourceURL ?? bundle.bundleURL)
                 .appendingPathComponent("CascableCore Simulated Camera_CascableCoreSimulatedCamera.resources")
-                .appendingPathComponent("Live View Images").path
+                .appendingPathComponent("Live View Images").path,
+            burstFramesPerSecond: wrappedDefault.burstFramesPerSecond,
+            burstLength: wrappedDefault.burstLength,
+            syntheticOriginalByteCount: wrappedDefault.syntheticOriginalByteCount,
+            deliversLiveViewOnSeparateLane: true,
+            workerQueueCount: ProcessInfo.processInfo.activeProcessorCount
         )
     }
 
@@ -68,9 +76,35 @@ public struct BasicSimulatedCameraConfiguration {
     /// The default value is the plugin's identifier (`se.cascable.CascableCore.plugin.simulated-camera`).
     public var identifier: String
 
+    /// The number of independent simulated cameras to discover. When greater than one, each camera gets a numbered
+    /// identifier, serial number and model name, and a different starting live view frame. The default value is `1`.
+    public var cameraCount: Int
+
     /// The container folder for JPEG live view images. This folder will be scanned and JPEG images within will be used.
     public var liveViewImageContainerPath: String
 
+    /// The rate, in shots per second, at which the simulated camera shoots in continuous drive modes. The default
+    /// value is 10.
+    public var burstFramesPerSecond: Double
+
+    /// The number of shots the simulated camera takes per shutter press in continuous drive modes. The default value
+    /// is 10.
+    public var burstLength: Int
+
+    /// The size, in bytes, of the synthetic full-size original delivered alongside each shot's preview. Set to zero to
+    /// only deliver previews. The default value is 24MB.
+    public var syntheticOriginalByteCount: Int
+
+    /// Whether live view frames are delivered on a separate, high-priority set of queues rather than alongside each
+    /// camera's other work. The default value is `true`.
+    public var deliversLiveViewOnSeparateLane: Bool
+
+    /// The maximum number of cameras' operations the basic API runs at once on its worker queues (and, separately, on
+    /// its live view queues). Each camera still has its own queue, so a slow operation on one camera takes up one of
+    /// these slots rather than holding up particular other cameras. The default value is the number of active
+    /// processor cores.
+    public var workerQueueCount: Int
+
     /// Apply the settings for newly-discovered simulated cameras. Changes won't be applied to simulated cameras
     /// that have already been discovered or connected to (i.e., you should apply your configuration before starting
     /// camera discovery).
@@ -91,9 +125,18 @@ public struct BasicSimulatedCameraConfiguration {
         if !imageUrls.isEmpty { config.liveViewImageFrames = imageUrls }
 
         config.internalCallbackQueue = Self.basicCameraQueue
+        config.internalCallbackQueueTargets = [BasicQueuePool.shared(label: "Basic Camera Worker", width: workerQueueCount, qos: .default).executor]
+        let liveViewQueuePool = (deliversLiveViewOnSeparateLane ?
+            BasicQueuePool.shared(label: "Basic Camera Live View", width: workerQueueCount, qos: .userInteractive) : nil)
+        // The pool is read as cameras are discovered, on the discovery queue (which is this one), so set it there too.
+        Self.basicCameraQueue.async { BasicCameraDiscovery.sharedInstance().liveViewQueuePool = liveViewQueuePool }
         config.manufacturer = manufacturer
         config.model = model
         config.identifier = identifier
+        config.cameraCount = cameraCount
+        config.burstFramesPerSecond = burstFramesPerSecond
+        config.burstLength = burstLength
+        config.syntheticOriginalByteCount = syntheticOriginalByteCount
         config.connectionAuthentication = .none
         config.apply()
     }
@@ -120,8 +163,35 @@ public class BasicCameraDiscovery {
 
     /// Returns an array of visible cameras.
     public var visibleCameras: [BasicCamera] {
-        if let currentSimulatedCamera { return [currentSimulatedCamera] }
-        return []
+        return onDiscoveryQueue({ simulatedCameras })
+    }
+
+    /// Returns the visible camera with the given handle, or `nil` if no visible camera has that handle.
+    ///
+    /// Handles are assigned when a camera is discovered and never reused, so clients can keep their own per-camera
+    /// state keyed by handle instead of re-fetching `visibleCameras`.
+    public func camera(withHandle handle: Int) -> BasicCamera? {
+        return onDiscoveryQueue({ simulatedCameras.first(where: { $0.handle == handle }) })
+    }
+
+    /// The number of discovery events waiting to be dequeued.
+    public var pendingEventCount: Int { return events.pendingCount }
+
+    /// The number of discovery events that were dropped because 1024 were already waiting to be dequeued.
+    public var droppedEventCount: Int { return events.droppedCount }
+
+    /// Removes and returns the oldest discovery event, or `nil` if there are none waiting. Events are queued from
+    /// the moment discovery starts. If they aren't dequeued, the oldest are dropped once 1024 are waiting.
+    public func dequeueEvent() -> BasicCameraDiscoveryEvent? {
+        return events.dequeue(waitingUpTo: 0.0)
+    }
+
+    /// Removes and returns the oldest discovery event, blocking the calling thread for up to `timeout` seconds for one
+    /// to arrive. Returns `nil` if no event arrived in time. Must not be called on the camera's callback queue.
+    ///
+    /// - Parameter timeout: The maximum number of seconds to wait.
+    public func waitForEvent(timeout: Double) -> BasicCameraDiscoveryEvent? {
+        return events.dequeue(waitingUpTo: timeout)
     }
 
     /// Start camera discovery.
@@ -140,25 +210,92 @@ public class BasicCameraDiscovery {
         guard discoveryRunning else { return }
         discoveryRunning = false
         SimulatedCameraDiscovery.shared.stopDiscovery()
-        currentSimulatedCamera = nil
+        discoveryQueue.async { self.simulatedCameras.removeAll() }
     }
 
     // Internal
 
     private init() {}
-    internal var currentSimulatedCamera: BasicCamera? = nil
+    // Only accessed on the discovery queue.
+    internal var simulatedCameras: [BasicCamera] = []
+    internal var liveViewQueuePool: BasicQueuePool? = nil
+    internal let events = BasicBoundedQueue<BasicCameraDiscoveryEvent>(capacity: 1024)
+    private var nextCameraHandle: Int = 1
+
+    /// The queue discovery callbacks arrive on.
+    internal var discoveryQueue: DispatchQueue {
+        return SimulatedCameraDiscovery.shared.configuration.internalCallbackQueue
+    }
+
+    private static let discoveryQueueKey = DispatchSpecificKey<ObjectIdentifier>()
+
+    // Performs the given block on the discovery queue, directly if we're already on it (for example, when called
+    // from a callback) and synchronously otherwise.
+    private func onDiscoveryQueue<T>(_ body: () -> T) -> T {
+        let queue = discoveryQueue
+        let identifier = ObjectIdentifier(queue)
+        queue.setSpecific(key: BasicCameraDiscovery.discoveryQueueKey, value: identifier)
+        if DispatchQueue.getSpecific(key: BasicCameraDiscovery.discoveryQueueKey) == identifier { return body() }
+        return queue.sync(execute: body)
+    }
 }
 
 extension BasicCameraDiscovery: CameraDiscoveryProviderDelegate {
     public func cameraDiscoveryProvider(_ provider: CameraDiscoveryProvider, didDiscover camera: Camera) {
-        currentSimulatedCamera = BasicCamera(wrapping: camera, callbackQueue: SimulatedCameraDiscovery.shared.configuration.internalCallbackQueue)
+        guard !simulatedCameras.contains(where: { $0.wrappedCamera === camera }) else { return }
+        let liveViewQueue = liveViewQueuePool?.makeSerialQueue(label: "Basic Camera Live View \(camera.friendlyIdentifier ?? "")")
+        let basicCamera = BasicCamera(wrapping: camera, handle: nextCameraHandle,
+                                      callbackQueue: SimulatedCameraDiscovery.shared.internalCallbackQueue(for: camera),
+                                      liveViewQueue: liveViewQueue)
+        nextCameraHandle += 1
+        simulatedCameras.append(basicCamera)
+        events.enqueue({ _ in BasicCameraDiscoveryEvent(type: .appeared, camera: basicCamera) })
+
+        if camera.service.metadataHasBeenResolved {
+            events.enqueue({ _ in BasicCameraDiscoveryEvent(type: .metadataResolved, camera: basicCamera) })
+        } else {
+            camera.service.resolveMetadata({ [weak self] _, error in
+                guard let self, error == nil, self.simulatedCameras.contains(where: { $0 === basicCamera }) else { return }
+                self.events.enqueue({ _ in BasicCameraDiscoveryEvent(type: .metadataResolved, camera: basicCamera) })
+            }, queue: discoveryQueue)
+        }
     }
 
     public func cameraDiscoveryProvider(_ provider: CameraDiscoveryProvider, didLoseSightOf camera: Camera) {
-        currentSimulatedCamera = nil
+        guard let index = simulatedCameras.firstIndex(where: { $0.wrappedCamera === camera }) else { return }
+        let basicCamera = simulatedCameras.remove(at: index)
+        events.enqueue({ _ in BasicCameraDiscoveryEvent(type: .lost, camera: basicCamera) })
     }
 }
 
+/// Types of camera discovery event.
+public enum BasicCameraDiscoveryEventType: UInt {
+    /// A camera became visible.
+    case appeared = 0
+    /// A previously-visible camera is no longer available.
+    case lost = 1
+    /// A visible camera's metadata (model name, serial number, etc) has been resolved.
+    case metadataResolved = 2
+}
+
+/// A camera discovery event, as dequeued from `BasicCameraDiscovery`.
+public class BasicCameraDiscoveryEvent {
+
+    internal init(type: BasicCameraDiscoveryEventType, camera: BasicCamera) {
+        self.type = type
+        self.camera = camera
+    }
+
+    /// The type of event.
+    public let type: BasicCameraDiscoveryEventType
+
+    /// The camera the event is about. This is the same instance for every event about a given camera.
+    public let camera: BasicCamera
+
+    /// The handle of the camera the event is about.
+    public var cameraHandle: Int { return camera.handle }
+}
+
 // MARK: - Camera
 
 public class BasicCamera: Equatable {
@@ -169,13 +306,19 @@ public class BasicCamera: Equatable {
 
     internal let wrappedCamera: Camera
     internal let queue: DispatchQueue
-    internal init(wrapping camera: Camera, callbackQueue: DispatchQueue) {
+    internal let liveViewQueue: DispatchQueue
+    internal init(wrapping camera: Camera, handle: Int, callbackQueue: DispatchQueue, liveViewQueue: DispatchQueue? = nil) {
         wrappedCamera = camera
+        self.handle = handle
         queue = callbackQueue
+        self.liveViewQueue = liveViewQueue ?? callbackQueue
     }
 
     // Basics
 
+    /// The camera's discovery handle. Unique among all cameras discovered during the process's lifetime.
+    public let handle: Int
+
     /// Returns the camera's "friendly" identifier, typically the serial number.
     public var friendlyIdentifier: String? { return wrappedCamera.friendlyIdentifier }
 
@@ -193,6 +336,24 @@ public class BasicCamera: Equatable {
 
     /// Attempt to connect to the device.
     public func connect() {
+        connect(completion: nil)
+    }
+
+    /// Attempt to connect to the device, calling a function once the attempt finishes.
+    ///
+    /// `completion` is called exactly once on an internal queue, with `context` and whether the camera connected,
+    /// after which `releaseContext` is called with `context`.
+    ///
+    /// - Parameter context: An opaque pointer that's passed back to `completion` and `releaseContext`.
+    /// - Parameter completion: The function to call once the attempt finishes.
+    /// - Parameter releaseContext: The function to call once `completion` has been called.
+    public func connectWithCompletion(context: UnsafeMutableRawPointer?,
+                                      completion: @convention(c) (UnsafeMutableRawPointer?, Bool) -> Void,
+                                      releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void) {
+        connect(completion: BasicCompletionCallback(context: context, completion: completion, releaseContext: releaseContext))
+    }
+
+    private func connect(completion: BasicCompletionCallback?) {
         wrappedCamera.connect(authenticationRequestCallback: { context in
             print("WARNING: Camera wants auth, and the basic API doesn't support that yet. Cancelling.")
             context.submitCancellation()
@@ -201,20 +362,60 @@ public class BasicCamera: Equatable {
         }, completionCallback: { error, warnings in
             if let error { print("Connection failed: \(error)") }
             if let warnings, !warnings.isEmpty { print("Connection got warnings: \(warnings)") }
+            completion?.complete(succeeded: error == nil)
         })
     }
 
     /// Attempt to disconnect from the device.
     public func disconnect() {
+        disconnect(completion: nil)
+    }
+
+    /// Attempt to disconnect from the device, calling a function once the attempt finishes.
+    ///
+    /// `completion` is called exactly once on an internal queue, with `context` and whether the camera
+    /// disconnected cleanly, after which `releaseContext` is called with `context`.
+    ///
+    /// - Parameter context: An opaque pointer that's passed back to `completion` and `releaseContext`.
+    /// - Parameter completion: The function to call once the attempt finishes.
+    /// - Parameter releaseContext: The function to call once `completion` has been called.
+    public func disconnectWithCompletion(context: UnsafeMutableRawPointer?,
+                                         completion: @convention(c) (UnsafeMutableRawPointer?, Bool) -> Void,
+                                         releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void) {
+        disconnect(completion: BasicCompletionCallback(context: context, completion: completion, releaseContext: releaseContext))
+    }
+
+    private func disconnect(completion: BasicCompletionCallback?) {
         wrappedCamera.disconnect({ error in
             if let error { print("Disconnection failed: \(error)") }
+            completion?.complete(succeeded: error == nil)
         }, callbackQueue: queue)
     }
 
     // TODO: Functionality and categories
-    // TODO: Filesystem
     // TODO: Video recording
 
+    // Filesystem
+
+    /// Returns the camera's storage devices. Will be empty if the camera isn't connected or has no storage.
+    public var storageDevices: [BasicFileStorage] {
+        return (wrappedCamera.storageDevices ?? []).map({ BasicFileStorage(wrapping: $0, queue: queue) })
+    }
+
+    /// Returns the file or folder at the given slash-separated path on the camera's first storage device, relative to
+    /// the storage's root (for example, `DCIM/100CAMERA/IMG_0001.JPG`). Returns `nil` if there's no storage, or if
+    /// the item's containing folders haven't been cataloged yet.
+    public func fileSystemItem(atPath path: String) -> BasicFileSystemItem? {
+        guard let storage = wrappedCamera.storageDevices?.first else { return nil }
+        var item: FileSystemItem = storage.rootDirectory
+        for component in path.split(separator: "/") where !component.isEmpty {
+            guard let folder = item as? FileSystemFolderItem,
+                  let child = folder.children?.first(where: { $0.name == String(component) }) else { return nil }
+            item = child
+        }
+        return BasicFileSystemItem(wrapping: item, queue: queue)
+    }
+
     //Shutter
 
     /// Returns `YES` if autofocus is currently engaged, otherwise `NO`.
@@ -282,11 +483,56 @@ public class BasicCamera: Equatable {
 
     private var cameraInitiatedTransferToken: ObserverToken? = nil
 
-    /// The most recently-received camera-initiated preview object. Set `handleCameraInitiatedPreviews` to  `true` to
-    /// start populating this.
-    public private(set) var lastReceivedPreview: BasicCameraInitiatedTransferResult? = nil
+    private let receivedTransfers = BasicBoundedQueue<BasicCameraInitiatedTransferResult>(capacity: 64)
+
+    /// The maximum number of received camera-initiated transfers held waiting to be dequeued. If a transfer arrives
+    /// when the queue is full, the oldest waiting transfer is dropped and counted in `droppedTransferCount`.
+    /// Defaults to 64.
+    public var receivedTransferCapacity: Int {
+        get { return receivedTransfers.capacity }
+        set { receivedTransfers.capacity = newValue }
+    }
+
+    /// The number of received camera-initiated transfers waiting to be dequeued.
+    public var pendingTransferCount: Int { return receivedTransfers.pendingCount }
+
+    /// The total number of camera-initiated transfers received. This is also the sequence number of the most recent
+    /// transfer, since sequence numbers start at one.
+    public var receivedTransferCount: Int { return receivedTransfers.receivedCount }
+
+    /// The number of camera-initiated transfers that were dropped: because the queue was full, because the camera
+    /// offered nothing we could transfer, or because `handleCameraInitiatedPreviews` was turned off while they were
+    /// waiting or in flight.
+    public var droppedTransferCount: Int { return receivedTransfers.droppedCount }
+
+    /// The number of camera-initiated transfers that failed before they could be queued. Failed transfers don't
+    /// consume a sequence number.
+    public var failedTransferCount: Int { return receivedTransfers.failedCount }
+
+    /// Removes and returns the oldest received camera-initiated transfer, or `nil` if none are waiting. Set
+    /// `handleCameraInitiatedPreviews` to `true` to start receiving transfers.
+    public func dequeueTransfer() -> BasicCameraInitiatedTransferResult? {
+        return receivedTransfers.dequeue(waitingUpTo: 0.0)
+    }
+
+    /// Removes and returns the oldest received camera-initiated transfer, blocking the calling thread until one
+    /// arrives or the timeout elapses.
+    ///
+    /// @param timeout The maximum time to wait, in seconds.
+    /// @return Returns the transfer, or `nil` if none arrived before the timeout.
+    public func waitForTransfer(timeout: Double) -> BasicCameraInitiatedTransferResult? {
+        return receivedTransfers.dequeue(waitingUpTo: timeout)
+    }
+
+    /// A directory to write camera-initiated transfers to, or `nil` to load them into memory.
+    ///
+    /// When set, each transfer is written straight to a file in this directory and only its path is kept (see
+    /// `BasicCameraInitiatedTransferResult.localPath`), so images are never held in memory by the basic API. The
+    /// original representation is transferred when the camera offers it, otherwise the preview.
+    public var cameraInitiatedTransferDirectory: String? = nil
 
     /// Set to `true` to handle camera-initiated previews (i.e., automatic previewing of photos after they're taken).
+    /// Setting to `false` discards any transfers waiting to be dequeued, along with those still in flight.
     public var handleCameraInitiatedPreviews: Bool {
         get { return cameraInitiatedTransferToken != nil }
         set {
@@ -298,31 +544,99 @@ public class BasicCamera: Equatable {
             } else if let token = cameraInitiatedTransferToken {
                 wrappedCamera.removeCameraInitiatedTransferHandler(with: token)
                 cameraInitiatedTransferToken = nil
-                lastReceivedPreview = nil
+                receivedTransfers.removeAll()
             }
         }
     }
 
     private func handleTransferRequest(_ request: CameraInitiatedTransferRequest) {
-        guard request.isValid, (request.isOnlyDestinationForImage || request.executionRequiredToClearBuffer || request.canProvide(.preview)) else { return }
-        let representation: CameraInitiatedTransferRepresentation = (request.canProvide(.preview) ? .preview : .original)
-        request.executeTransfer(for: representation, completionQueue: queue, completionHandler: { result, error in
-           guard error == nil, let result else {
+        guard request.isValid, (request.isOnlyDestinationForImage || request.executionRequiredToClearBuffer || request.canProvide(.preview)) else {
+            receivedTransfers.noteDropped()
+            return
+        }
+        // Results that finish after the queue has been cleared belong to a previous session, and are dropped.
+        let generation = receivedTransfers.generation
+        let destinationDirectory = cameraInitiatedTransferDirectory
+        let representation: CameraInitiatedTransferRepresentation = {
+            if destinationDirectory != nil && request.canProvide(.original) { return .original }
+            return (request.canProvide(.preview) ? .preview : .original)
+        }()
+
+        request.executeTransfer(for: representation, completionQueue: queue, completionHandler: { [weak self] result, error in
+            guard error == nil, let result else {
                 print("Executing camera-initiated request failed: \(error?.localizedDescription ?? "unknown error")")
+                self?.receivedTransfers.noteFailure()
                 return
             }
+
+            if let destinationDirectory {
+                // Hand the result straight to disk, so the image is never loaded into memory on our side.
+                guard let self else { return }
+                let destinationUrl = self.reserveTransferDestination(for: result, representation: representation, in: destinationDirectory)
+                result.write(representation, to: destinationUrl, completionHandler: { [weak self] error in
+                    guard let self else { return }
+                    self.queue.async { self.releaseTransferDestination(destinationUrl) }
+                    guard error == nil else {
+                        print("Writing camera-initiated request to disk failed: \(error?.localizedDescription ?? "unknown error")")
+                        self.receivedTransfers.noteFailure()
+                        return
+                    }
+                    self.receivedTransfers.enqueue(inGeneration: generation, { sequenceNumber in
+                        BasicCameraInitiatedTransferResult(wrapping: result, representation: representation, sequenceNumber: sequenceNumber,
+                                                           imageData: Data(), localPath: destinationUrl.path)
+                    })
+                })
+                return
+            }
+
             result.generateData(for: representation, completionHandler: { [weak self] data, error in
-            guard let self else { return }
+                guard let self else { return }
                 guard error == nil, let data else {
                     print("Getting data from camera-initiated request failed: \(error?.localizedDescription ?? "unknown error")")
+                    self.receivedTransfers.noteFailure()
                     return
                 }
-                let wrappedResult = BasicCameraInitiatedTransferResult(wrapping: result, representation: representation, imageData: data)
-                if self.handleCameraInitiatedPreviews { self.lastReceivedPreview = wrappedResult }
+                self.receivedTransfers.enqueue(inGeneration: generation, { sequenceNumber in
+                    BasicCameraInitiatedTransferResult(wrapping: result, representation: representation, sequenceNumber: sequenceNumber,
+                                                       imageData: data, localPath: nil)
+                })
             })
         })
     }
 
+    private var transferFileCounter: Int = 0
+
+    // Destinations handed out whose writes haven't finished yet. Writes are asynchronous, so a destination's file
+    // may not exist yet when the next transfer needs a name. Only accessed on our queue.
+    private var reservedTransferDestinations: Set<String> = []
+
+    // Must be called on our queue. Picks a file name that doesn't collide with anything already in the directory or
+    // with another transfer still being written, and reserves it until `releaseTransferDestination(_:)` is called.
+    internal func reserveTransferDestination(for result: CameraInitiatedTransferResult, representation: CameraInitiatedTransferRepresentation,
+                                             in directory: String) -> URL {
+        let directoryUrl = URL(fileURLWithPath: directory, isDirectory: true)
+        let fileExtension = result.suggestedFileNameExtension(for: representation) ?? "DAT"
+        let baseName: String = {
+            if let hint = result.fileNameHint, !hint.isEmpty { return URL(fileURLWithPath: hint).deletingPathExtension().lastPathComponent }
+            transferFileCounter += 1
+            return String(format: "IMG_%04d", transferFileCounter)
+        }()
+
+        var candidate = directoryUrl.appendingPathComponent(baseName).appendingPathExtension(fileExtension)
+        var suffix = 1
+        while reservedTransferDestinations.contains(candidate.path) || FileManager.default.fileExists(atPath: candidate.path) {
+            candidate = directoryUrl.appendingPathComponent("\(baseName)-\(suffix)").appendingPathExtension(fileExtension)
+            suffix += 1
+        }
+        reservedTransferDestinations.insert(candidate.path)
+        return candidate
+    }
+
+    // Must be called on our queue, once the write to a reserved destination has finished (whether or not it worked).
+    internal func releaseTransferDestination(_ destination: URL) {
+        reservedTransferDestinations.remove(destination.path)
+    }
+
     //Live View
 
     /// Start streaming the live view image from the camera.
@@ -330,11 +644,13 @@ public class BasicCamera: Equatable {
         let delivery: LiveViewFrameDelivery = { [weak self] frame, completion in
             let wrappedFrame = BasicLiveViewFrame(wrapping: frame)
             self?.lastLiveViewFrame = wrappedFrame
+            // The client's callback can be arbitrarily slow, so it takes one of the live view pool's slots.
+            BasicQueuePool.performGated({ self?.liveViewFrameCallback?.call(with: wrappedFrame) })
             completion()
         }
 
         wrappedCamera.beginStream(delivery: delivery,
-                                  deliveryQueue: queue,
+                                  deliveryQueue: liveViewQueue,
                                   options: [CBLLiveViewOptionSkipImageDecoding: true],
                                   terminationHandler: { [weak self] reason, error in
                                       if let error {
@@ -342,7 +658,8 @@ public class BasicCamera: Equatable {
                                       } else {
                                           print("Got live view termination:", reason)
                                       }
-                                      self?.lastLiveViewFrame = nil
+                                      // Frames are delivered on the live view queue, so clear the last one there too.
+                                      self?.liveViewQueue.async { self?.lastLiveViewFrame = nil }
                                   })
     }
 
@@ -359,6 +676,33 @@ public class BasicCamera: Equatable {
     /// The most recently produced live view frame.
     public private(set) var lastLiveViewFrame: BasicLiveViewFrame? = nil
 
+    /// Registers a function to be called each time a new live view frame arrives, replacing any previously-registered
+    /// one. The function is called on the camera's live view queue, immediately after `lastLiveViewFrame` is updated.
+    ///
+    /// `releaseContext` is called with `context` exactly once, when the registration is replaced or cleared or the
+    /// camera is deallocated. The callback won't be called with that context afterwards.
+    ///
+    /// - Parameter context: An opaque pointer that's passed back to `callback` and `releaseContext`.
+    /// - Parameter callback: The function to call for each frame. It's also given the frame, as a retained
+    ///                       `BasicLiveViewFrame` that the callback is responsible for releasing. Later frames don't
+    ///                       affect it, so it can be read after `lastLiveViewFrame` has moved on.
+    /// - Parameter releaseContext: The function to call once the registration is no longer needed.
+    public func setLiveViewFrameCallback(context: UnsafeMutableRawPointer?,
+                                         callback: @convention(c) (UnsafeMutableRawPointer?, UnsafeMutableRawPointer) -> Void,
+                                         releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void) {
+        let registration = BasicLiveViewFrameCallback(context: context, callback: callback, releaseContext: releaseContext)
+        // The registration is only touched on the live view queue, so the previous one can't be released mid-call.
+        liveViewQueue.async { self.liveViewFrameCallback = registration }
+    }
+
+    /// Removes the function registered with `setLiveViewFrameCallback(context:callback:releaseContext:)`, if any.
+    public func clearLiveViewFrameCallback() {
+        liveViewQueue.async { self.liveViewFrameCallback = nil }
+    }
+
+    // Must be accessed on the live view queue.
+    private var liveViewFrameCallback: BasicLiveViewFrameCallback? = nil
+
     // Camera Properties
 
     /// The known property identifiers.
@@ -385,32 +729,159 @@ public class BasicCamera: Equatable {
 
 }
 
+// MARK: - Callbacks
+
+/// A live view frame callback registered from C++, along with the context it was registered with. The context is
+/// released when the registration is deallocated.
+internal final class BasicLiveViewFrameCallback {
+
+    init(context: UnsafeMutableRawPointer?, callback: @convention(c) (UnsafeMutableRawPointer?, UnsafeMutableRawPointer) -> Void,
+         releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void) {
+        self.context = context
+        self.callback = callback
+        self.releaseContext = releaseContext
+    }
+
+    deinit {
+        releaseContext(context)
+    }
+
+    // Swift objects can't be passed through C function types, so the frame is passed as a handle holding a
+    // reference to it. The receiver takes ownership of that reference.
+    func call(with frame: BasicLiveViewFrame) {
+        callback(context, Unmanaged.passRetained(frame).toOpaque())
+    }
+
+    private let context: UnsafeMutableRawPointer?
+    private let callback: @convention(c) (UnsafeMutableRawPointer?, UnsafeMutableRawPointer) -> Void
+    private let releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void
+}
+
+/// A completion registered from C++, along with the context it was registered with.
+///
+/// Callers awaiting a completion can't find out that it'll never come, so it's called with `false` on deallocation if
+/// it hasn't been called by then. The context is released straight afterwards.
+///
+/// Completions can resume arbitrary code on the other side, such as a coroutine that goes on to make more calls into
+/// this API, so they're never called inline from our own queues or from `deinit`. Instead, they and the context's
+/// release are called on a serial delivery queue, so the release still comes after the completion.
+internal final class BasicCompletionCallback {
+
+    init(context: UnsafeMutableRawPointer?, completion: @convention(c) (UnsafeMutableRawPointer?, Bool) -> Void,
+         releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void) {
+        self.context = context
+        self.completion = completion
+        self.releaseContext = releaseContext
+    }
+
+    deinit {
+        // Only copies of our properties are captured, since we're going away.
+        let needsCompletion = markCompleted()
+        let context = context, completion = completion, releaseContext = releaseContext
+        Self.deliveryQueue.async {
+            if needsCompletion { completion(context, false) }
+            releaseContext(context)
+        }
+    }
+
+    /// Calls the completion on the delivery queue, unless it's already been called.
+    func complete(succeeded: Bool) {
+        guard markCompleted() else { return }
+        let context = context, completion = completion
+        Self.deliveryQueue.async { completion(context, succeeded) }
+    }
+
+    // Returns `true` the first time it's called.
+    private func markCompleted() -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        let alreadyCompleted = completed
+        completed = true
+        return !alreadyCompleted
+    }
+
+    private static let deliveryQueue: DispatchQueue = DispatchQueue(label: "Basic Completion Delivery", qos: .default,
+        autoreleaseFrequency: .inherit, target: .global(qos: .default))
+
+    private let lock = NSLock()
+    private var completed: Bool = false
+    private let context: UnsafeMutableRawPointer?
+    private let completion: @convention(c) (UnsafeMutableRawPointer?, Bool) -> Void
+    private let releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void
+}
+
+// MARK: - Buffers
+
+/// A read-only block of bytes, such as image data.
+///
+/// The buffer's bytes stay at the same address for as long as the buffer exists, so callers on the other side of the
+/// C++ interop can read them in place rather than copying them out first.
+///
+/// Buffers are built once by their owners and handed out as-is, so reading a buffer never copies its bytes.
+public class BasicByteBuffer {
+    internal let storage: NSData
+
+    /// Creates a buffer containing a copy of the given data.
+    internal init(copying data: Data) {
+        // Data doesn't guarantee a stable address for its bytes, and bridging it to NSData copies on some platforms,
+        // so the bytes are copied exactly once into storage that does.
+        storage = NSData(data: data)
+    }
+
+    /// Creates a zero-filled buffer of the given length, and lets the caller write its contents in place.
+    internal init(length: Int, contents: (UnsafeMutableRawBufferPointer) -> Void) {
+        let data = NSMutableData(length: length) ?? NSMutableData()
+        contents(UnsafeMutableRawBufferPointer(start: data.mutableBytes, count: data.length))
+        storage = data
+    }
+
+    /// Returns a pointer to the buffer's bytes, or `nil` if the buffer is empty. The pointer is valid for as long as
+    /// the buffer exists.
+    public var bytes: UnsafePointer<UInt8>? {
+        guard storage.length > 0 else { return nil }
+        return storage.bytes.assumingMemoryBound(to: UInt8.self)
+    }
+
+    /// The number of bytes in the buffer.
+    public var count: Int {
+        return storage.length
+    }
+
+    internal func copyBytes(into pointer: UnsafeMutablePointer<UInt8>) {
+        storage.getBytes(pointer, length: storage.length)
+    }
+}
+
 // MARK: - Camera-Initiated Transfers
 
 public class BasicCameraInitiatedTransferResult {
-    internal let wrappedValue: CameraInitiatedTransferResult
-    internal let representation: CameraInitiatedTransferRepresentation
-    internal let imageData: Data
-    internal init(wrapping value: CameraInitiatedTransferResult, representation: CameraInitiatedTransferRepresentation, imageData: Data) {
-        wrappedValue = value
+    internal init(wrapping value: CameraInitiatedTransferResult, representation: CameraInitiatedTransferRepresentation,
+                  sequenceNumber: Int, imageData: Data, localPath: String?) {
+        // Everything we need from the result is captured up-front, so we don't keep it (and any buffers or cache files
+        // it owns) alive for as long as the client holds on to us.
+        self.sequenceNumber = sequenceNumber
         dateProduced = Date().timeIntervalSince1970
-        self.representation = representation
-        self.imageData = imageData
+        isOnlyDestinationForImage = value.isOnlyDestinationForImage
+        fileNameHint = value.fileNameHint
+        suggestedFileNameExtensionForRepresentation = value.suggestedFileNameExtension(for: representation)
+        utiForRepresentation = value.uti(for: representation)
+        imageBuffer = BasicByteBuffer(copying: imageData)
+        self.localPath = localPath
     }
 
+    /// The transfer's sequence number. Transfers are numbered from one in the order they're received, so a gap in
+    /// the sequence numbers of dequeued transfers means transfers were dropped.
+    public let sequenceNumber: Int
+
     /// Returns the date and time at which this preview was generated.
     public let dateProduced: Double
 
     /// Returns `YES` if not saving the contents of this result may cause data loss. For example, a camera
     /// set to only save images to the connected host would set this to `YES`.
-    public var isOnlyDestinationForImage: Bool {
-        return wrappedValue.isOnlyDestinationForImage
-    }
+    public let isOnlyDestinationForImage: Bool
 
     /// A file name hint for the original representation of the image, if available.
-    public var fileNameHint: String? {
-        return wrappedValue.fileNameHint
-    }
+    public let fileNameHint: String?
 
     /// Returns a suggested file name extension for the given representation or `nil` if the representation isn't available.
     ///
@@ -418,30 +889,523 @@ public class BasicCameraInitiatedTransferResult {
     ///
     /// @note This method is guaranteed to return a valid value as long as the representation is available. This can be
     ///       useful if the `fileNameHint` property is `nil` and you need to write a representation to disk.
-    public var suggestedFileNameExtensionForRepresentation: String? {
-        return wrappedValue.suggestedFileNameExtension(for: representation)
-    }
+    public let suggestedFileNameExtensionForRepresentation: String?
 
     /// Returns the type UTI for the given representation, or `nil` if the representation isn't available.
     ///
     /// @note This method may fall back to returning `kUTTypeData` if the representation is in a RAW image format
     /// not recognised by the operating system.
-    public var utiForRepresentation: String? {
-        return wrappedValue.uti(for: representation)
-    }
+    public let utiForRepresentation: String?
+
+    /// The path of the file the transfer was written to, if the camera's `cameraInitiatedTransferDirectory` was set
+    /// when it arrived. In that case the image data isn't held in memory, and `rawImageDataLength` is zero.
+    public let localPath: String?
 
     public var rawImageDataLength: Int {
-        return imageData.count
+        return imageBuffer.count
     }
 
+    /// Returns the transfer's image data, which is empty if the transfer was written to `localPath`.
+    public let imageBuffer: BasicByteBuffer
+
     public func copyPixelData(into pointer: UnsafeMutablePointer<UInt8>) {
-        imageData.copyBytes(to: pointer, count: rawImageDataLength)
+        imageBuffer.copyBytes(into: pointer)
+    }
+}
+
+/// A concurrent queue that any number of per-camera serial queues run on, with at most `width` pieces of the basic
+/// API's work running on them at once. Each camera's work stays in order on its own queue, and cameras aren't tied to
+/// particular workers: a slow operation on one camera takes up one of the pool's slots rather than holding up the
+/// cameras that happen to share a worker with it.
+///
+/// Dispatch can't limit how many serial queues a concurrent queue runs at once, so the width is enforced by a
+/// semaphore that work takes a slot from with `performGated(_:)`. Work CascableCore schedules on a camera's queue
+/// itself is short, with file I/O and image generation on queues of its own, and is left to the system's thread pool.
+internal final class BasicQueuePool {
+
+    /// Returns the shared pool with the given label, creating it if needed. If the existing pool has a different
+    /// width, it's replaced with a new one. Queues already made by the old pool keep using it.
+    static func shared(label: String, width: Int, qos: DispatchQoS) -> BasicQueuePool {
+        registryLock.lock()
+        defer { registryLock.unlock() }
+        if let existing = pools[label], existing.width == max(1, width) { return existing }
+        let pool = BasicQueuePool(label: label, width: width, qos: qos)
+        pools[label] = pool
+        return pool
+    }
+
+    init(label: String, width: Int, qos: DispatchQoS) {
+        self.width = max(1, width)
+        gate = DispatchSemaphore(value: self.width)
+        executor = DispatchQueue(label: label, qos: qos, attributes: .concurrent, autoreleaseFrequency: .inherit,
+                                 target: .global(qos: qos.qosClass))
+        // Queue-specific values are inherited through target queues, so any queue targeting the executor finds the gate.
+        executor.setSpecific(key: BasicQueuePool.gateKey, value: gate)
+    }
+
+    /// The maximum number of pieces of gated work that run on the pool's queues at once.
+    let width: Int
+
+    /// The concurrent queue the pool's serial queues target.
+    let executor: DispatchQueue
+
+    /// Creates a new serial queue targeting the pool's executor.
+    func makeSerialQueue(label: String) -> DispatchQueue {
+        return DispatchQueue(label: label, target: executor)
+    }
+
+    /// Performs the given work. When called on a queue targeting a pool's executor, first waits (blocking the calling
+    /// queue) until fewer than the pool's `width` pieces of gated work are running. On any other queue, the work is
+    /// performed immediately.
+    static func performGated<T>(_ work: () throws -> T) rethrows -> T {
+        guard let gate = DispatchQueue.getSpecific(key: gateKey) else { return try work() }
+        gate.wait()
+        defer { gate.signal() }
+        return try work()
+    }
+
+    private let gate: DispatchSemaphore
+
+    private static let gateKey = DispatchSpecificKey<DispatchSemaphore>()
+    private static let registryLock = NSLock()
+    private static var pools: [String: BasicQueuePool] = [:]
+}
+
+/// A bounded FIFO of received transfers or discovery events, shared between a camera or discovery queue (which
+/// enqueues) and client threads (which dequeue, possibly blocking). When the queue is full, the oldest elements are
+/// dropped to make room and counted in `droppedCount`.
+internal final class BasicBoundedQueue<Element> {
+
+    init(capacity: Int) {
+        _capacity = max(1, capacity)
+    }
+
+    var capacity: Int {
+        get { return withLock({ _capacity }) }
+        set {
+            withLock({
+                _capacity = max(1, newValue)
+                trimToCapacity()
+            })
+        }
+    }
+
+    var pendingCount: Int { return withLock({ pending.count }) }
+    var receivedCount: Int { return withLock({ _receivedCount }) }
+    var droppedCount: Int { return withLock({ _droppedCount }) }
+    var failedCount: Int { return withLock({ _failedCount }) }
+
+    /// Incremented each time the queue is cleared with `removeAll()`.
+    var generation: Int { return withLock({ _generation }) }
+
+    /// Assigns the next sequence number, builds the element with it and adds it to the queue.
+    ///
+    /// @param generation If given, the element is dropped rather than queued if the queue has been cleared since
+    /// `generation` was read.
+    func enqueue(inGeneration generation: Int? = nil, _ makeElement: (_ sequenceNumber: Int) -> Element) {
+        withLock({
+            if let generation, generation != _generation {
+                _droppedCount += 1
+                return
+            }
+            _receivedCount += 1
+            pending.append(makeElement(_receivedCount))
+            trimToCapacity()
+            condition.signal()
+        })
+    }
+
+    func noteFailure() {
+        withLock({ _failedCount += 1 })
+    }
+
+    /// Counts an element that was dropped before it could be queued.
+    func noteDropped() {
+        withLock({ _droppedCount += 1 })
+    }
+
+    /// Drops all waiting elements (counting them as dropped) and starts a new generation. Sequence numbers carry on
+    /// from where they were.
+    func removeAll() {
+        withLock({
+            _droppedCount += pending.count
+            pending.removeAll()
+            _generation += 1
+        })
+    }
+
+    /// Removes and returns the oldest element, waiting up to the given number of seconds for one to arrive.
+    func dequeue(waitingUpTo timeout: Double) -> Element? {
+        let deadline = Date(timeIntervalSinceNow: max(0.0, timeout))
+        return withLock({
+            while pending.isEmpty {
+                guard condition.wait(until: deadline) else { break }
+            }
+            return pending.isEmpty ? nil : pending.removeFirst()
+        })
+    }
+
+    // MARK: - Internal
+
+    private let condition = NSCondition()
+    private var pending: [Element] = []
+    private var _capacity: Int
+    private var _receivedCount: Int = 0
+    private var _droppedCount: Int = 0
+    private var _failedCount: Int = 0
+    private var _generation: Int = 0
+
+    private func withLock<T>(_ body: () -> T) -> T {
+        condition.lock()
+        defer { condition.unlock() }
+        return body()
+    }
+
+    // Must be called with the lock held.
+    private func trimToCapacity() {
+        let overflow = pending.count - _capacity
+        guard overflow > 0 else { return }
+        pending.removeFirst(overflow)
+        _droppedCount += overflow
+    }
+}
+
+// MARK: - Filesystem
+
+/// A storage container in a camera, such as an SD card.
+public class BasicFileStorage {
+    internal let wrappedStorage: FileStorage
+    internal let queue: DispatchQueue
+    internal init(wrapping storage: FileStorage, queue: DispatchQueue) {
+        wrappedStorage = storage
+        self.queue = queue
+    }
+
+    /// Returns a name string appropriate for display to the user.
+    public var displayName: String? { return wrappedStorage.displayName }
+
+    /// Returns the free space of the storage container, in bytes.
+    public var availableSpace: Int64 { return Int64(clamping: wrappedStorage.availableSpace) }
+
+    /// Returns the capacity of the storage container, in bytes.
+    public var capacity: Int64 { return Int64(clamping: wrappedStorage.capacity) }
+
+    /// Returns `true` if the storage container allows write access.
+    public var allowsWrite: Bool { return wrappedStorage.allowsWrite }
+
+    /// Returns the root folder of the storage.
+    public var rootFolder: BasicFolder { return BasicFolder(wrapping: wrappedStorage.rootDirectory, queue: queue) }
+}
+
+/// A folder on a camera's storage.
+public class BasicFolder {
+    internal let wrappedFolder: FileSystemFolderItem
+    internal let queue: DispatchQueue
+    internal init(wrapping folder: FileSystemFolderItem, queue: DispatchQueue) {
+        wrappedFolder = folder
+        self.queue = queue
+    }
+
+    /// Returns the name of the folder.
+    public var name: String? { return wrappedFolder.name }
+
+    /// Returns `true` if the folder's children have been loaded.
+    public var childrenLoaded: Bool { return wrappedFolder.childrenLoaded }
+
+    /// Returns `true` if the folder's children are currently being loaded.
+    public var childrenLoading: Bool { return wrappedFolder.childrenLoading }
+
+    /// A description of the error that occurred during the last call to `loadChildren()`, or `nil` if it succeeded
+    /// or hasn't completed.
+    public var loadChildrenErrorDescription: String? { return withLock({ _loadChildrenErrorDescription }) }
+
+    /// Begin loading the folder's children. Poll `childrenLoaded` to find out when they're available.
+    public func loadChildren() {
+        withLock({ _loadChildrenErrorDescription = nil })
+        wrappedFolder.loadChildren({ [weak self] error in
+            guard let self else { return }
+            self.withLock({ self._loadChildrenErrorDescription = error?.localizedDescription })
+        })
+    }
+
+    /// Returns a listing of the folder's currently-loaded children. The listing will be empty if the folder's children
+    /// haven't been loaded.
+    public func listing() -> BasicFolderListing {
+        return BasicFolderListing(items: wrappedFolder.children ?? [], queue: queue)
+    }
+
+    // Set on the camera's queue and polled from any thread, so only touched with the lock held.
+    private var _loadChildrenErrorDescription: String? = nil
+
+    private let lock = NSLock()
+
+    private func withLock<T>(_ body: () -> T) -> T {
+        lock.lock()
+        defer { lock.unlock() }
+        return body()
+    }
+}
+
+/// Flags describing an entry in a `BasicFolderListing`.
+public enum BasicFolderListingFlags: UInt {
+    /// The entry is a folder.
+    case folder = 1
+    /// The entry is a file of a known image type.
+    case image = 2
+    /// The entry is a file of a known video type.
+    case video = 4
+}
+
+/// A snapshot of a folder's children, flattened into a single buffer of fixed-size records for bulk access.
+///
+/// Rather than wrapping each child in its own object, the listing is copied out in one call with `copyRecords(into:)`
+/// into a caller-allocated buffer of `recordBufferLength` bytes. The buffer contains `count` records, each
+/// `recordStride` bytes long, followed by the entries' UTF-8 names. All values are little-endian:
+///
+/// | Offset | Type    | Value                                                                               |
+/// |--------|---------|-------------------------------------------------------------------------------------|
+/// | 0      | UInt64  | The entry's size, in bytes (zero for folders).                                      |
+/// | 8      | Double  | The entry's creation date, in seconds since 1970, or NaN if unknown.                |
+/// | 16     | UInt32  | The offset of the entry's name from the start of the buffer.                        |
+/// | 20     | UInt32  | The length of the entry's name in bytes, excluding its null terminator.             |
+/// | 24     | UInt32  | The entry's flags, a combination of `BasicFolderListingFlags` values.               |
+/// | 28     | UInt32  | The entry's handle, for use with `item(withHandle:)` and `folder(withHandle:)`.     |
+///
+/// Handles are only valid for the listing that produced them, and remain valid if the caller reorders records.
+public class BasicFolderListing {
+    internal let items: [FileSystemItem]
+    internal let queue: DispatchQueue
+    internal init(items: [FileSystemItem], queue: DispatchQueue) {
+        self.items = items
+        self.queue = queue
+        recordBuffer = BasicFolderListing.buildRecords(for: items)
+    }
+
+    internal static let recordStride: Int = 32
+
+    /// The length of each record in the buffer, in bytes.
+    public var recordStride: Int { return BasicFolderListing.recordStride }
+
+    /// The number of entries in the listing.
+    public var count: Int { return items.count }
+
+    /// The length of the buffer needed by `copyRecords(into:)`, in bytes.
+    public var recordBufferLength: Int { return recordBuffer.count }
+
+    /// Returns the listing's records and names, in the layout described above.
+    public let recordBuffer: BasicByteBuffer
+
+    /// Copies the listing's records and names into the given buffer, which must be at least `recordBufferLength`
+    /// bytes long.
+    public func copyRecords(into pointer: UnsafeMutablePointer<UInt8>) {
+        recordBuffer.copyBytes(into: pointer)
+    }
+
+    /// Returns the file for the given handle, or `nil` if the handle is invalid or refers to a folder.
+    public func item(withHandle handle: Int) -> BasicFileSystemItem? {
+        guard items.indices.contains(handle), !(items[handle] is FileSystemFolderItem) else { return nil }
+        return BasicFileSystemItem(wrapping: items[handle], queue: queue)
+    }
+
+    /// Returns the folder for the given handle, or `nil` if the handle is invalid or refers to a file.
+    public func folder(withHandle handle: Int) -> BasicFolder? {
+        guard items.indices.contains(handle), let folder = items[handle] as? FileSystemFolderItem else { return nil }
+        return BasicFolder(wrapping: folder, queue: queue)
+    }
+
+    // The records and names are written straight into one buffer, sized up front, so building a listing doesn't
+    // allocate anything per entry beyond the name strings the items themselves hand out.
+    private static func buildRecords(for items: [FileSystemItem]) -> BasicByteBuffer {
+        let names: [String] = items.map({ $0.name ?? "" })
+        let namesStart = items.count * recordStride
+        let length = namesStart + names.reduce(0, { $0 + $1.utf8.count + 1 })
+        return BasicByteBuffer(length: length, contents: { bytes in
+            var nameOffset = namesStart
+            for (index, item) in items.enumerated() {
+                let recordOffset = index * recordStride
+                var flags: UInt32 = 0
+                if item is FileSystemFolderItem { flags |= UInt32(BasicFolderListingFlags.folder.rawValue) }
+                if item.isKnownImageType { flags |= UInt32(BasicFolderListingFlags.image.rawValue) }
+                if item.isKnownVideoType { flags |= UInt32(BasicFolderListingFlags.video.rawValue) }
+                let date = item.dateCreated?.timeIntervalSince1970 ?? Double.nan
+                let nameLength = names[index].utf8.count
+
+                bytes.storeBytes(of: UInt64(item.size).littleEndian, toByteOffset: recordOffset, as: UInt64.self)
+                bytes.storeBytes(of: date.bitPattern.littleEndian, toByteOffset: recordOffset + 8, as: UInt64.self)
+                bytes.storeBytes(of: UInt32(nameOffset).littleEndian, toByteOffset: recordOffset + 16, as: UInt32.self)
+                bytes.storeBytes(of: UInt32(nameLength).littleEndian, toByteOffset: recordOffset + 20, as: UInt32.self)
+                bytes.storeBytes(of: flags.littleEndian, toByteOffset: recordOffset + 24, as: UInt32.self)
+                bytes.storeBytes(of: UInt32(index).littleEndian, toByteOffset: recordOffset + 28, as: UInt32.self)
+
+                // The buffer is zero-filled, so each name is followed by a null terminator.
+                UnsafeMutableRawBufferPointer(rebasing: bytes[nameOffset..<(nameOffset + nameLength)]).copyBytes(from: names[index].utf8)
+                nameOffset += nameLength + 1
+            }
+        })
+    }
+}
+
+/// A file or folder on a camera's storage.
+public class BasicFileSystemItem {
+    internal let wrappedItem: FileSystemItem
+    internal let queue: DispatchQueue
+    internal init(wrapping item: FileSystemItem, queue: DispatchQueue) {
+        wrappedItem = item
+        self.queue = queue
+    }
+
+    /// Returns the name of the item.
+    public var name: String? { return wrappedItem.name }
+
+    /// Returns the size of the file, in bytes, or zero for folders.
+    public var size: Int64 { return Int64(clamping: wrappedItem.size) }
+
+    /// Returns `true` if the item is a folder.
+    public var isFolder: Bool { return wrappedItem is FileSystemFolderItem }
+
+    /// Begin transferring a byte range of the file to a local file.
+    ///
+    /// The range's data is written at the same offset in the local file as it has in the camera's file, and the local
+    /// file is created if it doesn't exist. To resume an interrupted transfer, pass the number of bytes already written
+    /// to the local file as the offset. Multiple transfers of different ranges can write to the same local file in
+    /// parallel. Folders can't be transferred.
+    ///
+    /// @param localPath The path of the local file to write to.
+    /// @param offset The offset into the file, in bytes, at which to start transferring.
+    /// @param length The number of bytes to transfer. Pass zero or a negative value to transfer to the end of the file.
+    /// @return Returns an object for polling the transfer's state.
+    public func beginTransfer(toPath localPath: String, fromOffset offset: Int64, length: Int64) -> BasicFileTransfer {
+        let transfer = BasicFileTransfer(localPath: localPath)
+        let queue = self.queue
+        // Chunks are written on the transfer's own queue so slow disks don't hold up the camera's queue.
+        let transferQueue = BasicQueuePool.shared(label: "Basic File Transfer", width: ProcessInfo.processInfo.activeProcessorCount, qos: .utility)
+            .makeSerialQueue(label: "Basic File Transfer \(localPath)")
+
+        guard !isFolder else {
+            transfer.update({
+                $0._errorDescription = "Folders can't be transferred."
+                $0._state = .failed
+            })
+            return transfer
+        }
+
+        _ = wrappedItem.streamItem(fromOffset: UInt64(max(0, offset)), length: length > 0 ? UInt64(length) : nil,
+                                   preflightBlock: { _, totalSize, range in
+            transfer.update({
+                $0._totalFileSize = Int64(totalSize)
+                $0._rangeStart = Int64(range.lowerBound)
+                $0._rangeLength = Int64(range.count)
+            })
+            let url = URL(fileURLWithPath: localPath)
+            if !FileManager.default.fileExists(atPath: localPath) {
+                FileManager.default.createFile(atPath: localPath, contents: nil)
+            }
+            guard let handle = try? FileHandle(forWritingTo: url) else { return nil }
+            handle.seek(toFileOffset: range.lowerBound)
+            return handle
+        }, preflightQueue: queue, chunkDeliveryBlock: { _, chunk, context in
+            guard let handle = context as? FileHandle, !transfer.cancelRequested else { return .cancel }
+            transferQueue.async {
+                BasicQueuePool.performGated({ handle.write(chunk) })
+                transfer.update({ $0._bytesTransferred += Int64(chunk.count) })
+            }
+            return .continue
+        }, deliveryQueue: queue, complete: { _, error, context in
+            // Queued behind any outstanding writes, so the transfer only completes once they're all on disk.
+            transferQueue.async {
+                (context as? FileHandle)?.closeFile()
+                transfer.update({
+                    if let error {
+                        $0._errorDescription = error.localizedDescription
+                        $0._state = ($0._cancelRequested ? .cancelled : .failed)
+                    } else if context == nil {
+                        $0._errorDescription = "Couldn't open \(localPath) for writing."
+                        $0._state = .failed
+                    } else {
+                        $0._state = .completed
+                    }
+                })
+            }
+        }, complete: queue)
+
+        return transfer
+    }
+}
+
+/// The state of a file transfer.
+public enum BasicFileTransferState: UInt {
+    /// The transfer is in progress.
+    case inProgress
+    /// The transfer completed successfully.
+    case completed
+    /// The transfer failed. See the transfer's `errorDescription`.
+    case failed
+    /// The transfer was cancelled.
+    case cancelled
+}
+
+/// A transfer of (a byte range of) a file from the camera to a local file. Poll its properties to track progress.
+///
+/// The transfer is written and updated on a queue of its own, and its properties can be polled from any thread.
+public class BasicFileTransfer {
+    internal init(localPath: String) {
+        self.localPath = localPath
+    }
+
+    /// The local file being written to.
+    public let localPath: String
+
+    /// The transfer's state.
+    public var state: BasicFileTransferState { return withLock({ _state }) }
+
+    /// The total size of the file on the camera, in bytes. Zero until the transfer has started.
+    public var totalFileSize: Int64 { return withLock({ _totalFileSize }) }
+
+    /// The offset of the range being transferred, in bytes.
+    public var rangeStart: Int64 { return withLock({ _rangeStart }) }
+
+    /// The length of the range being transferred, in bytes. This is the requested range clamped to the file's size.
+    public var rangeLength: Int64 { return withLock({ _rangeLength }) }
+
+    /// The number of bytes of the range transferred so far.
+    public var bytesTransferred: Int64 { return withLock({ _bytesTransferred }) }
+
+    /// A description of the error that occurred if `state` is `.failed`, otherwise `nil`.
+    public var errorDescription: String? { return withLock({ _errorDescription }) }
+
+    /// Cancel the transfer. The local file is left in place, so the transfer can be resumed later.
+    public func cancel() {
+        withLock({ _cancelRequested = true })
+    }
+
+    internal var cancelRequested: Bool { return withLock({ _cancelRequested }) }
+
+    /// Makes changes to the transfer's state with the lock held, so pollers see them all at once.
+    internal func update(_ changes: (BasicFileTransfer) -> Void) {
+        withLock({ changes(self) })
+    }
+
+    // Only touched with the lock held.
+    fileprivate var _state: BasicFileTransferState = .inProgress
+    fileprivate var _totalFileSize: Int64 = 0
+    fileprivate var _rangeStart: Int64 = 0
+    fileprivate var _rangeLength: Int64 = 0
+    fileprivate var _bytesTransferred: Int64 = 0
+    fileprivate var _errorDescription: String? = nil
+    fileprivate var _cancelRequested: Bool = false
+
+    private let lock = NSLock()
+
+    private func withLock<T>(_ body: () -> T) -> T {
+        lock.lock()
+        defer { lock.unlock() }
+        return body()
     }
 }
 
 // MARK: - Live View
 
-public class BasicSize {
+public struct BasicSize {
     init(width: Double, height: Double) {
         self.width = width
         self.height = height
@@ -479,6 +1443,21 @@ public class BasicLiveViewFrame {
         rawPixelData.copyBytes(to: pointer, count: rawPixelDataLength)
     }
 
+    /// Returns the raw image data for the frame. This is the same data as `rawPixelData`, in a form that can be read
+    /// in place from C++. The buffer is created the first time it's asked for, and the same buffer is returned after
+    /// that.
+    public var rawPixelBuffer: BasicByteBuffer {
+        bufferLock.lock()
+        defer { bufferLock.unlock() }
+        if let buffer = _rawPixelBuffer { return buffer }
+        let buffer = BasicByteBuffer(copying: wrappedValue.rawPixelData)
+        _rawPixelBuffer = buffer
+        return buffer
+    }
+
+    private let bufferLock = NSLock()
+    private var _rawPixelBuffer: BasicByteBuffer? = nil
+
     /// Returns the size of the image contained in the `rawPixelData` property, in pixels.
     public var rawPixelSize: BasicSize {
         let size = wrappedValue.rawPixelSize
@@ -619,20 +1598,145 @@ public class BasicCameraProperty {
 
     /// Attempt to set a new value for the property. The value must be in the `validSettableValues` property. As such,
     /// this method is only useable if the property's `valueSetType` contains `CBLPropertyValueSetTypeEnumeration`.
+    ///
+    /// At most one request is sent to the camera at a time. If this method is called while a request is in flight,
+    /// the new value is queued and sent once that request completes. Only the most recent queued value is kept, so
+    /// rapid calls (for instance, when the user is scrubbing through values) don't pile up round-trips to the camera.
+    /// Poll `setStatus` to find out how setting the value went.
     public func setValue(_ newValue: BasicPropertyValue) {
+        setValue(newValue, completion: nil)
+    }
+
+    /// Attempt to set a new value for the property as `setValue(_:)` does, calling a function once setting finishes.
+    ///
+    /// `completion` is called exactly once on an internal queue, with `context` and whether setting
+    /// succeeded, after which `releaseContext` is called with `context`. If the value is superseded by a newer one
+    /// before being sent to the camera, `completion` is called with the newer value's outcome.
+    ///
+    /// - Parameter newValue: The value to set.
+    /// - Parameter context: An opaque pointer that's passed back to `completion` and `releaseContext`.
+    /// - Parameter completion: The function to call once setting finishes.
+    /// - Parameter releaseContext: The function to call once `completion` has been called.
+    public func setValueWithCompletion(_ newValue: BasicPropertyValue, context: UnsafeMutableRawPointer?,
+                                       completion: @convention(c) (UnsafeMutableRawPointer?, Bool) -> Void,
+                                       releaseContext: @convention(c) (UnsafeMutableRawPointer?) -> Void) {
+        setValue(newValue, completion: BasicCompletionCallback(context: context, completion: completion, releaseContext: releaseContext))
+    }
+
+    private func setValue(_ newValue: BasicPropertyValue, completion: BasicCompletionCallback?) {
         guard wrappedProperty.valueSetType == .enumeration else {
             print("Asked to set value on a stepped property! Nothing will happen.")
+            completion?.complete(succeeded: false)
+            return
+        }
+
+        guard let parentCamera else {
+            completion?.complete(succeeded: false)
+            return
+        }
+
+        // The status changes here rather than once the value reaches the camera's queue, so reading `setStatus` straight
+        // after calling this doesn't return the previous value's outcome.
+        withStatusLock({
+            unstartedSetCount += 1
+            _setStatus = .inProgress
+            _lastSetErrorDescription = nil
+        })
+
+        parentCamera.queue.async { [weak self] in
+            guard let self else { return }
+            self.withStatusLock({ self.unstartedSetCount -= 1 })
+            if let completion { self.pendingSetCompletions.append(completion) }
+            self.enqueueSet(of: newValue)
+        }
+    }
+
+    /// The status of the most recent value passed to `setValue(_:)`.
+    public var setStatus: BasicPropertySetStatus { return withStatusLock({ _setStatus }) }
+
+    /// A description of the error that occurred if `setStatus` is `.failed`, otherwise `nil`.
+    public var lastSetErrorDescription: String? { return withStatusLock({ _lastSetErrorDescription }) }
+
+    /// The number of values passed to `setValue(_:)` that were dropped in favour of a newer value before being sent
+    /// to the camera.
+    public var coalescedSetCount: Int { return withStatusLock({ _coalescedSetCount }) }
+
+    // Set status. Written from the caller's thread and the parent camera's queue, and read from anywhere.
+
+    private let statusLock = NSLock()
+    private var _setStatus: BasicPropertySetStatus = .idle
+    private var _lastSetErrorDescription: String? = nil
+    private var _coalescedSetCount: Int = 0
+    // Values passed to `setValue(_:)` that haven't reached the parent camera's queue yet.
+    private var unstartedSetCount: Int = 0
+
+    private func withStatusLock<T>(_ body: () -> T) -> T {
+        statusLock.lock()
+        defer { statusLock.unlock() }
+        return body()
+    }
+
+    // Value setting. Only touched on the parent camera's queue.
+
+    private var inFlightValue: BasicPropertyValue? = nil
+    private var queuedValue: BasicPropertyValue? = nil
+    private var pendingSetCompletions: [BasicCompletionCallback] = []
+
+    private func enqueueSet(of value: BasicPropertyValue) {
+        if inFlightValue != nil {
+            if queuedValue != nil { withStatusLock({ _coalescedSetCount += 1 }) }
+            queuedValue = value
             return
         }
 
+        send(value)
+    }
+
+    private func send(_ value: BasicPropertyValue) {
         guard let parentCamera else { return }
+        inFlightValue = value
+
+        wrappedProperty.setValue(value.wrappedValue, completionQueue: parentCamera.queue) { [weak self] error in
+            guard let self else { return }
+            let completedValue = self.inFlightValue
+            self.inFlightValue = nil
+
+            // Intermediate results are superseded by the queued value, so only the last one is reported.
+            if let next = self.queuedValue {
+                self.queuedValue = nil
+                if error != nil || next != completedValue {
+                    self.send(next)
+                    return
+                }
+            }
 
-        wrappedProperty.setValue(newValue.wrappedValue, completionQueue: parentCamera.queue) { error in
             if let error { print("Setting value of property failed: \(error)") }
+            self.withStatusLock({
+                // A newer value that hasn't reached our queue yet is still in progress, whatever happened to this one.
+                guard self.unstartedSetCount == 0 else { return }
+                self._lastSetErrorDescription = error?.localizedDescription
+                self._setStatus = (error == nil ? .succeeded : .failed)
+            })
+
+            let completions = self.pendingSetCompletions
+            self.pendingSetCompletions.removeAll()
+            completions.forEach({ $0.complete(succeeded: error == nil) })
         }
     }
 }
 
+/// The status of value setting on a property.
+public enum BasicPropertySetStatus: UInt {
+    /// No value has been set on the property.
+    case idle
+    /// A value is being set on the property.
+    case inProgress
+    /// The most recent value was set successfully.
+    case succeeded
+    /// The most recent value failed to be set.
+    case failed
+}
+
 /// A property value. This could either be the current value of a property, or something in the list of values that can be set.
 public class BasicPropertyValue: Equatable {
 
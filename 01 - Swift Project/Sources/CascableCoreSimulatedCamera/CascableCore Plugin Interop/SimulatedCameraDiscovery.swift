@@ -22,13 +22,12 @@ public class SimulatedCameraDiscovery: CameraDiscoveryProvider, SimulatedCameraD
     }
 
     public var visibleCameras: [Camera] {
-        if let camera = currentSimulatedCamera { return [camera] }
-        return []
+        return simulatedCameras
     }
 
     public func startDiscovery(in discoveryMode: CameraDiscoveryMode, clientName: String) {
-        isDiscovering = true
         let configuration = self.configuration
+        configuration.internalCallbackQueue.async { self.isDiscovering = true }
         configuration.internalCallbackQueue.asyncAfter(deadline: .now() + configuration.connectionSpeed.largeOperationDuration) {
             guard self.isDiscovering else { return }
 
@@ -51,15 +50,30 @@ public class SimulatedCameraDiscovery: CameraDiscoveryProvider, SimulatedCameraD
                 }
             }()
 
-            let camera = SimulatedCamera(configuration: configuration, clientName: clientName, transport: simulatedTransport)
-            camera.simulatedCameraDelegate = self
-            self.currentSimulatedCamera = camera
+            for index in 0..<max(1, configuration.cameraCount) {
+                let camera = SimulatedCamera(configuration: configuration.configuration(forCameraAt: index),
+                                             clientName: clientName, transport: simulatedTransport)
+                camera.simulatedCameraDelegate = self
+                self.simulatedCameras.append(camera)
+                self.delegate?.cameraDiscoveryProvider(self, didDiscover: camera)
+            }
         }
     }
 
+    /// Returns the queue the given camera performs its work and callbacks on. This is the configuration's
+    /// `internalCallbackQueue` unless `internalCallbackQueueTargets` was set, in which case each camera has its own queue.
+    public func internalCallbackQueue(for camera: Camera) -> DispatchQueue {
+        return (camera as? SimulatedCamera)?.configuration.internalCallbackQueue ?? configuration.internalCallbackQueue
+    }
+
     public func stopDiscovery() {
-        isDiscovering = false
-        currentSimulatedCamera = nil
+        // The camera list is only touched on our queue, where cameras are discovered and disconnections handled.
+        configuration.internalCallbackQueue.async {
+            self.isDiscovering = false
+            let lostCameras = self.simulatedCameras
+            self.simulatedCameras.removeAll()
+            lostCameras.forEach({ self.delegate?.cameraDiscoveryProvider(self, didLoseSightOf: $0) })
+        }
     }
 
     // MARK: - Internal API
@@ -70,19 +84,18 @@ public class SimulatedCameraDiscovery: CameraDiscoveryProvider, SimulatedCameraD
         configuration = config
     }
 
+    // Only accessed on the configuration's internal callback queue.
     private var isDiscovering: Bool = false
 
     func simulatedCameraDidDisconnect(_ camera: SimulatedCamera) {
-        currentSimulatedCamera = nil
-    }
-
-    private var currentSimulatedCamera: SimulatedCamera? {
-        didSet {
-            if let camera = currentSimulatedCamera {
-                delegate?.cameraDiscoveryProvider(self, didDiscover: camera)
-            } else if let oldCamera = oldValue {
-                delegate?.cameraDiscoveryProvider(self, didLoseSightOf: oldCamera)
-            }
+        // Cameras may each be on their own queue, so hop over to ours before touching the camera list.
+        configuration.internalCallbackQueue.async {
+            guard let index = self.simulatedCameras.firstIndex(where: { $0 === camera }) else { return }
+            self.simulatedCameras.remove(at: index)
+            self.delegate?.cameraDiscoveryProvider(self, didLoseSightOf: camera)
         }
     }
+
+    // Only modified on the configuration's internal callback queue.
+    private var simulatedCameras: [SimulatedCamera] = []
 }
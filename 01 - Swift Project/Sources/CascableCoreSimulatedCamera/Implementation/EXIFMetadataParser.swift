@@ -0,0 +1,164 @@
+//
+//  EXIFMetadataParser.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+
+/// Parses the commonly-used EXIF metadata out of JPEG and RAW images, without needing platform image APIs.
+///
+/// The parser reads the file incrementally: it locates the image's TIFF structure, then reads only IFD0 and the EXIF
+/// and GPS IFDs it points to (plus any out-of-line values of the tags it wants), and stops. Thumbnail IFDs, maker notes
+/// and image data are never touched, so parsing a file typically costs a few KB of I/O regardless of its size.
+///
+/// The resulting dictionary uses the same layout and key names as ImageIO's image properties (`{TIFF}`, `{Exif}` and
+/// `{GPS}` sub-dictionaries, plus top-level `Orientation`, `PixelWidth` and `PixelHeight`), so clients see the same
+/// shape of metadata on every platform. It's a subset of what ImageIO returns, though, so platforms that have ImageIO
+/// use it instead.
+struct EXIFMetadataParser {
+
+    /// The maximum number of bytes the parser will read from any one file. Files whose metadata is spread further
+    /// than this return what was found before the budget ran out.
+    static let defaultReadBudget: Int = 64 * 1024
+
+    /// Parses the metadata of the image at the given URL.
+    ///
+    /// @param url The image to parse.
+    /// @param readBudget The maximum number of bytes to read from the file.
+    /// @return Returns the image's metadata, or `nil` if the file isn't a supported image or contains no metadata.
+    static func metadata(forImageAt url: URL, readBudget: Int = defaultReadBudget) -> [String: Any]? {
+        guard let source = FileByteSource(url: url), let tiff = TIFFReader.metadataReader(for: source) else { return nil }
+        return EXIFMetadataParser(tiff: tiff, readBudget: readBudget).parse()
+    }
+
+    // MARK: - Internal
+
+    private enum ValueKind {
+        case string
+        case integer
+        case integers
+        case rational
+        case gpsCoordinate
+    }
+
+    private struct TagSpec {
+        let tag: UInt16
+        let key: String
+        let kind: ValueKind
+    }
+
+    private static let tiffTags: [TagSpec] = [
+        TagSpec(tag: 0x010F, key: "Make", kind: .string),
+        TagSpec(tag: 0x0110, key: "Model", kind: .string),
+        TagSpec(tag: 0x0112, key: "Orientation", kind: .integer),
+        TagSpec(tag: 0x0131, key: "Software", kind: .string),
+        TagSpec(tag: 0x0132, key: "DateTime", kind: .string),
+        TagSpec(tag: 0x013B, key: "Artist", kind: .string),
+        TagSpec(tag: 0x8298, key: "Copyright", kind: .string)
+    ]
+
+    private static let exifTags: [TagSpec] = [
+        TagSpec(tag: 0x829A, key: "ExposureTime", kind: .rational),
+        TagSpec(tag: 0x829D, key: "FNumber", kind: .rational),
+        TagSpec(tag: 0x8822, key: "ExposureProgram", kind: .integer),
+        TagSpec(tag: 0x8827, key: "ISOSpeedRatings", kind: .integers),
+        TagSpec(tag: 0x9003, key: "DateTimeOriginal", kind: .string),
+        TagSpec(tag: 0x9004, key: "DateTimeDigitized", kind: .string),
+        TagSpec(tag: 0x9011, key: "OffsetTimeOriginal", kind: .string),
+        TagSpec(tag: 0x9204, key: "ExposureBiasValue", kind: .rational),
+        TagSpec(tag: 0x9207, key: "MeteringMode", kind: .integer),
+        TagSpec(tag: 0x9209, key: "Flash", kind: .integer),
+        TagSpec(tag: 0x920A, key: "FocalLength", kind: .rational),
+        TagSpec(tag: 0xA002, key: "PixelXDimension", kind: .integer),
+        TagSpec(tag: 0xA003, key: "PixelYDimension", kind: .integer),
+        TagSpec(tag: 0xA402, key: "ExposureMode", kind: .integer),
+        TagSpec(tag: 0xA403, key: "WhiteBalance", kind: .integer),
+        TagSpec(tag: 0xA405, key: "FocalLenIn35mmFilm", kind: .integer),
+        TagSpec(tag: 0xA431, key: "BodySerialNumber", kind: .string),
+        TagSpec(tag: 0xA433, key: "LensMake", kind: .string),
+        TagSpec(tag: 0xA434, key: "LensModel", kind: .string)
+    ]
+
+    private static let gpsTags: [TagSpec] = [
+        TagSpec(tag: 0x0001, key: "LatitudeRef", kind: .string),
+        TagSpec(tag: 0x0002, key: "Latitude", kind: .gpsCoordinate),
+        TagSpec(tag: 0x0003, key: "LongitudeRef", kind: .string),
+        TagSpec(tag: 0x0004, key: "Longitude", kind: .gpsCoordinate),
+        TagSpec(tag: 0x0005, key: "AltitudeRef", kind: .integer),
+        TagSpec(tag: 0x0006, key: "Altitude", kind: .rational)
+    ]
+
+    private let tiff: TIFFReader
+    private let readBudget: Int
+
+    private init(tiff: TIFFReader, readBudget: Int) {
+        self.tiff = tiff
+        self.readBudget = readBudget
+    }
+
+    private var isOverBudget: Bool {
+        return tiff.source.bytesRead >= readBudget
+    }
+
+    private func parse() -> [String: Any]? {
+        guard let ifd0 = tiff.directory(at: tiff.firstIFDOffset) else { return nil }
+
+        var metadata: [String: Any] = [:]
+        let tiffProperties = values(of: EXIFMetadataParser.tiffTags, in: ifd0.entries)
+        if !tiffProperties.isEmpty { metadata["{TIFF}"] = tiffProperties }
+        if let orientation = tiffProperties["Orientation"] { metadata["Orientation"] = orientation }
+
+        if let exifProperties = subdirectoryValues(pointedToBy: TIFFReader.Tag.exifIFD, in: ifd0.entries,
+                                                   using: EXIFMetadataParser.exifTags) {
+            metadata["{Exif}"] = exifProperties
+            if let width = exifProperties["PixelXDimension"] { metadata["PixelWidth"] = width }
+            if let height = exifProperties["PixelYDimension"] { metadata["PixelHeight"] = height }
+        }
+
+        if let gpsProperties = subdirectoryValues(pointedToBy: TIFFReader.Tag.gpsIFD, in: ifd0.entries,
+                                                  using: EXIFMetadataParser.gpsTags) {
+            metadata["{GPS}"] = gpsProperties
+        }
+
+        return metadata.isEmpty ? nil : metadata
+    }
+
+    private func subdirectoryValues(pointedToBy tag: UInt16, in entries: [TIFFEntry], using specs: [TagSpec]) -> [String: Any]? {
+        guard !isOverBudget, let pointer = entries.first(where: { $0.tag == tag }),
+              let offset = tiff.integerValues(of: pointer, limit: 1).first,
+              let directory = tiff.directory(at: tiff.base + offset) else { return nil }
+        let values = values(of: specs, in: directory.entries)
+        return values.isEmpty ? nil : values
+    }
+
+    private func values(of specs: [TagSpec], in entries: [TIFFEntry]) -> [String: Any] {
+        var entriesByTag: [UInt16: TIFFEntry] = [:]
+        for entry in entries { entriesByTag[entry.tag] = entry }
+
+        var values: [String: Any] = [:]
+        for spec in specs {
+            guard !isOverBudget else { break }
+            guard let entry = entriesByTag[spec.tag] else { continue }
+
+            switch spec.kind {
+            case .string:
+                values[spec.key] = tiff.stringValue(of: entry)
+            case .integer:
+                values[spec.key] = tiff.integerValues(of: entry, limit: 1).first
+            case .integers:
+                let integers = tiff.integerValues(of: entry, limit: 8)
+                if !integers.isEmpty { values[spec.key] = integers }
+            case .rational:
+                values[spec.key] = tiff.rationalValues(of: entry, limit: 1).first
+            case .gpsCoordinate:
+                // Degrees, minutes and seconds, reported as decimal degrees like ImageIO does.
+                let components = tiff.rationalValues(of: entry, limit: 3)
+                guard components.count == 3 else { continue }
+                values[spec.key] = components[0] + (components[1] / 60.0) + (components[2] / 3600.0)
+            }
+        }
+        return values
+    }
+}
@@ -0,0 +1,155 @@
+//
+//  EmbeddedImageExtractor.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+
+/// Extracts the JPEG thumbnails and previews that cameras embed in the images they write, without decoding the image
+/// itself and without needing Core Graphics.
+///
+/// For JPEG files, this is the thumbnail in the EXIF block's IFD1. For TIFF-based RAW formats (CR2, NEF, ARW, DNG,
+/// ORF, RW2, PEF, etc.) every IFD is searched for embedded JPEGs, and for RAF files the embedded JPEG pointed to by
+/// the file header is used. Only the file's headers, directories, and the chosen JPEG are read — typically a few
+/// kilobytes plus the size of the image being returned.
+struct EmbeddedImageExtractor {
+
+    /// The kinds of embedded image that can be extracted.
+    enum Kind {
+        /// The smallest embedded image, usually around 160x120 pixels.
+        case thumbnail
+        /// The largest embedded image.
+        case preview
+    }
+
+    /// The largest image size (in pixels along the long edge) worth serving from an embedded thumbnail. EXIF
+    /// thumbnails are usually 160x120, and showing one in place of a render this size is acceptable.
+    static let thumbnailMaxSize: CGFloat = 320.0
+
+    /// Returns the embedded JPEG of the given kind from the given image file, or `nil` if the file doesn't contain
+    /// one that can be found.
+    static func embeddedJPEG(_ kind: Kind, inImageAt url: URL) -> Data? {
+        guard let source = FileByteSource(url: url) else { return nil }
+        let extractor = EmbeddedImageExtractor(source: source)
+
+        if kind == .preview, extractor.isJPEG(at: 0) {
+            // A JPEG is its own best preview. Anything embedded in it is a smaller copy.
+            return source.read(at: 0, count: source.length)
+        }
+
+        let candidates = extractor.candidates()
+        let sorted = candidates.sorted(by: { $0.length < $1.length })
+        guard let chosen = (kind == .thumbnail ? sorted.first : sorted.last) else { return nil }
+        return source.read(at: chosen.offset, count: chosen.length)
+    }
+
+    // MARK: - Internal
+
+    private struct Candidate {
+        let offset: Int
+        let length: Int
+    }
+
+    private let source: FileByteSource
+
+    // Limits to keep malformed files from sending us around in circles.
+    private static let maximumIFDCount: Int = 32
+    private static let maximumJPEGSegmentScan: Int = 64
+
+    private init(source: FileByteSource) {
+        self.source = source
+    }
+
+    private func candidates() -> [Candidate] {
+        guard let header = source.read(at: 0, count: 16) else { return [] }
+
+        if isJPEG(at: 0) {
+            return candidatesInJPEG(at: 0)
+        }
+
+        if header.starts(with: Array("FUJIFILMCCD-RAW".utf8)) {
+            // RAF: a big-endian offset and length of the embedded (EXIF-carrying) JPEG live at byte 84.
+            guard let raf = source.read(at: 84, count: 8) else { return [] }
+            let bytes = [UInt8](raf)
+            let offset = Int(bytes[0]) << 24 | Int(bytes[1]) << 16 | Int(bytes[2]) << 8 | Int(bytes[3])
+            let length = Int(bytes[4]) << 24 | Int(bytes[5]) << 16 | Int(bytes[6]) << 8 | Int(bytes[7])
+            var found = candidatesInJPEG(at: offset)
+            if isJPEG(at: offset), length <= source.length - offset { found.append(Candidate(offset: offset, length: length)) }
+            return found
+        }
+
+        guard let tiff = TIFFReader(source: source, base: 0) else { return [] }
+        return candidatesInTIFF(tiff)
+    }
+
+    private func isJPEG(at offset: Int) -> Bool {
+        guard let marker = source.read(at: offset, count: 3) else { return false }
+        return marker.elementsEqual([0xFF, 0xD8, 0xFF])
+    }
+
+    private func candidatesInJPEG(at offset: Int) -> [Candidate] {
+        guard let tiff = TIFFReader.exifReader(inJPEGAt: offset, of: source) else { return [] }
+        return candidatesInTIFF(tiff)
+    }
+
+    private func candidatesInTIFF(_ tiff: TIFFReader) -> [Candidate] {
+        var found: [Candidate] = []
+        var pendingIFDs: [Int] = [tiff.firstIFDOffset]
+        var visitedIFDs = Set<Int>()
+
+        while let ifdOffset = pendingIFDs.popLast(), visitedIFDs.count < EmbeddedImageExtractor.maximumIFDCount {
+            guard visitedIFDs.insert(ifdOffset).inserted, let directory = tiff.directory(at: ifdOffset) else { continue }
+            if let next = directory.nextIFDOffset { pendingIFDs.append(next) }
+
+            func entry(_ tag: UInt16) -> TIFFEntry? { return directory.entries.first(where: { $0.tag == tag }) }
+            func value(_ tag: UInt16) -> Int? { return entry(tag).flatMap({ tiff.integerValues(of: $0, limit: 1).first }) }
+
+            if let subIFDs = entry(TIFFReader.Tag.subIFDs) {
+                pendingIFDs.append(contentsOf: tiff.integerValues(of: subIFDs).map({ tiff.base + $0 }))
+            }
+
+            // EXIF thumbnails, and the previews in NEF/ARW/PEF SubIFDs.
+            if let offset = value(TIFFReader.Tag.jpegInterchangeFormat),
+               let length = value(TIFFReader.Tag.jpegInterchangeFormatLength) {
+                found.append(Candidate(offset: tiff.base + offset, length: length))
+            }
+
+            // Single-strip, JPEG-compressed images (such as the preview in CR2's IFD0).
+            if let compression = value(TIFFReader.Tag.compression), compression == 6 || compression == 7,
+               let offsets = entry(TIFFReader.Tag.stripOffsets), offsets.count == 1,
+               let offset = value(TIFFReader.Tag.stripOffsets), let length = value(TIFFReader.Tag.stripByteCounts) {
+                found.append(Candidate(offset: tiff.base + offset, length: length))
+            }
+
+            // Panasonic RW2 stores its preview JPEG as the value of a tag.
+            if let jpeg = entry(TIFFReader.Tag.panasonicJPEGFromRAW), jpeg.type == 7 {
+                found.append(Candidate(offset: jpeg.valueOffset, length: jpeg.count))
+            }
+        }
+
+        return found.filter({ candidate in
+            return candidate.offset >= 0 && candidate.length > 0 && candidate.length <= source.length - candidate.offset &&
+                isDisplayableJPEG(at: candidate.offset)
+        })
+    }
+
+    // Raw image data is often stored as lossless JPEG, which looks like any other JPEG until its frame header.
+    private func isDisplayableJPEG(at offset: Int) -> Bool {
+        guard isJPEG(at: offset) else { return false }
+        var segmentOffset = offset + 2
+        for _ in 0..<EmbeddedImageExtractor.maximumJPEGSegmentScan {
+            guard let segmentHeader = source.read(at: segmentOffset, count: 4) else { return false }
+            let bytes = [UInt8](segmentHeader)
+            guard bytes[0] == 0xFF else { return false }
+            switch bytes[1] {
+            case 0xC0, 0xC1, 0xC2: return true // Baseline, extended and progressive DCT.
+            case 0xC3...0xCF where bytes[1] != 0xC4 && bytes[1] != 0xC8 && bytes[1] != 0xCC: return false
+            case 0xDA, 0xD9: return false
+            default: segmentOffset += 2 + (Int(bytes[2]) << 8 | Int(bytes[3]))
+            }
+        }
+        return false
+    }
+}
@@ -0,0 +1,38 @@
+//
+//  FNV1aHash.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+
+/// 64-bit FNV-1a, used to turn identifiers and paths into short, filesystem-safe names and cache addresses.
+///
+/// It isn't a cryptographic hash, so anything that relies on a digest being unique should also check the value the
+/// digest was made from.
+enum FNV1aHash {
+
+    /// The hash of no bytes at all, which is also where hashing starts.
+    static let offsetBasis: UInt64 = 0xcbf29ce484222325
+
+    /// Returns the hash of the given bytes, optionally continuing from a previous hash.
+    static func hash<Bytes: Sequence>(_ bytes: Bytes, startingWith initialValue: UInt64 = offsetBasis) -> UInt64 where Bytes.Element == UInt8 {
+        var hash: UInt64 = initialValue
+        for byte in bytes {
+            hash ^= UInt64(byte)
+            hash = hash &* 0x100000001b3
+        }
+        return hash
+    }
+
+    /// Returns the hash of the given string's UTF-8 representation.
+    static func hash(_ string: String) -> UInt64 {
+        return hash(string.utf8)
+    }
+
+    /// Returns the hash of the given string's UTF-8 representation as 16 lowercase hex digits.
+    static func hexString(_ string: String) -> String {
+        return String(format: "%016llx", hash(string))
+    }
+}
@@ -0,0 +1,179 @@
+//
+//  SimulatedCamera+Catalog.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+import CascableCore
+
+/// Catalogs a simulated storage device's entire file tree in the background.
+///
+/// Directories are listed by a bounded pool of workers, so a deep card tree is walked concurrently rather than one
+/// `loadChildren` call at a time. Discovered items are delivered to the storage's filesystem observers in batches as
+/// soon as each directory has been listed, and the storage's `catalogProgress` is updated as directories complete (its
+/// total grows as new directories are discovered). Cataloged folders have their children populated, so the next
+/// `loadChildren` call on them completes without listing the directory again.
+///
+/// When given a snapshot from a previous connection (whose contents the storage has already been populated with), the
+/// catalog becomes a validation pass: directories whose modification date, and whose files' sizes and modification
+/// dates, match the snapshot are taken as-is without being listed, and changed directories are re-listed with only the
+/// differences delivered to observers.
+final class SimulatedCameraCatalog {
+
+    /// The default maximum number of directories being listed at once.
+    static let defaultMaximumConcurrentListings: Int = 4
+
+    /// The default maximum number of items delivered to observers in a single batch.
+    static let defaultBatchSize: Int = 250
+
+    init(storage: SimulatedCameraStorage, snapshot: SimulatedStorageSnapshot? = nil,
+         maximumConcurrentListings: Int = defaultMaximumConcurrentListings, batchSize: Int = defaultBatchSize) {
+        self.storage = storage
+        self.snapshot = snapshot
+        self.configuration = storage.configuration
+        self.maximumConcurrentListings = max(1, maximumConcurrentListings)
+        self.batchSize = max(1, batchSize)
+        progress = Progress(totalUnitCount: 1)
+        progress.isCancellable = false
+        progress.isPausable = false
+    }
+
+    /// The catalog's progress, measured in directories. The total will increase as new directories are discovered.
+    let progress: Progress
+
+    /// Start cataloging from the storage's root directory. Has no effect if the catalog has already been started.
+    func start() {
+        guard let root = storage?.rootDirectory as? SimulatedCameraFolder else { return }
+        stateQueue.async {
+            guard !self.started else { return }
+            self.started = true
+            self.pendingFolders.append(root)
+            self.scheduleListings()
+        }
+    }
+
+    /// Stop cataloging. Directory listings already in progress will complete, but their results won't be delivered.
+    func cancel() {
+        stateQueue.async {
+            self.cancelled = true
+            self.pendingFolders.removeAll()
+            self.nextPendingFolder = 0
+        }
+    }
+
+    // MARK: - Internal
+
+    private weak var storage: SimulatedCameraStorage?
+    private let snapshot: SimulatedStorageSnapshot?
+    private let configuration: SimulatedCameraConfiguration
+    private let maximumConcurrentListings: Int
+    private let batchSize: Int
+
+    // State is only touched on the state queue. Listing itself happens on the worker queue.
+    private let stateQueue = DispatchQueue(label: "Simulated Camera Catalog")
+    private let workerQueue = DispatchQueue(label: "Simulated Camera Catalog Workers", qos: .utility, attributes: .concurrent)
+    // Folders waiting to be listed start at `nextPendingFolder`. Dequeuing moves the index on rather than removing the
+    // array's first element, which would shift every folder behind it.
+    private var pendingFolders: [SimulatedCameraFolder] = []
+    private var nextPendingFolder: Int = 0
+    private var activeListings: Int = 0
+    private var started: Bool = false
+    private var cancelled: Bool = false
+
+    // Must be called on the state queue.
+    private func scheduleListings() {
+        while !cancelled, activeListings < maximumConcurrentListings, nextPendingFolder < pendingFolders.count {
+            // Breadth-first, so the top levels of the card (which clients are most likely to be showing) come in first.
+            let folder = pendingFolders[nextPendingFolder]
+            nextPendingFolder += 1
+            activeListings += 1
+            // Checking whether a snapshotted directory has changed is a much smaller request than listing it.
+            let snapshotted = storage.flatMap({ snapshot?.directories[$0.relativePath(for: folder.url)] })
+            let latency = snapshotted == nil ? configuration.connectionSpeed.mediumOperationDuration :
+                configuration.connectionSpeed.smallOperationDuration
+            workerQueue.asyncAfter(deadline: .now() + latency) {
+                self.list(folder, snapshotted: snapshotted)
+            }
+        }
+
+        // Drop dequeued folders once they make up most of the array, so each one is only moved a constant number of
+        // times on average.
+        if nextPendingFolder > 0, nextPendingFolder * 2 >= pendingFolders.count {
+            pendingFolders.removeFirst(nextPendingFolder)
+            nextPendingFolder = 0
+        }
+    }
+
+    private func list(_ folder: SimulatedCameraFolder, snapshotted: SimulatedStorageSnapshot.Directory?) {
+        guard let storage, storage.camera != nil else {
+            didList(folder, subfolders: [])
+            return
+        }
+
+        let modificationDate = SimulatedStorageSnapshot.modificationDate(ofDirectoryAt: folder.url)
+        if let snapshotted, let modificationDate, snapshotted.modificationDate == modificationDate,
+           SimulatedStorageSnapshot.filesAreUnchanged(in: snapshotted, at: folder.url) {
+            // Unchanged since the snapshot, so the children the storage was populated with stand.
+            configuration.internalCallbackQueue.async {
+                folder.whenChildrenNotLoading {
+                    let subfolders = folder.isDetached ? [] : (folder.children ?? []).compactMap({ $0 as? SimulatedCameraFolder })
+                    self.didList(folder, subfolders: subfolders)
+                }
+            }
+            return
+        }
+
+        // If the directory can't be listed, its existing children are left alone.
+        let listed = SimulatedCameraFolder.listChildren(of: folder.url, parent: folder, on: storage)
+
+        configuration.internalCallbackQueue.async {
+            // A load of the same folder may be in progress, in which case we merge our listing once it's done rather
+            // than changing the folder's children underneath it.
+            folder.whenChildrenNotLoading {
+                // Folders that have gone from the tree since they were queued aren't worth cataloging.
+                guard !self.stateQueue.sync(execute: { self.cancelled }), !folder.isDetached else {
+                    self.didList(folder, subfolders: [])
+                    return
+                }
+
+                // Existing items are kept (restored subfolders already hold their own children), and observers are
+                // only told about the differences.
+                if let listed {
+                    let (added, removed) = folder.catalogDidListChildren(listed, modificationDate: modificationDate)
+                    self.notifyObservers(of: .filesAdded, in: folder, affecting: added)
+                    self.notifyObservers(of: .filesRemoved, in: folder, affecting: removed)
+                }
+                self.didList(folder, subfolders: (folder.children ?? []).compactMap({ $0 as? SimulatedCameraFolder }))
+            }
+        }
+    }
+
+    private func didList(_ folder: SimulatedCameraFolder, subfolders: [SimulatedCameraFolder]) {
+        stateQueue.async {
+            self.activeListings -= 1
+            guard !self.cancelled else { return }
+
+            self.configuration.internalCallbackQueue.async {
+                self.progress.totalUnitCount += Int64(subfolders.count)
+                self.progress.completedUnitCount += 1
+            }
+
+            self.pendingFolders.append(contentsOf: subfolders)
+            self.scheduleListings()
+        }
+    }
+
+    // Must be called on the configuration's internal callback queue.
+    private func notifyObservers(of operation: FileSystemModificationOperation, in folder: SimulatedCameraFolder,
+                                 affecting items: [FileSystemItem]) {
+        guard let storage, !items.isEmpty else { return }
+        var batchStart = 0
+        while batchStart < items.count {
+            let batchEnd = min(batchStart + batchSize, items.count)
+            storage.notifyFileSystemObservers(of: operation, in: folder, affecting: Array(items[batchStart..<batchEnd]))
+            batchStart = batchEnd
+        }
+    }
+}
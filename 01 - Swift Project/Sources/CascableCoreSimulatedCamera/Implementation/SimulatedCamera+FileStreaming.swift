@@ -0,0 +1,122 @@
+//
+//  SimulatedCamera+FileStreaming.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+
+/// Reads a file (or a byte range of one) in chunks for streaming, keeping the next chunk ready while the current
+/// one is being delivered.
+///
+/// Where possible the file is memory-mapped, and chunks are views of the mapping rather than copies of it. Each one
+/// keeps the mapping alive for as long as it exists. Otherwise, the file is read through a file handle. Either way, as
+/// soon as a chunk is handed out the following one is read on a background queue (for a mapping, by touching its
+/// pages), so disk I/O overlaps with the consumer's handling of the current chunk rather than being serialised with
+/// it. Chunks are indexed from zero.
+final class SimulatedFileStreamReader {
+
+    /// Creates a reader for the given file, or returns `nil` if the file can't be opened.
+    ///
+    /// @param url The file to read.
+    /// @param offset The offset into the file at which to start reading.
+    /// @param length The maximum number of bytes to read, or `nil` to read to the end of the file.
+    /// @param chunkSize The maximum size of each chunk, in bytes.
+    init?(url: URL, offset: UInt64 = 0, length: UInt64? = nil, chunkSize: Int) {
+        if let mapped = try? NSData(contentsOf: url, options: [.alwaysMapped]) {
+            mappedData = mapped
+            fileHandle = nil
+            totalFileSize = mapped.length
+        } else if let handle = try? FileHandle(forReadingFrom: url) {
+            mappedData = nil
+            fileHandle = handle
+            totalFileSize = Int(handle.seekToEndOfFile())
+        } else {
+            return nil
+        }
+
+        self.chunkSize = max(1, chunkSize)
+        let start = Int(min(offset, UInt64(totalFileSize)))
+        let end = start + Int(min(UInt64(totalFileSize - start), length ?? UInt64.max))
+        range = start..<end
+        readOffset = start
+        endOffset = end
+    }
+
+    /// The total size of the file, in bytes.
+    let totalFileSize: Int
+
+    /// The byte range of the file that will be read, clamped to the file's size.
+    let range: Range<Int>
+
+    /// Hands out the next chunk of the file on a background queue, then starts reading the one after it.
+    ///
+    /// @param completion Called with the next chunk (or `nil` if there's nothing left to read or the read failed),
+    /// and whether that chunk is the last one.
+    func readNextChunk(then completion: @escaping (_ chunk: Data?, _ isLast: Bool) -> Void) {
+        ioQueue.async {
+            let chunk = self.readAhead ?? self.readChunk()
+            self.readAhead = nil
+            completion(chunk, self.readOffset >= self.endOffset)
+
+            guard chunk != nil, self.readOffset < self.endOffset else { return }
+            self.ioQueue.async {
+                if self.readAhead == nil { self.readAhead = self.readChunk() }
+            }
+        }
+    }
+
+    /// Releases the reader's file handle or mapping. Chunks already handed out remain valid.
+    func close() {
+        ioQueue.async {
+            self.readAhead = nil
+            self.fileHandle?.closeFile()
+        }
+    }
+
+    // MARK: - Internal
+
+    // NSData rather than Data, since its bytes stay at the same address for as long as it exists.
+    private let mappedData: NSData?
+    private let fileHandle: FileHandle?
+    private let chunkSize: Int
+    private static let pageSize: Int = 4096
+    private let ioQueue = DispatchQueue(label: "Simulated File Stream Reader", qos: .userInitiated)
+
+    // Only touched on the I/O queue.
+    private var readOffset: Int
+    private let endOffset: Int
+    private var readAhead: Data? = nil
+    // Keeps the page touches in readChunk() from being optimised away.
+    private var pageChecksum: UInt8 = 0
+
+    // Must be called on the I/O queue.
+    private func readChunk() -> Data? {
+        guard readOffset < endOffset else { return nil }
+        let length = min(chunkSize, endOffset - readOffset)
+        let chunk: Data
+
+        if let mappedData {
+            let bytes = mappedData.bytes.advanced(by: readOffset)
+            // Touching a byte in each page faults them in here on the I/O queue, rather than when the consumer gets to
+            // them. The chunk's deallocator holds on to the mapping, so the chunk stays valid after the reader closes.
+            var checksum: UInt8 = 0
+            for pageOffset in stride(from: 0, to: length, by: Self.pageSize) {
+                checksum ^= bytes.load(fromByteOffset: pageOffset, as: UInt8.self)
+            }
+            pageChecksum = checksum
+            chunk = Data(bytesNoCopy: UnsafeMutableRawPointer(mutating: bytes), count: length,
+                         deallocator: .custom({ _, _ in withExtendedLifetime(mappedData) {} }))
+        } else if let fileHandle {
+            fileHandle.seek(toFileOffset: UInt64(readOffset))
+            chunk = fileHandle.readData(ofLength: length)
+            guard !chunk.isEmpty else { return nil }
+        } else {
+            return nil
+        }
+
+        readOffset += chunk.count
+        return chunk
+    }
+}
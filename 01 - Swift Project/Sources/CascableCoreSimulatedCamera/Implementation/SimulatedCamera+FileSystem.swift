@@ -19,7 +19,7 @@ class SimulatedCameraStorage: NSObject, FileStorage {
     let rootUrl: URL
     let configuration: SimulatedCameraConfiguration
     weak var camera: Camera?
-    var catalogProgress: Progress? = nil
+    var catalogProgress: Progress? { return catalog?.progress }
 
     init(camera: SimulatedCamera, rootFolder: URL) {
         self.camera = camera
@@ -27,10 +27,19 @@ class SimulatedCameraStorage: NSObject, FileStorage {
         rootUrl = rootFolder
     }
 
+    deinit {
+        catalog?.cancel()
+    }
+
     lazy var rootDirectory: FileSystemFolderItem = {
         return SimulatedCameraFolder(url: rootUrl, parent: nil, on: self)
     }()
 
+    /// A stable identifier for the storage, used to key its items in the image cache and its snapshot.
+    lazy var cacheIdentifier: String = {
+        return "\(configuration.identifier):\(rootUrl.standardizedFileURL.path)"
+    }()
+
     // MARK: - Filesystem Properties
 
     private func resourceValues() -> URLResourceValues? {
@@ -47,14 +56,68 @@ class SimulatedCameraStorage: NSObject, FileStorage {
     var hasInaccessibleImages: Bool { return false }
     var slot: StorageSlot { return .unknown }
 
+    // MARK: - Cataloging
+
+    private var catalog: SimulatedCameraCatalog? = nil
+
+    /// Start cataloging the storage's file tree in the background. Discovered items will be delivered to filesystem
+    /// observers as they're found. Has no effect if cataloging has already been started.
+    ///
+    /// If a snapshot of the storage from a previous connection is available, the storage's folders are populated from
+    /// it immediately, and cataloging only re-lists the directories that have changed since.
+    func beginCataloging() {
+        guard catalog == nil else { return }
+        let snapshot = restoreSnapshot()
+        let newCatalog = SimulatedCameraCatalog(storage: self, snapshot: snapshot)
+        catalog = newCatalog
+        newCatalog.start()
+    }
+
+    /// Stops cataloging and drops all filesystem observers. Called when the camera disconnects, after which the
+    /// storage won't change any more.
+    ///
+    /// Must be called on the configuration's internal callback queue.
+    func invalidate() {
+        catalog?.cancel()
+        observerLock.lock()
+        fileSystemObservers.removeAll()
+        observerLock.unlock()
+    }
+
     // MARK: - Observers
 
+    // Observers can be added and removed from any thread, so they're guarded by a lock.
+    private let observerLock = NSLock()
+    private var fileSystemObservers: [String: FileStorageFilesModifiedObserver] = [:]
+
     func addFileSystemObserver(_ observer: @escaping FileStorageFilesModifiedObserver) -> String {
-        return UUID().uuidString
+        let token = UUID().uuidString
+        observerLock.lock()
+        fileSystemObservers[token] = observer
+        observerLock.unlock()
+        return token
     }
 
     func removeFileSystemObserver(withToken observer: String) {
+        observerLock.lock()
+        fileSystemObservers.removeValue(forKey: observer)
+        observerLock.unlock()
+    }
 
+    internal var fileSystemObserverCount: Int {
+        observerLock.lock()
+        defer { observerLock.unlock() }
+        return fileSystemObservers.count
+    }
+
+    // Must be called on the configuration's internal callback queue.
+    internal func notifyFileSystemObservers(of operation: FileSystemModificationOperation, in folder: FileSystemFolderItem?,
+                                            affecting items: [FileSystemItem]) {
+        // Observers are called outside the lock, so they can remove themselves.
+        observerLock.lock()
+        let observers = Array(fileSystemObservers.values)
+        observerLock.unlock()
+        observers.forEach({ $0(self, folder, operation, items) })
     }
 }
 
@@ -98,6 +161,113 @@ class SimulatedCameraFolder: NSObject, FileSystemFolderItem {
     var childrenLoaded: Bool = false
     var childrenLoading: Bool = false
 
+    // Set when the storage's catalog has populated our children, so the next load doesn't need to list them again.
+    private var childrenLoadedByCatalog: Bool = false
+
+    // Work waiting for a `loadChildren` call in progress to finish.
+    private var childrenLoadContinuations: [() -> Void] = []
+
+    /// The directory's modification date when its children were last listed.
+    private(set) var listedModificationDate: Date? = nil
+
+    /// Set when the directory has disappeared from its parent's listing.
+    private(set) var wasRemoved: Bool = false
+
+    /// Whether the directory, or one of its ancestors, has disappeared from the storage's tree.
+    ///
+    /// Must be called on the configuration's internal callback queue.
+    internal var isDetached: Bool {
+        var folder: SimulatedCameraFolder? = self
+        while let current = folder {
+            if current.wasRemoved { return true }
+            folder = current.parent as? SimulatedCameraFolder
+        }
+        return false
+    }
+
+    /// Performs the given block once any `loadChildren` call in progress has finished, or straight away if there
+    /// isn't one.
+    ///
+    /// Must be called on the configuration's internal callback queue.
+    internal func whenChildrenNotLoading(_ block: @escaping () -> Void) {
+        if childrenLoading {
+            childrenLoadContinuations.append(block)
+        } else {
+            block()
+        }
+    }
+
+    /// Merges a listing of the directory made by the storage's catalog into our children. See `mergeListedChildren(_:modificationDate:)`.
+    ///
+    /// Must be called on the configuration's internal callback queue, while children aren't being loaded.
+    @discardableResult
+    internal func catalogDidListChildren(_ listed: [FileSystemItem], modificationDate: Date?) -> (added: [FileSystemItem], removed: [FileSystemItem]) {
+        assert(!childrenLoading, "The catalog mustn't change children while they're being loaded")
+        childrenLoadedByCatalog = true
+        return mergeListedChildren(listed, modificationDate: modificationDate)
+    }
+
+    /// Merges a fresh listing of the directory into our children. Items that were already there keep their existing
+    /// objects (refreshed from the listing), so items clients are holding on to stay part of the tree.
+    ///
+    /// @return Returns the items that were added to and removed from our children.
+    @discardableResult
+    private func mergeListedChildren(_ listed: [FileSystemItem], modificationDate: Date?) -> (added: [FileSystemItem], removed: [FileSystemItem]) {
+        var existingByName: [String: FileSystemItem] = [:]
+        for item in children ?? [] { existingByName[SimulatedCameraFolder.name(of: item)] = item }
+
+        var added: [FileSystemItem] = []
+        let merged: [FileSystemItem] = listed.map({ item in
+            let name = SimulatedCameraFolder.name(of: item)
+            let existing = existingByName.removeValue(forKey: name)
+            if let existingFolder = existing as? SimulatedCameraFolder, item is SimulatedCameraFolder {
+                return existingFolder
+            }
+            if let existingFile = existing as? SimulatedCameraFile, let listedFile = item as? SimulatedCameraFile {
+                existingFile.refresh(from: listedFile)
+                return existingFile
+            }
+            // A file became a folder (or vice versa), so the old item goes away.
+            if let existing { existingByName[name] = existing }
+            added.append(item)
+            return item
+        })
+
+        let removed = Array(existingByName.values)
+        removed.forEach({ ($0 as? SimulatedCameraFolder)?.wasRemoved = true })
+
+        children = merged
+        childrenLoaded = true
+        listedModificationDate = modificationDate
+        return (added, removed)
+    }
+
+    private static func name(of item: FileSystemItem) -> String {
+        if let folder = item as? SimulatedCameraFolder { return folder.url.lastPathComponent }
+        if let file = item as? SimulatedCameraFile { return file.url.lastPathComponent }
+        return item.name ?? ""
+    }
+
+    /// Lists the immediate children of the given directory, or returns `nil` if the directory can't be listed.
+    internal static func listChildren(of directoryUrl: URL, parent: SimulatedCameraFolder,
+                                      on storage: SimulatedCameraStorage) -> [FileSystemItem]? {
+        guard let enumerator = FileManager.default.enumerator(at: directoryUrl,
+                                                              includingPropertiesForKeys: [.isDirectoryKey],
+                                                              options: [.skipsHiddenFiles, .skipsSubdirectoryDescendants, .skipsPackageDescendants],
+                                                              errorHandler: nil) else { return nil }
+
+        var children: [FileSystemItem] = []
+        for case let fileUrl as URL in enumerator {
+            guard let properties = try? fileUrl.resourceValues(forKeys: [.isDirectoryKey]) else { continue }
+            if properties.isDirectory ?? false {
+                children.append(SimulatedCameraFolder(url: fileUrl, parent: parent, on: storage))
+            } else {
+                children.append(SimulatedCameraFile(url: fileUrl, parent: parent, on: storage))
+            }
+        }
+        return children
+    }
+
     func loadChildren(_ callback: @escaping ErrorableOperationCallback) {
         guard let storage = storage as? SimulatedCameraStorage, let camera = storage.camera else {
             callback(NSError(cblErrorCode: .notConnected))
@@ -109,41 +279,43 @@ class SimulatedCameraFolder: NSObject, FileSystemFolderItem {
             return
         }
 
+        let configuration = self.configuration
+
+        if childrenLoadedByCatalog {
+            // The catalog has already listed this folder — a subsequent load will refresh it.
+            childrenLoadedByCatalog = false
+            configuration.internalCallbackQueue.async { callback(nil) }
+            return
+        }
+
         let urlToEnumerate = url
         childrenLoading = true
-        let configuration = self.configuration
         DispatchQueue.global(qos: .userInitiated).asyncAfter(deadline: .now() + configuration.connectionSpeed.mediumOperationDuration) {
-            guard let enumerator = FileManager.default.enumerator(at: urlToEnumerate,
-                                                                  includingPropertiesForKeys: [.isDirectoryKey],
-                                                                  options: [.skipsHiddenFiles, .skipsSubdirectoryDescendants, .skipsPackageDescendants],
-                                                                  errorHandler: nil) else
-            {
+            let modificationDate = SimulatedStorageSnapshot.modificationDate(ofDirectoryAt: urlToEnumerate)
+            guard let newChildren = SimulatedCameraFolder.listChildren(of: urlToEnumerate, parent: self, on: storage) else {
                 configuration.internalCallbackQueue.async {
-                    self.childrenLoading = false
+                    self.didFinishLoadingChildren()
                     callback(NSError(cblErrorCode: .deviceBusy))
                 }
                 return
             }
 
-            var newChildren: [FileSystemItem] = []
-            for case let fileUrl as URL in enumerator {
-                guard let properties = try? fileUrl.resourceValues(forKeys: [.isDirectoryKey]) else { continue }
-                if properties.isDirectory ?? false {
-                    newChildren.append(SimulatedCameraFolder(url: fileUrl, parent: self, on: storage))
-                } else {
-                    newChildren.append(SimulatedCameraFile(url: fileUrl, parent: self, on: storage))
-                }
-            }
-
             configuration.internalCallbackQueue.async {
-                self.children = newChildren
-                self.childrenLoaded = true
-                self.childrenLoading = false
+                self.mergeListedChildren(newChildren, modificationDate: modificationDate)
+                self.didFinishLoadingChildren()
                 callback(nil)
             }
         }
     }
 
+    // Must be called on the configuration's internal callback queue.
+    private func didFinishLoadingChildren() {
+        childrenLoading = false
+        let continuations = childrenLoadContinuations
+        childrenLoadContinuations.removeAll()
+        continuations.forEach({ $0() })
+    }
+
     // Deleting
 
     func removeFromDevice(_ block: @escaping ErrorableOperationCallback) {
@@ -198,9 +370,13 @@ class SimulatedCameraFolder: NSObject, FileSystemFolderItem {
     }
 
     func streamItem(preflightBlock preflight: @escaping FileStreamPreflight, preflightQueue: DispatchQueue, chunkDeliveryBlock chunkDelivery: @escaping FileStreamChunkDelivery, deliveryQueue: DispatchQueue, complete: @escaping FileStreamCompletion, complete completeQueue: DispatchQueue) -> Progress {
+        return streamItem(fromOffset: 0, length: nil, preflightBlock: { item, _, _ in preflight(item) }, preflightQueue: preflightQueue, chunkDeliveryBlock: chunkDelivery, deliveryQueue: deliveryQueue, complete: complete, complete: completeQueue)
+    }
+
+    func streamItem(fromOffset offset: UInt64, length: UInt64?, preflightBlock preflight: @escaping FileStreamRangePreflight, preflightQueue: DispatchQueue, chunkDeliveryBlock chunkDelivery: @escaping FileStreamChunkDelivery, deliveryQueue: DispatchQueue, complete: @escaping FileStreamCompletion, complete completeQueue: DispatchQueue) -> Progress {
 
         preflightQueue.async {
-            let context = preflight(self)
+            let context = preflight(self, 0, 0..<0)
             deliveryQueue.async {
                 complete(self, NSError(cblErrorCode: .notAvailable), context)
             }
@@ -226,6 +402,19 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
         dateCreated = resourceValues()?.creationDate
     }
 
+    /// Create a file whose size and date are already known (for example, from a storage snapshot), without
+    /// touching the filesystem.
+    init(url: URL, parent: FileSystemFolderItem?, on storage: SimulatedCameraStorage, size: UInt, dateCreated: Date?) {
+        self.storage = storage
+        self.parent = parent
+        self.handle = url
+        self.url = url
+        self.configuration = storage.configuration
+        self.knownSize = size
+        self.dateCreated = dateCreated
+        super.init()
+    }
+
     let configuration: SimulatedCameraConfiguration
     var parent: FileSystemFolderItem?
     var handle: Any?
@@ -241,9 +430,16 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
     }
 
     var name: String? { return resourceValues()?.name }
-    var size: UInt { return UInt(resourceValues()?.fileSize ?? 0) }
+    var size: UInt { return knownSize ?? UInt(resourceValues()?.fileSize ?? 0) }
     var isProtected: Bool { return resourceValues()?.isWritable ?? true }
     var dateCreated: Date?
+    private var knownSize: UInt? = nil
+
+    /// Updates the receiver's size and date from a newer listing of the same file.
+    internal func refresh(from listedFile: SimulatedCameraFile) {
+        knownSize = listedFile.knownSize
+        dateCreated = listedFile.dateCreated
+    }
 
     let childrenLoading: Bool = false
     let childrenLoaded: Bool = false
@@ -294,8 +490,7 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
         }
 
         if result {
-            DispatchQueue.global(qos: .userInitiated).asyncAfter(deadline: .now() + configuration.connectionSpeed.mediumOperationDuration) {
-                let thumbnail = self.loadThumbnailFromImageAtURL(self.url, maxSize: 300.0)
+            loadImage(.thumbnail, maxSize: 300.0) { thumbnail in
                 deliveryQueue.async {
                     delivery(self, thumbnail == nil ? NSError(cblErrorCode: .noThumbnail) : nil, thumbnail)
                 }
@@ -312,7 +507,6 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
     }
 
     func fetchEXIFMetadata(preflightBlock preflight: @escaping EXIFPreflight, metadataDeliveryBlock delivery: @escaping EXIFDelivery, deliveryQueue: DispatchQueue) {
-        let fileExtension = url.pathExtension
         let result = preflight(self)
 
         guard let storage, let camera = storage.camera else {
@@ -327,34 +521,10 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
 
         if result {
             DispatchQueue.global(qos: .userInitiated).asyncAfter(deadline: .now() + configuration.connectionSpeed.mediumOperationDuration) {
-                #if !canImport(CoreGraphics)
-                deliveryQueue.async {
-                    // We don't have Core Graphics on Windows. TODO: Find an alternative.
-                    delivery(self, NSError(cblErrorCode: .notAvailable), nil)
-                }
-                #else
-                var metadata: [String: Any]? = nil
-                if let data = try? Data(contentsOf: self.url) {
-                    if fileExtension.caseInsensitiveCompare("jpg") == .orderedSame || fileExtension.caseInsensitiveCompare("jpeg") == .orderedSame {
-                        // This should be using RAWImageDescription, but we don't have it here.
-                        if let source = CGImageSourceCreateWithData(data as CFData, nil),
-                           let properties = CGImageSourceCopyPropertiesAtIndex(source, 0, nil) as? [String: Any] {
-                            metadata = properties
-                        }
-
-                    } else if fileExtension.caseInsensitiveCompare("cr3") == .orderedSame {
-                        // This should be using ImageMetadataHelperCR3, but we don't have it here.
-                        //metadata = ImageMetadataHelperCR3.metadata(inCR3Data: data) as? [String: Any]
-
-                    } else {
-                        // Probably another RAW.
-                        // This should be using RAWImageDescription, but we don't have it here.
-                    }
-                }
+                let metadata = self.loadMetadataFromImageAtURL(self.url)
                 deliveryQueue.async {
                     delivery(self, metadata == nil ? NSError(cblErrorCode: .noMetadata) : nil, metadata)
                 }
-                #endif
             }
         } else {
             deliveryQueue.async {
@@ -381,10 +551,9 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
         }
 
         if result {
-            DispatchQueue.global(qos: .userInitiated).asyncAfter(deadline: .now() + configuration.connectionSpeed.mediumOperationDuration) {
-                let thumbnail = self.loadThumbnailFromImageAtURL(self.url, maxSize: 1200.0)
+            loadImage(.preview, maxSize: 1200.0) { preview in
                 deliveryQueue.async {
-                    delivery(self, thumbnail == nil ? NSError(cblErrorCode: .noThumbnail) : nil, thumbnail)
+                    delivery(self, preview == nil ? NSError(cblErrorCode: .noThumbnail) : nil, preview)
                 }
             }
         } else {
@@ -399,6 +568,10 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
     }
 
     func streamItem(preflightBlock preflight: @escaping FileStreamPreflight, preflightQueue: DispatchQueue, chunkDeliveryBlock chunkDelivery: @escaping FileStreamChunkDelivery, deliveryQueue: DispatchQueue, complete: @escaping FileStreamCompletion, complete completeQueue: DispatchQueue) -> Progress {
+        return streamItem(fromOffset: 0, length: nil, preflightBlock: { item, _, _ in preflight(item) }, preflightQueue: preflightQueue, chunkDeliveryBlock: chunkDelivery, deliveryQueue: deliveryQueue, complete: complete, complete: completeQueue)
+    }
+
+    func streamItem(fromOffset offset: UInt64, length: UInt64?, preflightBlock preflight: @escaping FileStreamRangePreflight, preflightQueue: DispatchQueue, chunkDeliveryBlock chunkDelivery: @escaping FileStreamChunkDelivery, deliveryQueue: DispatchQueue, complete: @escaping FileStreamCompletion, complete completeQueue: DispatchQueue) -> Progress {
 
         let progress = Progress(totalUnitCount: 0)
         progress.isCancellable = false
@@ -407,32 +580,36 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
         let configuration = self.configuration
 
         preflightQueue.async {
-            let context = preflight(self)
-
+            // Check the camera can stream before opening anything. The preflight block isn't called if it can't, since
+            // it usually creates somewhere to put the data.
             guard let storage = self.storage, let camera = storage.camera else {
-                completeQueue.async { complete(self, NSError(cblErrorCode: .notConnected), context) }
+                completeQueue.async { complete(self, NSError(cblErrorCode: .notConnected), nil) }
                 return
             }
 
             guard camera.currentCommandCategoriesContains(.filesystemAccess) else {
-                completeQueue.async { complete(self, NSError(cblErrorCode: .incorrectCommandCategory), context) }
+                completeQueue.async { complete(self, NSError(cblErrorCode: .incorrectCommandCategory), nil) }
                 return
             }
 
-            guard let handle = try? FileHandle(forReadingFrom: self.url) else {
+            // Open the file before calling the preflight block, so it can be told the file's size and the range being streamed.
+            let reader = SimulatedFileStreamReader(url: self.url, offset: offset, length: length, chunkSize: configuration.fileStreamChunkSize)
+            let range = reader.map({ UInt64($0.range.lowerBound)..<UInt64($0.range.upperBound) }) ?? 0..<0
+            let context = preflight(self, UInt64(reader?.totalFileSize ?? 0), range)
+
+            guard let reader else {
                 completeQueue.async {
                     complete(self, NSError(cblErrorCode: .notAvailable), context)
                 }
                 return
             }
 
-            let length = Int(handle.seekToEndOfFile())
-            handle.seek(toFileOffset: 0)
-            configuration.internalCallbackQueue.async { progress.completedUnitCount = Int64(length) }
+            let rangeLength = reader.range.count
+            configuration.internalCallbackQueue.async { progress.totalUnitCount = Int64(rangeLength) }
 
-            self.recursivelyDeliver(from: handle, of: length, progress: progress, context: context, to: chunkDelivery,
+            self.recursivelyDeliver(from: reader, progress: progress, context: context, to: chunkDelivery,
                                     on: deliveryQueue, then: { error in
-                handle.closeFile()
+                reader.close()
                 completeQueue.asyncAfter(deadline: .now() + self.configuration.connectionSpeed.smallOperationDuration) {
                     complete(self, error, context)
                 }
@@ -442,32 +619,90 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
         return progress
     }
 
-    private func recursivelyDeliver(from fileHandle: FileHandle, of length: Int, progress: Progress, context: Any?, to chunkDelivery: @escaping FileStreamChunkDelivery, on deliveryQueue: DispatchQueue, then completionHandler: @escaping ((Error?) -> ())) {
+    private func recursivelyDeliver(from reader: SimulatedFileStreamReader, progress: Progress, context: Any?, to chunkDelivery: @escaping FileStreamChunkDelivery, on deliveryQueue: DispatchQueue, then completionHandler: @escaping ((Error?) -> ())) {
 
-        let thisChunk = fileHandle.readData(ofLength: 1024 * 1024)
-        let wasLast = fileHandle.offsetInFile >= length
         let configuration = self.configuration
+        // The simulated transfer time starts now, so reading the chunk from disk overlaps with it.
+        let deliveryTime: DispatchTime = .now() + configuration.connectionSpeed.largeOperationDuration
 
-        deliveryQueue.asyncAfter(deadline: .now() + configuration.connectionSpeed.largeOperationDuration) {
-            let result = chunkDelivery(self, thisChunk, context)
-            let bytesRead = thisChunk.count
-            if result == .continue { configuration.internalCallbackQueue.async { progress.totalUnitCount = Int64(bytesRead) } }
-            if wasLast {
-                completionHandler(nil)
-            } else if result == .cancel {
-                completionHandler(NSError(cblErrorCode: .cancelledByUser))
-            } else {
-                self.recursivelyDeliver(from: fileHandle, of: length, progress: progress, context: context,
-                                        to: chunkDelivery, on: deliveryQueue, then: completionHandler)
+        reader.readNextChunk { thisChunk, wasLast in
+            guard let thisChunk else {
+                deliveryQueue.async { completionHandler(wasLast ? nil : NSError(cblErrorCode: .notAvailable)) }
+                return
+            }
+
+            deliveryQueue.asyncAfter(deadline: deliveryTime) {
+                let result = chunkDelivery(self, thisChunk, context)
+                let bytesRead = Int64(thisChunk.count)
+                configuration.internalCallbackQueue.async { progress.completedUnitCount += bytesRead }
+                if wasLast {
+                    completionHandler(nil)
+                } else if result == .cancel {
+                    completionHandler(NSError(cblErrorCode: .cancelledByUser))
+                } else {
+                    self.recursivelyDeliver(from: reader, progress: progress, context: context,
+                                            to: chunkDelivery, on: deliveryQueue, then: completionHandler)
+                }
             }
         }
     }
 
     // Helpers
 
+    private var imageCache: SimulatedCameraImageCache? {
+        guard let directory = configuration.imageCacheDirectory else { return nil }
+        return SimulatedCameraImageCache.cache(in: directory, byteBudget: configuration.imageCacheByteBudget)
+    }
+
+    private var imageCacheKey: SimulatedCameraImageCache.Key? {
+        guard let storage = storage as? SimulatedCameraStorage else { return nil }
+        return SimulatedCameraImageCache.Key(storageIdentifier: storage.cacheIdentifier, path: storage.relativePath(for: url),
+                                             size: size, date: dateCreated)
+    }
+
+    /// Loads a thumbnail or preview of the receiver on a background queue, from the image cache if possible. Cache
+    /// hits are delivered without the simulated camera's latency, since they don't involve the camera at all.
+    private func loadImage(_ kind: SimulatedCameraImageCache.ImageKind, maxSize: CGFloat, then completion: @escaping (Data?) -> Void) {
+        let cache = imageCache
+        let cacheKey = imageCacheKey
+
+        DispatchQueue.global(qos: .userInitiated).async {
+            if let cache, let cacheKey, let cached = cache.imageData(kind, for: cacheKey) {
+                completion(cached)
+                return
+            }
+
+            DispatchQueue.global(qos: .userInitiated).asyncAfter(deadline: .now() + self.configuration.connectionSpeed.mediumOperationDuration) {
+                let image = self.loadThumbnailFromImageAtURL(self.url, maxSize: maxSize)
+                if let image, let cache, let cacheKey { cache.store(image, as: kind, for: cacheKey) }
+                completion(image)
+            }
+        }
+    }
+
+    func loadMetadataFromImageAtURL(_ url: URL) -> [String: Any]? {
+        #if canImport(CoreGraphics)
+        // ImageIO reads lazily from the URL too, and its dictionary is much fuller than the parser's (maker notes,
+        // IPTC, and so on), so clients on Apple platforms keep getting everything they used to.
+        if let imageSource = CGImageSourceCreateWithURL(url as CFURL, nil),
+           let properties = CGImageSourceCopyPropertiesAtIndex(imageSource, 0, nil) as? [String: Any], !properties.isEmpty {
+            return properties
+        }
+        #endif
+
+        // Only the image's metadata directories are read, rather than the whole file.
+        return EXIFMetadataParser.metadata(forImageAt: url)
+    }
+
     func loadThumbnailFromImageAtURL(_ url: URL, maxSize: CGFloat) -> Data? {
-        // We don't have Core Graphics on Windows. TODO: Find an alternative.
-        #if !os(Windows)
+        // Cameras embed small thumbnails in the images they write, and pulling one out only needs a few KB of I/O
+        // rather than decoding the whole image. It's small, though, so larger requests prefer a proper render.
+        let wantsThumbnail = maxSize <= EmbeddedImageExtractor.thumbnailMaxSize
+        if wantsThumbnail, let embedded = EmbeddedImageExtractor.embeddedJPEG(.thumbnail, inImageAt: url) {
+            return embedded
+        }
+
+        #if canImport(CoreGraphics)
         let options: [NSObject : Any] = [
             kCGImageSourceCreateThumbnailWithTransform: true,
             kCGImageSourceCreateThumbnailFromImageAlways: true,
@@ -481,8 +716,8 @@ class SimulatedCameraFile: NSObject, FileSystemItem {
         }
         #endif
 
-        // We should really try to manually extract the thumbnail.
-        return nil
+        // Without Core Graphics (or if it couldn't decode the image), fall back to whatever the camera embedded.
+        return EmbeddedImageExtractor.embeddedJPEG(.preview, inImageAt: url)
     }
 }
 
@@ -0,0 +1,314 @@
+//
+//  SimulatedCamera+ImageCache.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+
+/// A persistent on-disk cache of the thumbnails and previews fetched from camera storage.
+///
+/// Images are addressed by a digest of the item's identity — the storage it's on, its path, its size and its date —
+/// so an image that changes on the card gets a new address rather than a stale hit. The full key is stored with each
+/// image and checked on lookup, so a digest collision is a miss rather than the wrong image. Image data is kept in a
+/// single append-only pack file alongside a small record header per image, which keeps thousands of thumbnails from
+/// turning into thousands of tiny files. The in-memory index is rebuilt by scanning the record headers when the cache
+/// is opened.
+///
+/// The cache has a byte budget. When it's exceeded, the least recently used images are evicted by appending
+/// tombstone records. Reads append small records too, so the order of use survives the cache being reopened. Once
+/// enough of the pack file is dead it's compacted by rewriting the live records (oldest first, so recency survives
+/// the rewrite) to a new file.
+final class SimulatedCameraImageCache {
+
+    /// The kinds of image stored in the cache.
+    enum ImageKind: UInt8 {
+        case thumbnail = 1
+        case preview = 2
+    }
+
+    /// Identifies an item's image in the cache.
+    struct Key: Hashable {
+        /// A stable identifier for the storage the item is on.
+        let storageIdentifier: String
+        /// The item's path within its storage.
+        let path: String
+        /// The item's size, in bytes.
+        let size: UInt
+        /// The item's date.
+        let date: Date?
+
+        /// The key's full identity, which is stored alongside its images.
+        var identity: String {
+            let dateComponent = date.map({ String(Int64($0.timeIntervalSince1970 * 1000.0)) }) ?? "-"
+            return "\(storageIdentifier)\u{0}\(path)\u{0}\(size)\u{0}\(dateComponent)"
+        }
+
+        /// The key's content address.
+        var digest: UInt64 {
+            return FNV1aHash.hash(identity)
+        }
+    }
+
+    /// Returns the shared cache for the given directory, opening it if needed. All simulated cameras configured with
+    /// the same directory share one cache instance.
+    ///
+    /// @param directory The directory to keep the cache's files in. It will be created if it doesn't exist.
+    /// @param byteBudget The maximum number of bytes of image data to keep.
+    /// @return Returns the cache, or `nil` if it couldn't be opened or is already open with a different byte budget.
+    static func cache(in directory: URL, byteBudget: Int) -> SimulatedCameraImageCache? {
+        registryLock.lock()
+        defer { registryLock.unlock() }
+        let key = directory.standardizedFileURL.path
+        if let existing = openCaches[key] {
+            // One set of files can't be kept to two budgets.
+            return existing.byteBudget == max(0, byteBudget) ? existing : nil
+        }
+        guard let cache = SimulatedCameraImageCache(directory: directory, byteBudget: byteBudget) else { return nil }
+        openCaches[key] = cache
+        return cache
+    }
+
+    /// Opens (or creates) a cache in the given directory.
+    ///
+    /// @param directory The directory to keep the cache's files in. It will be created if it doesn't exist.
+    /// @param byteBudget The maximum number of bytes of image data to keep.
+    init?(directory: URL, byteBudget: Int) {
+        do {
+            try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true, attributes: nil)
+        } catch {
+            return nil
+        }
+
+        self.byteBudget = max(0, byteBudget)
+        packURL = directory.appendingPathComponent("Images.pack")
+        guard let handle = SimulatedCameraImageCache.openPack(at: packURL) else { return nil }
+        fileHandle = handle
+        loadIndex()
+    }
+
+    deinit {
+        fileHandle.closeFile()
+    }
+
+    /// Returns the cached image of the given kind for the given key, or `nil` if it isn't cached.
+    func imageData(_ kind: ImageKind, for key: Key) -> Data? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let entryKey = EntryKey(digest: key.digest, kind: kind.rawValue)
+        guard let entry = entries[entryKey] else { return nil }
+        fileHandle.seek(toFileOffset: entry.offset)
+        let record = fileHandle.readData(ofLength: entry.keyLength + entry.length)
+        guard record.count == entry.keyLength + entry.length,
+              record.prefix(entry.keyLength) == Data(key.identity.utf8) else { return nil }
+
+        recordUse(of: entryKey)
+        return Data(record.dropFirst(entry.keyLength))
+    }
+
+    /// Stores an image of the given kind for the given key, replacing any existing image.
+    func store(_ data: Data, as kind: ImageKind, for key: Key) {
+        let identity = Data(key.identity.utf8)
+        guard !data.isEmpty, data.count <= byteBudget, data.count <= Int(UInt32.max), identity.count <= Int(UInt16.max) else { return }
+        lock.lock()
+        defer { lock.unlock() }
+
+        let entryKey = EntryKey(digest: key.digest, kind: kind.rawValue)
+        if let existing = entries.removeValue(forKey: entryKey) {
+            liveBytes -= existing.length
+            deadBytes += existing.recordSize
+        }
+
+        guard let offset = append(entryKey, identity: identity, data: data) else { return }
+        accessCounter += 1
+        entries[entryKey] = Entry(offset: offset, keyLength: identity.count, length: data.count, lastUse: accessCounter)
+        liveBytes += data.count
+
+        evictIfNeeded()
+    }
+
+    // MARK: - Internal
+
+    private struct EntryKey: Hashable {
+        let digest: UInt64
+        let kind: UInt8
+    }
+
+    private struct Entry {
+        let offset: UInt64 // Offset of the record's key (not its header) in the pack file. The image data follows it.
+        let keyLength: Int
+        let length: Int
+        var lastUse: UInt64
+
+        var recordSize: Int { return SimulatedCameraImageCache.recordHeaderSize + keyLength + length }
+    }
+
+    // Pack file layout: an 8-byte file header, then records of
+    // [kind: UInt8][digest: UInt64][key length: UInt16][data length: UInt32][key][data], all little-endian. The key is
+    // the UTF-8 identity of the image's cache key. Tombstone (kind 0) and use (kind 0xFF) records have no key, and one
+    // byte of data: the kind of image they refer to.
+    private static let fileHeader = Data("CBLPACK2".utf8)
+    private static let recordHeaderSize: Int = 15
+    private static let tombstoneKind: UInt8 = 0
+    private static let useKind: UInt8 = 0xFF
+
+    private static let registryLock = NSLock()
+    private static var openCaches: [String: SimulatedCameraImageCache] = [:]
+
+    private let lock = NSLock()
+    private let packURL: URL
+    private let byteBudget: Int
+    private var fileHandle: FileHandle
+    private var entries: [EntryKey: Entry] = [:]
+    private var accessCounter: UInt64 = 0
+    private var liveBytes: Int = 0
+    private var deadBytes: Int = 0
+
+    private static func openPack(at url: URL) -> FileHandle? {
+        if !FileManager.default.fileExists(atPath: url.path) {
+            guard FileManager.default.createFile(atPath: url.path, contents: fileHeader, attributes: nil) else { return nil }
+        }
+        guard let handle = try? FileHandle(forUpdating: url) else { return nil }
+        if handle.readData(ofLength: fileHeader.count) != fileHeader {
+            // Not a pack file we understand — start over.
+            handle.truncateFile(atOffset: 0)
+            handle.write(fileHeader)
+        }
+        return handle
+    }
+
+    // Must be called with the lock held (or from init).
+    private func loadIndex() {
+        let fileLength = fileHandle.seekToEndOfFile()
+        var offset = UInt64(SimulatedCameraImageCache.fileHeader.count)
+
+        while offset + UInt64(SimulatedCameraImageCache.recordHeaderSize) <= fileLength {
+            fileHandle.seek(toFileOffset: offset)
+            let header = [UInt8](fileHandle.readData(ofLength: SimulatedCameraImageCache.recordHeaderSize))
+            guard header.count == SimulatedCameraImageCache.recordHeaderSize else { break }
+
+            let kind = header[0]
+            let digest = (1...8).reversed().reduce(UInt64(0), { ($0 << 8) | UInt64(header[$1]) })
+            let keyLength = (9...10).reversed().reduce(Int(0), { ($0 << 8) | Int(header[$1]) })
+            let length = (11...14).reversed().reduce(Int(0), { ($0 << 8) | Int(header[$1]) })
+            let keyOffset = offset + UInt64(SimulatedCameraImageCache.recordHeaderSize)
+            let dataOffset = keyOffset + UInt64(keyLength)
+            guard dataOffset + UInt64(length) <= fileLength else { break } // A partially-written record.
+
+            if kind == SimulatedCameraImageCache.tombstoneKind || kind == SimulatedCameraImageCache.useKind {
+                fileHandle.seek(toFileOffset: dataOffset)
+                let entryKey = fileHandle.readData(ofLength: 1).first.map({ EntryKey(digest: digest, kind: $0) })
+                if kind == SimulatedCameraImageCache.useKind, let entryKey, var used = entries[entryKey] {
+                    // Records further into the file happened more recently.
+                    accessCounter += 1
+                    used.lastUse = accessCounter
+                    entries[entryKey] = used
+                } else if kind == SimulatedCameraImageCache.tombstoneKind, let entryKey,
+                          let removed = entries.removeValue(forKey: entryKey) {
+                    liveBytes -= removed.length
+                    deadBytes += removed.recordSize
+                }
+                deadBytes += SimulatedCameraImageCache.recordHeaderSize + keyLength + length
+            } else {
+                let entryKey = EntryKey(digest: digest, kind: kind)
+                if let replaced = entries[entryKey] {
+                    liveBytes -= replaced.length
+                    deadBytes += replaced.recordSize
+                }
+                // Records further into the file were written more recently.
+                accessCounter += 1
+                entries[entryKey] = Entry(offset: keyOffset, keyLength: keyLength, length: length, lastUse: accessCounter)
+                liveBytes += length
+            }
+
+            offset = dataOffset + UInt64(length)
+        }
+
+        // Drop anything after the last complete record, so new records are appended to a well-formed file.
+        fileHandle.truncateFile(atOffset: offset)
+        evictIfNeeded()
+    }
+
+    // Must be called with the lock held. Returns the offset of the record's key.
+    private func append(_ key: EntryKey, identity: Data = Data(), data: Data) -> UInt64? {
+        let recordOffset = fileHandle.seekToEndOfFile()
+        var header = Data(capacity: SimulatedCameraImageCache.recordHeaderSize + identity.count)
+        header.append(key.kind)
+        for shift in stride(from: 0, to: 64, by: 8) { header.append(UInt8(truncatingIfNeeded: key.digest >> UInt64(shift))) }
+        for shift in stride(from: 0, to: 16, by: 8) { header.append(UInt8(truncatingIfNeeded: identity.count >> shift)) }
+        for shift in stride(from: 0, to: 32, by: 8) { header.append(UInt8(truncatingIfNeeded: data.count >> shift)) }
+        header.append(identity)
+        fileHandle.write(header)
+        fileHandle.write(data)
+        return recordOffset + UInt64(SimulatedCameraImageCache.recordHeaderSize)
+    }
+
+    // Must be called with the lock held.
+    private func recordUse(of key: EntryKey) {
+        // Nothing to record if it's already the most recently used.
+        guard var entry = entries[key], entry.lastUse != accessCounter else { return }
+        _ = append(EntryKey(digest: key.digest, kind: SimulatedCameraImageCache.useKind), data: Data([key.kind]))
+        deadBytes += SimulatedCameraImageCache.recordHeaderSize + 1
+        accessCounter += 1
+        entry.lastUse = accessCounter
+        entries[key] = entry
+        evictIfNeeded()
+    }
+
+    // Must be called with the lock held.
+    private func evictIfNeeded() {
+        if liveBytes > byteBudget {
+            // Evict down to 90% of the budget, so we're not evicting on every store once the cache is full.
+            let target = byteBudget - (byteBudget / 10)
+            let leastRecentlyUsed = entries.sorted(by: { $0.value.lastUse < $1.value.lastUse })
+            for (key, entry) in leastRecentlyUsed {
+                guard liveBytes > target else { break }
+                entries.removeValue(forKey: key)
+                liveBytes -= entry.length
+                deadBytes += entry.recordSize
+                _ = append(EntryKey(digest: key.digest, kind: SimulatedCameraImageCache.tombstoneKind), data: Data([key.kind]))
+                deadBytes += SimulatedCameraImageCache.recordHeaderSize + 1
+            }
+        }
+
+        if deadBytes > max(liveBytes, byteBudget / 4) { compact() }
+    }
+
+    // Must be called with the lock held.
+    private func compact() {
+        let compactingURL = packURL.appendingPathExtension("compacting")
+        try? FileManager.default.removeItem(at: compactingURL)
+        guard FileManager.default.createFile(atPath: compactingURL.path, contents: SimulatedCameraImageCache.fileHeader, attributes: nil),
+              let newHandle = try? FileHandle(forUpdating: compactingURL) else { return }
+
+        let oldHandle = fileHandle
+        fileHandle = newHandle
+        newHandle.seekToEndOfFile()
+
+        var newEntries: [EntryKey: Entry] = [:]
+        for (key, entry) in entries.sorted(by: { $0.value.lastUse < $1.value.lastUse }) {
+            oldHandle.seek(toFileOffset: entry.offset)
+            let record = oldHandle.readData(ofLength: entry.keyLength + entry.length)
+            guard record.count == entry.keyLength + entry.length,
+                  let offset = append(key, identity: Data(record.prefix(entry.keyLength)), data: Data(record.dropFirst(entry.keyLength))) else { continue }
+            newEntries[key] = Entry(offset: offset, keyLength: entry.keyLength, length: entry.length, lastUse: entry.lastUse)
+        }
+        oldHandle.closeFile()
+        newHandle.closeFile()
+
+        // If the swap fails, the old pack is still intact at the pack URL, so carry on with it as it was.
+        guard (try? FileManager.default.replaceItemAt(packURL, withItemAt: compactingURL)) != nil,
+              let handle = try? FileHandle(forUpdating: packURL) else {
+            try? FileManager.default.removeItem(at: compactingURL)
+            if let handle = try? FileHandle(forUpdating: packURL) { fileHandle = handle }
+            return
+        }
+
+        fileHandle = handle
+        entries = newEntries
+        liveBytes = newEntries.values.reduce(0, { $0 + $1.length })
+        deadBytes = 0
+    }
+}
@@ -15,6 +15,40 @@ struct PropertyValuesWithSuggestedDefault {
     let validValues: [SimulatedPropertyValue]?
 }
 
+/// Memoises the values of properties that depend on another property's value (for instance, the valid apertures
+/// in each auto exposure mode) so they're only created once per source value.
+///
+/// Lists that turn out to be equal to a list already in the cache share that list's value objects, so switching
+/// between source values with the same dependent values hands properties the objects they already have.
+struct DependentPropertyValueCache {
+
+    mutating func values(for property: PropertyIdentifier, sourceValue: PropertyCommonValue,
+                         create: () throws -> PropertyValuesWithSuggestedDefault?) rethrows -> PropertyValuesWithSuggestedDefault? {
+        if let cached = storage[property]?[sourceValue] { return cached }
+        guard let created = try create() else { return nil }
+        let values = deduplicated(created, against: storage[property]?.values.map({ $0 }) ?? [])
+        storage[property, default: [:]][sourceValue] = values
+        return values
+    }
+
+    private var storage: [PropertyIdentifier: [PropertyCommonValue: PropertyValuesWithSuggestedDefault]] = [:]
+
+    private func deduplicated(_ values: PropertyValuesWithSuggestedDefault,
+                              against existing: [PropertyValuesWithSuggestedDefault]) -> PropertyValuesWithSuggestedDefault {
+        guard let validValues = values.validValues else { return values }
+        for candidate in existing {
+            guard let candidateValues = candidate.validValues, candidateValues.count == validValues.count,
+                  !zip(candidateValues, validValues).contains(where: { !$0.isEqual($1) }) else { continue }
+            let defaultValue = candidateValues.first(where: { value in
+                guard let newDefault = values.defaultValue else { return false }
+                return value.isEqual(newDefault)
+            }) ?? values.defaultValue
+            return PropertyValuesWithSuggestedDefault(defaultValue: defaultValue, validValues: candidateValues)
+        }
+        return values
+    }
+}
+
 extension SimulatedCamera {
 
     func createFocusModeValues() -> PropertyValuesWithSuggestedDefault {
@@ -173,6 +207,25 @@ extension SimulatedCamera {
         }
     }
 
+    // MARK: - Dependent Properties
+
+    /// Properties whose valid values depend on the current value of another property, keyed by the property
+    /// they depend on. When the source property's value changes, only the properties listed here are recomputed.
+    static let propertyDependencies: [PropertyIdentifier: [PropertyIdentifier]] = [
+        .autoExposureMode: [.exposureCompensation, .aperture, .shutterSpeed]
+    ]
+
+    /// Creates the values for a property that depends on the auto exposure mode, or `nil` if the given property
+    /// doesn't depend on it.
+    func createValues(for property: PropertyIdentifier, in aeMode: PropertyCommonValueAutoExposureMode) throws -> PropertyValuesWithSuggestedDefault? {
+        switch property {
+        case .exposureCompensation: return createExposureCompensationValues(for: aeMode)
+        case .aperture: return try createApertureValues(for: aeMode)
+        case .shutterSpeed: return try createShutterSpeedValues(for: aeMode)
+        default: return nil
+        }
+    }
+
     // MARK: - Property Identifiers
 
     private func localizedUniversalProperty(key: String) -> String {
@@ -0,0 +1,205 @@
+//
+//  SimulatedCamera+StorageSnapshot.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+import CascableCore
+
+/// A compact, serialisable snapshot of a storage device's cataloged file tree.
+///
+/// A snapshot is written when the camera disconnects and restored when it next connects, which makes the storage
+/// browseable immediately rather than after a full catalog. Each directory records its modification date at the time
+/// it was listed, and each file its size and modification date, so the catalog that runs after a restore only needs to
+/// re-list directories whose contents have since changed — including files that were rewritten in place, which doesn't
+/// change their directory's modification date.
+struct SimulatedStorageSnapshot: Codable {
+
+    /// A snapshot of one directory's immediate children.
+    struct Directory: Codable {
+        /// The directory's modification date when it was listed.
+        let modificationDate: Date?
+        /// The directory's children.
+        let entries: [Entry]
+
+        enum CodingKeys: String, CodingKey {
+            case modificationDate = "m"
+            case entries = "e"
+        }
+    }
+
+    /// A snapshot of one file or folder.
+    struct Entry: Codable {
+        let name: String
+        let size: UInt64
+        let date: Date?
+        /// The file's content modification date when the snapshot was taken. Always `nil` for folders.
+        let modificationDate: Date?
+        let isFolder: Bool
+
+        enum CodingKeys: String, CodingKey {
+            case name = "n"
+            case size = "s"
+            case date = "d"
+            case modificationDate = "c"
+            case isFolder = "f"
+        }
+    }
+
+    static let currentVersion: Int = 2
+
+    let version: Int
+
+    /// The local path of the storage's root directory.
+    let rootPath: String
+
+    /// Snapshots of each cataloged directory, keyed by their path relative to the storage's root (`""` for the root,
+    /// `"/DCIM"` for a folder directly inside it). See `SimulatedCameraStorage.relativePath(for:)`.
+    let directories: [String: Directory]
+
+    // MARK: - Persistence
+
+    /// Returns the file URL for the snapshot of the storage with the given identifier.
+    static func url(forStorageIdentifier identifier: String, in directory: URL) -> URL {
+        // Hashed, to get a filesystem-safe name from an identifier containing a path.
+        return directory.appendingPathComponent(FNV1aHash.hexString(identifier)).appendingPathExtension("fsindex")
+    }
+
+    /// Loads a snapshot from the given file, or returns `nil` if it doesn't exist or can't be read.
+    static func load(from url: URL) -> SimulatedStorageSnapshot? {
+        guard let data = try? Data(contentsOf: url),
+              let snapshot = try? PropertyListDecoder().decode(SimulatedStorageSnapshot.self, from: data),
+              snapshot.version == currentVersion else { return nil }
+        return snapshot
+    }
+
+    /// Writes the snapshot to the given file, creating its directory if needed.
+    func write(to url: URL) throws {
+        try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true, attributes: nil)
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .binary
+        try encoder.encode(self).write(to: url, options: .atomic)
+    }
+
+    /// Returns a directory's current modification date, for comparison against a snapshot.
+    static func modificationDate(ofDirectoryAt url: URL) -> Date? {
+        return (try? url.resourceValues(forKeys: [.contentModificationDateKey]))?.contentModificationDate
+    }
+
+    /// Returns a file's current size and content modification date, for comparison against a snapshot.
+    static func sizeAndModificationDate(ofFileAt url: URL) -> (size: UInt64, modificationDate: Date?)? {
+        guard let values = try? url.resourceValues(forKeys: [.fileSizeKey, .contentModificationDateKey]) else { return nil }
+        return (UInt64(values.fileSize ?? 0), values.contentModificationDate)
+    }
+
+    /// Returns `true` if every file in the given directory snapshot still has the size and modification date it was
+    /// snapshotted with. Rewriting a file in place doesn't change its directory's modification date, so this catches
+    /// changes that comparing directory dates alone misses.
+    ///
+    /// This stats each file, so shouldn't be called on a queue that other work is waiting on.
+    static func filesAreUnchanged(in directory: Directory, at directoryUrl: URL) -> Bool {
+        return directory.entries.allSatisfy({ entry in
+            guard !entry.isFolder else { return true }
+            guard let current = sizeAndModificationDate(ofFileAt: directoryUrl.appendingPathComponent(entry.name, isDirectory: false)),
+                  let snapshottedDate = entry.modificationDate else { return false }
+            return current.size == entry.size && current.modificationDate == snapshottedDate
+        })
+    }
+}
+
+extension SimulatedCameraStorage {
+
+    /// Returns the given URL's path relative to the storage's root directory: `""` for the root itself, and a path
+    /// with a leading slash (such as `"/DCIM/100CANON"`) for anything inside it. URLs outside the root are returned as
+    /// their full path.
+    func relativePath(for url: URL) -> String {
+        // Comparing components rather than string prefixes works for a root of "/", and keeps "/Card 10" from being
+        // treated as being inside "/Card 1".
+        let rootComponents = rootUrl.standardizedFileURL.pathComponents
+        let components = url.standardizedFileURL.pathComponents
+        guard components.count >= rootComponents.count,
+              Array(components.prefix(rootComponents.count)) == rootComponents else { return url.standardizedFileURL.path }
+        let relativeComponents = components.dropFirst(rootComponents.count)
+        return relativeComponents.isEmpty ? "" : "/" + relativeComponents.joined(separator: "/")
+    }
+
+    private var snapshotURL: URL? {
+        guard let directory = configuration.storageIndexDirectory else { return nil }
+        return SimulatedStorageSnapshot.url(forStorageIdentifier: cacheIdentifier, in: directory)
+    }
+
+    /// Loads the storage's snapshot from disk, if there is one, and populates the storage's folders from it.
+    ///
+    /// Must be called on the configuration's internal callback queue, before cataloging starts.
+    ///
+    /// @return Returns the restored snapshot, or `nil` if there wasn't one.
+    func restoreSnapshot() -> SimulatedStorageSnapshot? {
+        guard let snapshotURL, let snapshot = SimulatedStorageSnapshot.load(from: snapshotURL),
+              snapshot.rootPath == rootUrl.standardizedFileURL.path,
+              let root = rootDirectory as? SimulatedCameraFolder else { return nil }
+
+        var pending: [(folder: SimulatedCameraFolder, path: String)] = [(root, "")]
+        while let (folder, path) = pending.popLast() {
+            guard let directory = snapshot.directories[path] else { continue }
+            let children: [FileSystemItem] = directory.entries.map({ entry in
+                let childUrl = folder.url.appendingPathComponent(entry.name, isDirectory: entry.isFolder)
+                if entry.isFolder {
+                    let childFolder = SimulatedCameraFolder(url: childUrl, parent: folder, on: self)
+                    pending.append((childFolder, path + "/" + entry.name))
+                    return childFolder
+                } else {
+                    return SimulatedCameraFile(url: childUrl, parent: folder, on: self, size: UInt(entry.size), dateCreated: entry.date)
+                }
+            })
+            folder.catalogDidListChildren(children, modificationDate: directory.modificationDate)
+        }
+
+        return snapshot
+    }
+
+    /// Captures the storage's cataloged file tree and writes it to disk in the background.
+    ///
+    /// Must be called on the configuration's internal callback queue.
+    func writeSnapshot() {
+        guard let snapshotURL, let root = rootDirectory as? SimulatedCameraFolder else { return }
+
+        // Only the tree's shape is captured here. Building entries (which may need to stat files) happens off-queue.
+        var listedFolders: [(path: String, modificationDate: Date?, children: [FileSystemItem])] = []
+        var pending: [(folder: SimulatedCameraFolder, path: String)] = [(root, "")]
+        while let (folder, path) = pending.popLast() {
+            guard folder.childrenLoaded, let children = folder.children else { continue }
+            listedFolders.append((path, folder.listedModificationDate, children))
+            for case let childFolder as SimulatedCameraFolder in children {
+                pending.append((childFolder, path + "/" + childFolder.url.lastPathComponent))
+            }
+        }
+
+        let rootPath = rootUrl.standardizedFileURL.path
+        DispatchQueue.global(qos: .utility).async {
+            var directories: [String: SimulatedStorageSnapshot.Directory] = [:]
+            for (path, modificationDate, children) in listedFolders {
+                let entries: [SimulatedStorageSnapshot.Entry] = children.compactMap({ child in
+                    if let childFolder = child as? SimulatedCameraFolder {
+                        return SimulatedStorageSnapshot.Entry(name: childFolder.url.lastPathComponent, size: 0, date: nil,
+                                                              modificationDate: nil, isFolder: true)
+                    } else if let file = child as? SimulatedCameraFile {
+                        // Recorded from disk rather than the file's cached size, so the snapshot describes the file as
+                        // it is now. Files that have gone away are left out, and will be noticed on the next catalog.
+                        guard let current = SimulatedStorageSnapshot.sizeAndModificationDate(ofFileAt: file.url) else { return nil }
+                        return SimulatedStorageSnapshot.Entry(name: file.url.lastPathComponent, size: current.size,
+                                                              date: file.dateCreated, modificationDate: current.modificationDate,
+                                                              isFolder: false)
+                    }
+                    return nil
+                })
+                directories[path] = SimulatedStorageSnapshot.Directory(modificationDate: modificationDate, entries: entries)
+            }
+
+            let snapshot = SimulatedStorageSnapshot(version: SimulatedStorageSnapshot.currentVersion, rootPath: rootPath,
+                                                    directories: directories)
+            try? snapshot.write(to: snapshotURL)
+        }
+    }
+}
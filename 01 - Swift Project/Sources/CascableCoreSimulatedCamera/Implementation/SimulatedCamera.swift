@@ -237,24 +237,29 @@ class SimulatedLiveViewFrame: NSObject, NSCopying, LiveViewFrame {
 
 class SimulatedCameraInitiatedTransfer: NSObject, CameraInitiatedTransferRequest {
 
-    init(transferring data: Data, configuration: SimulatedCameraConfiguration) {
+    init(transferringFileAt fileUrl: URL, originalFileAt originalFileUrl: URL? = nil, fileNameHint: String? = nil,
+         configuration: SimulatedCameraConfiguration) {
         transferProgress = Progress(totalUnitCount: 0)
         transferProgress.completedUnitCount = 0
         transferProgress.isCancellable = false
         transferProgress.isPausable = false
         self.connectionSpeed = configuration.connectionSpeed
         self.callbackQueue = configuration.internalCallbackQueue
-        self.dataToTransfer = data
+        self.fileToTransfer = fileUrl
+        self.originalFileToTransfer = originalFileUrl
+        self.fileNameHint = fileNameHint
+        self.availableRepresentations = (originalFileUrl == nil ? [.preview] : [.preview, .original])
     }
 
-    let dataToTransfer: Data
+    let fileToTransfer: URL
+    let originalFileToTransfer: URL?
     let connectionSpeed: SimulatedConnectionSpeed
     let callbackQueue: DispatchQueue
     let isValid: Bool = true
-    let fileNameHint: String? = nil
+    let fileNameHint: String?
     let isOnlyDestinationForImage: Bool = true
     let executionRequiredToClearBuffer: Bool = false
-    let availableRepresentations: CameraInitiatedTransferRepresentation = [.preview]
+    let availableRepresentations: CameraInitiatedTransferRepresentation
 
     func canProvide(_ representation: CameraInitiatedTransferRepresentation) -> Bool {
         return availableRepresentations.contains(representation)
@@ -272,38 +277,57 @@ class SimulatedCameraInitiatedTransfer: NSObject, CameraInitiatedTransferRequest
                          completionQueue: DispatchQueue,
                          completionHandler: @escaping CameraInitiatedTransferCompletionHandler) {
 
+        let representations = representations.intersection(availableRepresentations)
+        guard !representations.isEmpty else {
+            completionQueue.async { completionHandler(nil, NSError(cblErrorCode: .invalidInput)) }
+            return
+        }
+
         transferState = .inProgress
 
         completionQueue.asyncAfter(deadline: DispatchTime.now() + connectionSpeed.largeOperationDuration) {
             self.transferState = .complete
-            completionHandler(SimulatedCameraInitiatedTransferResult(jpegData: self.dataToTransfer), nil)
+            let result = SimulatedCameraInitiatedTransferResult(jpegFileUrl: self.fileToTransfer,
+                                                                originalFileUrl: representations.contains(.original) ? self.originalFileToTransfer : nil,
+                                                                includesPreview: representations.contains(.preview),
+                                                                fileNameHint: self.fileNameHint)
+            completionHandler(result, nil)
         }
     }
 }
 
 class SimulatedCameraInitiatedTransferResult: NSObject, CameraInitiatedTransferResult {
 
-    let jpegData: Data
+    // The result is backed by the source image files rather than in-memory copies, so writing it to disk is a file
+    // copy and data is only loaded if a client explicitly asks for it.
+    let jpegFileUrl: URL
+    let originalFileUrl: URL?
 
-    init(jpegData: Data) {
-        self.jpegData = jpegData
+    init(jpegFileUrl: URL, originalFileUrl: URL? = nil, includesPreview: Bool = true, fileNameHint: String? = nil) {
+        self.jpegFileUrl = jpegFileUrl
+        self.originalFileUrl = originalFileUrl
+        self.fileNameHint = fileNameHint
+        var representations: CameraInitiatedTransferRepresentation = []
+        if includesPreview { representations.insert(.preview) }
+        if originalFileUrl != nil { representations.insert(.original) }
+        self.availableRepresentations = representations
     }
 
     let isOnlyDestinationForImage: Bool = false
-    let availableRepresentations: CameraInitiatedTransferRepresentation = .preview
-    let fileNameHint: String? = nil
+    let availableRepresentations: CameraInitiatedTransferRepresentation
+    let fileNameHint: String?
 
     func contains(_ representation: CameraInitiatedTransferRepresentation) -> Bool {
         return availableRepresentations.contains(representation)
     }
 
     func suggestedFileNameExtension(for representation: CameraInitiatedTransferRepresentation) -> String? {
-        guard representation == .preview else { return nil }
+        guard fileUrl(for: representation) != nil else { return nil }
         return "JPG"
     }
 
     func uti(for representation: CameraInitiatedTransferRepresentation) -> String? {
-        guard representation == .preview else { return nil }
+        guard fileUrl(for: representation) != nil else { return nil }
         #if os(Windows)
         return "public.jpeg"
         #else
@@ -318,7 +342,7 @@ class SimulatedCameraInitiatedTransferResult: NSObject, CameraInitiatedTransferR
     func write(_ representation: CameraInitiatedTransferRepresentation,
                to destinationUrl: URL,
                completionHandler: @escaping ErrorableOperationCallback) {
-        guard representation == .preview else {
+        guard let sourceUrl = fileUrl(for: representation) else {
             completionHandler(NSError(cblErrorCode: .invalidInput))
             return
         }
@@ -326,7 +350,10 @@ class SimulatedCameraInitiatedTransferResult: NSObject, CameraInitiatedTransferR
         do {
             try FileManager.default.createDirectory(at: destinationUrl.deletingLastPathComponent(),
                                                     withIntermediateDirectories: true)
-            try jpegData.write(to: destinationUrl, options: [.atomic])
+            if FileManager.default.fileExists(atPath: destinationUrl.path) {
+                try FileManager.default.removeItem(at: destinationUrl)
+            }
+            try FileManager.default.copyItem(at: sourceUrl, to: destinationUrl)
             completionHandler(nil)
         } catch {
             completionHandler(error)
@@ -334,11 +361,15 @@ class SimulatedCameraInitiatedTransferResult: NSObject, CameraInitiatedTransferR
     }
 
     func generateData(for representation: CameraInitiatedTransferRepresentation, completionHandler: @escaping (Data?, Error?) -> Void) {
-        guard representation == .preview else {
+        guard let sourceUrl = fileUrl(for: representation) else {
             completionHandler(nil, NSError(cblErrorCode: .invalidInput))
             return
         }
-        completionHandler(jpegData, nil)
+        do {
+            completionHandler(try Data(contentsOf: sourceUrl, options: .mappedIfSafe), nil)
+        } catch {
+            completionHandler(nil, error)
+        }
     }
 
     func generatePreviewImage(completionHandler: @escaping (PlatformImageType?, Error?) -> Void) {
@@ -346,9 +377,22 @@ class SimulatedCameraInitiatedTransferResult: NSObject, CameraInitiatedTransferR
             completionHandler(nil, NSError(cblErrorCode: .noThumbnail))
             return
         }
+        guard let jpegData = try? Data(contentsOf: jpegFileUrl, options: .mappedIfSafe) else {
+            completionHandler(nil, NSError(cblErrorCode: .noThumbnail))
+            return
+        }
         let image = PlatformImageType(data: jpegData)
         completionHandler(image, nil)
     }
+
+    private func fileUrl(for representation: CameraInitiatedTransferRepresentation) -> URL? {
+        guard availableRepresentations.contains(representation) else { return nil }
+        switch representation {
+        case .preview: return jpegFileUrl
+        case .original: return originalFileUrl
+        default: return nil
+        }
+    }
 }
 
 protocol SimulatedCameraDelegate: AnyObject {
@@ -367,7 +411,15 @@ class SimulatedCamera: NSObject, Camera {
 
     weak var simulatedCameraDelegate: SimulatedCameraDelegate?
 
-    let friendlyIdentifier: String? = "se.cascable.simulated-camera"
+    // The identifier the simulated camera has always had with the default configuration.
+    private static let defaultFriendlyIdentifier: String = "se.cascable.simulated-camera"
+
+    var friendlyIdentifier: String? {
+        // The default camera keeps its existing identifier so clients that remembered it still recognise it, and
+        // numbered copies of it (see `cameraCount`) get the same numbering on top. Custom identifiers are used as-is.
+        guard configuration.identifier.hasPrefix(SimulatedCameraPluginIdentifier) else { return configuration.identifier }
+        return SimulatedCamera.defaultFriendlyIdentifier + configuration.identifier.dropFirst(SimulatedCameraPluginIdentifier.count)
+    }
 
     dynamic var connected: Bool = false
 
@@ -451,7 +503,7 @@ class SimulatedCamera: NSObject, Camera {
                 self.immediatelySetValue(of: .isoSpeed, to: SimulatedExposurePropertyValue(ISOValue.iso100),
                                          in: ISOs.map({ SimulatedExposurePropertyValue($0) }))
 
-                self.handleChangeOfAutoExposureMode()
+                self.handleChangeOfAutoExposureMode(force: true)
 
                 // We need to observe the AE mode to adjust available exposure settings.
                 self.aeModeObserver = self.property(with: .autoExposureMode).addObserver({ [weak self] _, type in
@@ -469,7 +521,9 @@ class SimulatedCamera: NSObject, Camera {
                 }
 
                 if let url = self.configuration.storageFileSystemRoot {
-                    self.storageDevices = [SimulatedCameraStorage(camera: self, rootFolder: url)]
+                    let storage = SimulatedCameraStorage(camera: self, rootFolder: url)
+                    self.storageDevices = [storage]
+                    storage.beginCataloging()
                     switch self.configuration.fileSystemAccess {
                     case .alongsideRemoteShooting:
                         self.currentCommandCategories = [.stillsShooting, .filesystemAccess]
@@ -480,6 +534,11 @@ class SimulatedCamera: NSObject, Camera {
                     self.currentCommandCategories = .stillsShooting
                 }
 
+                // Get the synthetic original for shots ready ahead of the first one, since it can take a while.
+                if let imageUrl = self.configuration.liveViewImageFrames.first {
+                    SimulatedSyntheticOriginal.prepare(basedOn: imageUrl, byteCount: self.configuration.syntheticOriginalByteCount)
+                }
+
                 self.connectionWarnings = warnings
                 self.connectionState = .connected
                 callback(nil, warnings)
@@ -570,6 +629,16 @@ class SimulatedCamera: NSObject, Camera {
             let time: Double = self.configuration.connectionSpeed.mediumOperationDuration
             queue.asyncAfter(deadline: DispatchTime.now() + time) {
                 self.endSimulatedVideoRecording()
+                self.configuration.internalCallbackQueue.async {
+                    // The burst timer lives on the internal queue, and the disconnect callback queue may not be it.
+                    self.endBurst()
+                    // Remember what's on the storage, so reconnecting doesn't have to catalog it from scratch. Once
+                    // disconnected, the storage stops cataloging and drops its observers.
+                    (self.storageDevices ?? []).compactMap({ $0 as? SimulatedCameraStorage }).forEach({
+                        $0.writeSnapshot()
+                        $0.invalidate()
+                    })
+                }
                 self.connectionState = .notConnected
                 callback?(nil)
                 self.simulatedCameraDelegate?.simulatedCameraDidDisconnect(self)
@@ -842,12 +911,18 @@ class SimulatedCamera: NSObject, Camera {
     }
 
     private var aeModeObserver: CameraPropertyObservation? = nil
+    private var lastAppliedAutoExposureMode: PropertyCommonValueAutoExposureMode? = nil
+    private var dependentPropertyValues = DependentPropertyValueCache()
 
-    private func handleChangeOfAutoExposureMode() {
+    private func handleChangeOfAutoExposureMode(force: Bool = false) {
 
         let exposureMode = PropertyCommonValueAutoExposureMode(rawValue: property(with: .autoExposureMode).currentValue?.commonValue ??
                                                                PropertyCommonValueAutoExposureMode.programAuto.rawValue) ?? .programAuto
 
+        // Dependent properties only depend on the mode itself, so if it hasn't changed there's nothing to recompute.
+        guard force || exposureMode != lastAppliedAutoExposureMode else { return }
+        lastAppliedAutoExposureMode = exposureMode
+
         // If the existing value for a property is valid for the new values, keep it. Otherwise, use the default value.
         func valueToSet(for property: CameraProperty, from newValues: PropertyValuesWithSuggestedDefault) -> SimulatedPropertyValue? {
             guard let exposureProperty = property as? ExposureProperty else { return newValues.defaultValue }
@@ -860,24 +935,16 @@ class SimulatedCamera: NSObject, Camera {
             }
         }
 
-        let evValues = createExposureCompensationValues(for: exposureMode)
-        immediatelySetValue(of: .exposureCompensation,
-                            to: valueToSet(for: property(with: .exposureCompensation), from: evValues),
-                            in: evValues.validValues)
+        // Value lists are memoised per mode, and immediatelySetValue(of:to:in:) only notifies observers of real changes.
+        for identifier in SimulatedCamera.propertyDependencies[.autoExposureMode] ?? [] {
+            guard let newValues = try? dependentPropertyValues.values(for: identifier, sourceValue: exposureMode.rawValue, create: {
+                try createValues(for: identifier, in: exposureMode)
+            }) else { continue }
 
-        do {
-            let apertureValues = try createApertureValues(for: exposureMode)
-            immediatelySetValue(of: .aperture,
-                                to: valueToSet(for: property(with: .aperture), from: apertureValues),
-                                in: apertureValues.validValues)
-        } catch {}
-
-        do {
-            let shutterValues = try createShutterSpeedValues(for: exposureMode)
-            immediatelySetValue(of: .shutterSpeed,
-                                to: valueToSet(for: property(with: .shutterSpeed), from: shutterValues),
-                                in: shutterValues.validValues)
-        } catch {}
+            immediatelySetValue(of: identifier,
+                                to: valueToSet(for: property(with: identifier), from: newValues),
+                                in: newValues.validValues)
+        }
     }
 
     //MARK: - Storage
@@ -976,7 +1043,7 @@ class SimulatedCamera: NSObject, Camera {
             block?(nil)
 
             configuration.internalCallbackQueue.asyncAfter(deadline: DispatchTime.now() + 1.0) {
-                self.triggerShotPreview()
+                self.triggerShot()
             }
         }
     }
@@ -992,7 +1059,7 @@ class SimulatedCamera: NSObject, Camera {
             block?(nil)
 
             configuration.internalCallbackQueue.asyncAfter(deadline: DispatchTime.now() + 1.0) {
-                self.triggerShotPreview()
+                self.triggerShot()
             }
         }
     }
@@ -1073,12 +1140,71 @@ class SimulatedCamera: NSObject, Camera {
         transferHandlers.removeValue(forKey: token)
     }
 
-    func triggerShotPreview() {
-        guard let imageUrl = configuration.liveViewImageFrames.first else { return }
-        guard let imageData = try? Data(contentsOf: imageUrl) else { return }
-        let shotPreviewDelivery = SimulatedCameraInitiatedTransfer(transferring: imageData, configuration: configuration)
-        for (_, handler) in transferHandlers {
-            handler(shotPreviewDelivery)
+    private var burstTimer: DispatchSourceTimer? = nil
+    private var shotCounter: Int = 0
+
+    private static let continuousDriveModes: Set<PropertyCommonValue> = Set([
+        PropertyCommonValueDriveMode.continuous, .continuousElectronicFirstCurtain, .continuousElectronic,
+        .continuousLowSpeed, .continuousMediumSpeed, .continuousHighSpeed
+    ].map({ $0.rawValue }))
+
+    private var isInContinuousDriveMode: Bool {
+        guard let commonValue = property(with: .driveMode).currentValue?.commonValue else { return false }
+        return SimulatedCamera.continuousDriveModes.contains(commonValue)
+    }
+
+    /// Simulates the camera taking a picture — or, in continuous drive modes, a burst of `burstLength` pictures at
+    /// `burstFramesPerSecond` — and delivering each one to the registered camera-initiated transfer handlers.
+    ///
+    /// Must be called on the configuration's internal callback queue.
+    func triggerShot() {
+        endBurst()
+        guard isInContinuousDriveMode, configuration.burstLength > 1, configuration.burstFramesPerSecond > 0.0 else {
+            triggerShotPreview()
+            return
+        }
+
+        var remainingShots = configuration.burstLength
+        let timer: DispatchSourceTimer = DispatchSource.makeTimerSource(flags: [.strict], queue: configuration.internalCallbackQueue)
+        timer.setEventHandler { [weak self] in
+            guard let self else { return }
+            guard self.connectionState == .connected else {
+                self.endBurst()
+                return
+            }
+            self.triggerShotPreview()
+            remainingShots -= 1
+            if remainingShots <= 0 { self.endBurst() }
         }
+
+        timer.schedule(deadline: .now(), repeating: 1.0 / configuration.burstFramesPerSecond)
+        timer.activate()
+        burstTimer = timer
+    }
+
+    // Must be called on the configuration's internal callback queue.
+    private func endBurst() {
+        burstTimer?.cancel()
+        burstTimer = nil
+    }
+
+    /// Must be called on the configuration's internal callback queue.
+    func triggerShotPreview() {
+        guard let imageUrl = configuration.liveViewImageFrames.first,
+              FileManager.default.isReadableFile(atPath: imageUrl.path) else { return }
+        shotCounter = (shotCounter % 9999) + 1
+        let fileNameHint = String(format: "IMG_%04d.JPG", shotCounter)
+
+        // The original is usually ready by now (it's prepared on connection), but if it isn't, it's generated in the
+        // background rather than holding up the internal queue. Shots are still delivered in order.
+        SimulatedSyntheticOriginal.fileUrl(basedOn: imageUrl, byteCount: configuration.syntheticOriginalByteCount,
+                                           completionQueue: configuration.internalCallbackQueue, completionHandler: { [weak self] originalUrl in
+            guard let self, self.connectionState == .connected else { return }
+            let shotPreviewDelivery = SimulatedCameraInitiatedTransfer(transferringFileAt: imageUrl, originalFileAt: originalUrl,
+                                                                       fileNameHint: fileNameHint, configuration: self.configuration)
+            for (_, handler) in self.transferHandlers {
+                handler(shotPreviewDelivery)
+            }
+        })
     }
 }
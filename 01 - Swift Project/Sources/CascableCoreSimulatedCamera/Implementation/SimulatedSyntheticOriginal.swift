@@ -0,0 +1,126 @@
+//
+//  SimulatedSyntheticOriginal.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+
+/// Produces the full-size "original" images delivered alongside previews when the simulated camera takes a shot.
+///
+/// A synthetic original is the shot's preview JPEG padded out to the configured size, so it decodes as the preview
+/// image while costing as much to move around as a real full-size image. The padding is pseudo-random rather than
+/// zeroes, so it doesn't shrink to nothing if a transport or client compresses it.
+///
+/// Each original is generated once into a temporary directory and then shared by every shot that uses it, so a burst
+/// of shots costs file copies rather than repeated generation. Generating a large original takes a while, so the
+/// camera asks for it in the background as soon as it connects, and shots fetch it with the asynchronous
+/// `fileUrl(basedOn:byteCount:completionQueue:completionHandler:)` rather than generating it on the camera's queue.
+enum SimulatedSyntheticOriginal {
+
+    /// Generates the synthetic original based on the given preview image in the background, if it hasn't been already.
+    static func prepare(basedOn previewUrl: URL, byteCount: Int) {
+        guard byteCount > 0 else { return }
+        generationQueue.async { _ = fileUrl(basedOn: previewUrl, byteCount: byteCount) }
+    }
+
+    /// Fetches the URL of a synthetic original based on the given preview image, generating it in the background if
+    /// needed. Requests complete in the order they were made.
+    ///
+    /// @param previewUrl The JPEG image the original is based on.
+    /// @param byteCount The size of the original, in bytes.
+    /// @param completionQueue The queue on which to call the completion handler.
+    /// @param completionHandler Called with the URL of the original, or `nil` if `byteCount` isn't positive or the
+    /// original couldn't be generated.
+    static func fileUrl(basedOn previewUrl: URL, byteCount: Int, completionQueue: DispatchQueue,
+                        completionHandler: @escaping (URL?) -> Void) {
+        generationQueue.async {
+            let url = fileUrl(basedOn: previewUrl, byteCount: byteCount)
+            completionQueue.async { completionHandler(url) }
+        }
+    }
+
+    /// Returns the URL of a synthetic original based on the given preview image, generating it if needed. This blocks
+    /// until generation has finished, which can take a while for large originals.
+    ///
+    /// @param previewUrl The JPEG image the original is based on.
+    /// @param byteCount The size of the original, in bytes.
+    /// @return Returns the URL of the original, or `nil` if `byteCount` isn't positive or the original couldn't be generated.
+    static func fileUrl(basedOn previewUrl: URL, byteCount: Int) -> URL? {
+        guard byteCount > 0 else { return nil }
+        lock.lock()
+        defer { lock.unlock() }
+
+        let url = destinationUrl(basedOn: previewUrl, byteCount: byteCount)
+        if let size = (try? FileManager.default.attributesOfItem(atPath: url.path))?[.size] as? NSNumber,
+           size.intValue == byteCount {
+            return url
+        }
+
+        return generate(basedOn: previewUrl, byteCount: byteCount, at: url) ? url : nil
+    }
+
+    // MARK: - Internal
+
+    private static let lock = NSLock()
+    private static let generationQueue = DispatchQueue(label: "CascableCore Simulated Original Generation", qos: .utility)
+    private static let fillerChunkSize: Int = 1024 * 1024
+
+    private static func destinationUrl(basedOn previewUrl: URL, byteCount: Int) -> URL {
+        // Hashed, to get a filesystem-safe name from the preview's path.
+        let name = FNV1aHash.hexString(previewUrl.standardizedFileURL.path)
+        return FileManager.default.temporaryDirectory
+            .appendingPathComponent("CascableCore Simulated Originals", isDirectory: true)
+            .appendingPathComponent("\(name)-\(byteCount)")
+            .appendingPathExtension("JPG")
+    }
+
+    // Must be called with the lock held.
+    private static func generate(basedOn previewUrl: URL, byteCount: Int, at url: URL) -> Bool {
+        guard let preview = try? Data(contentsOf: previewUrl, options: .mappedIfSafe) else { return false }
+
+        // Written to a temporary name and moved into place, so a partially-written original is never picked up.
+        let partialUrl = url.appendingPathExtension("partial")
+        do {
+            try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+            try? FileManager.default.removeItem(at: partialUrl)
+            guard FileManager.default.createFile(atPath: partialUrl.path, contents: nil) else { return false }
+            let handle = try FileHandle(forWritingTo: partialUrl)
+            defer { handle.closeFile() }
+
+            handle.write(preview.prefix(byteCount))
+            var remaining = byteCount - min(preview.count, byteCount)
+            if remaining > 0 {
+                let filler = fillerChunk()
+                while remaining > 0 {
+                    let length = min(remaining, filler.count)
+                    handle.write(filler.prefix(length))
+                    remaining -= length
+                }
+            }
+
+            if FileManager.default.fileExists(atPath: url.path) { try FileManager.default.removeItem(at: url) }
+            try FileManager.default.moveItem(at: partialUrl, to: url)
+            return true
+        } catch {
+            try? FileManager.default.removeItem(at: partialUrl)
+            return false
+        }
+    }
+
+    private static func fillerChunk() -> Data {
+        // xorshift64, with a fixed seed so generated originals are identical from run to run.
+        var state: UInt64 = 0x9e3779b97f4a7c15
+        var chunk = Data(count: fillerChunkSize)
+        chunk.withUnsafeMutableBytes({ buffer in
+            for offset in stride(from: 0, to: buffer.count, by: 8) {
+                state ^= state << 13
+                state ^= state >> 7
+                state ^= state << 17
+                buffer.storeBytes(of: state.littleEndian, toByteOffset: offset, as: UInt64.self)
+            }
+        })
+        return chunk
+    }
+}
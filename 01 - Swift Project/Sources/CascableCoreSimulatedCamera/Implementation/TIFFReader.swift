@@ -0,0 +1,278 @@
+//
+//  TIFFReader.swift
+//  CascableCore Simulated Camera Plugin
+//
+//  Copyright © 2026 Cascable AB. All rights reserved.
+//
+
+import Foundation
+
+/// Random access to a local file's bytes that only reads the parts of the file that are asked for.
+///
+/// Small reads are served from 4KB pages that are cached once read, since parsing image headers tends to make lots
+/// of small, nearby reads. Large reads go straight to the file.
+final class FileByteSource {
+
+    /// Opens the given file, or returns `nil` if it can't be opened.
+    init?(url: URL) {
+        guard let handle = try? FileHandle(forReadingFrom: url) else { return nil }
+        fileHandle = handle
+        length = Int(handle.seekToEndOfFile())
+    }
+
+    deinit {
+        fileHandle.closeFile()
+    }
+
+    /// The length of the file, in bytes.
+    let length: Int
+
+    /// The number of bytes actually read from the file so far.
+    private(set) var bytesRead: Int = 0
+
+    /// Returns the given range of the file, or `nil` if the range isn't entirely within the file.
+    func read(at offset: Int, count: Int) -> Data? {
+        guard offset >= 0, count >= 0, offset <= length, count <= length - offset else { return nil }
+        guard count > 0 else { return Data() }
+
+        if count > FileByteSource.pageSize {
+            return readFromFile(at: offset, count: count)
+        }
+
+        let firstPage = offset / FileByteSource.pageSize
+        let lastPage = (offset + count - 1) / FileByteSource.pageSize
+        var result = Data(capacity: count)
+        for pageIndex in firstPage...lastPage {
+            guard let page = page(at: pageIndex) else { return nil }
+            let pageStart = pageIndex * FileByteSource.pageSize
+            let from = max(offset, pageStart) - pageStart
+            let to = min(offset + count, pageStart + page.count) - pageStart
+            result.append(page[page.startIndex + from..<page.startIndex + to])
+        }
+        return result.count == count ? result : nil
+    }
+
+    // MARK: - Internal
+
+    private static let pageSize: Int = 4096
+    private let fileHandle: FileHandle
+    private var pages: [Int: Data] = [:]
+
+    private func page(at index: Int) -> Data? {
+        if let page = pages[index] { return page }
+        let start = index * FileByteSource.pageSize
+        guard let page = readFromFile(at: start, count: min(FileByteSource.pageSize, length - start)) else { return nil }
+        pages[index] = page
+        return page
+    }
+
+    private func readFromFile(at offset: Int, count: Int) -> Data? {
+        fileHandle.seek(toFileOffset: UInt64(offset))
+        let data = fileHandle.readData(ofLength: count)
+        bytesRead += data.count
+        return data.count == count ? data : nil
+    }
+}
+
+/// A single entry in a TIFF image file directory (IFD).
+struct TIFFEntry {
+    /// The entry's tag.
+    let tag: UInt16
+    /// The entry's TIFF field type (1 = BYTE, 2 = ASCII, 3 = SHORT, 4 = LONG, 5 = RATIONAL, etc).
+    let type: UInt16
+    /// The number of values in the entry.
+    let count: Int
+    /// The absolute file offset of the entry's value(s), which may be within the entry itself.
+    let valueOffset: Int
+
+    /// The size of a single value of the entry's type, in bytes, or `nil` for unknown types.
+    var valueSize: Int? {
+        switch type {
+        case 1, 2, 6, 7: return 1
+        case 3, 8: return 2
+        case 4, 9, 11, 13: return 4
+        case 5, 10, 12: return 8
+        default: return nil
+        }
+    }
+}
+
+/// Reads the structure of TIFF data — including the TIFF-based structures found in EXIF blocks and most RAW formats —
+/// from a byte source, reading only the directories and values that are asked for.
+struct TIFFReader {
+
+    /// Commonly-used TIFF tags.
+    enum Tag {
+        static let compression: UInt16 = 0x0103
+        static let stripOffsets: UInt16 = 0x0111
+        static let stripByteCounts: UInt16 = 0x0117
+        static let subIFDs: UInt16 = 0x014A
+        static let jpegInterchangeFormat: UInt16 = 0x0201
+        static let jpegInterchangeFormatLength: UInt16 = 0x0202
+        static let exifIFD: UInt16 = 0x8769
+        static let gpsIFD: UInt16 = 0x8825
+        static let panasonicJPEGFromRAW: UInt16 = 0x002E
+    }
+
+    /// Creates a reader for TIFF data starting at the given offset of the source, or returns `nil` if the data there
+    /// doesn't have a recognised TIFF header.
+    init?(source: FileByteSource, base: Int) {
+        guard let header = source.read(at: base, count: 8) else { return nil }
+        let bytes = [UInt8](header)
+        switch (bytes[0], bytes[1]) {
+        case (0x49, 0x49): isBigEndian = false
+        case (0x4D, 0x4D): isBigEndian = true
+        default: return nil
+        }
+
+        self.source = source
+        self.base = base
+
+        // Standard TIFF uses 42. Panasonic RW2 uses 0x55 and Olympus ORF uses "RO"/"RS".
+        let magic = isBigEndian ? (UInt16(bytes[2]) << 8 | UInt16(bytes[3])) : (UInt16(bytes[3]) << 8 | UInt16(bytes[2]))
+        guard [42, 0x55, 0x4F52, 0x5352].contains(magic) else { return nil }
+
+        let offset = isBigEndian ?
+            (Int(bytes[4]) << 24 | Int(bytes[5]) << 16 | Int(bytes[6]) << 8 | Int(bytes[7])) :
+            (Int(bytes[7]) << 24 | Int(bytes[6]) << 16 | Int(bytes[5]) << 8 | Int(bytes[4]))
+        firstIFDOffset = base + offset
+    }
+
+    let source: FileByteSource
+
+    /// The absolute offset of the TIFF header. Offsets within the TIFF data are relative to this.
+    let base: Int
+
+    /// Whether the TIFF data is big-endian ("MM") rather than little-endian ("II").
+    let isBigEndian: Bool
+
+    /// The absolute offset of the first IFD.
+    let firstIFDOffset: Int
+
+    /// Reads the IFD at the given absolute offset, returning its entries and the absolute offset of the next IFD in
+    /// the chain (or `nil` if it's the last one). Returns `nil` if the IFD can't be read.
+    func directory(at offset: Int) -> (entries: [TIFFEntry], nextIFDOffset: Int?)? {
+        guard let count = uint16(at: offset), count > 0, count < 1000 else { return nil }
+        guard let block = source.read(at: offset + 2, count: Int(count) * 12 + 4) else { return nil }
+
+        var entries: [TIFFEntry] = []
+        entries.reserveCapacity(Int(count))
+        for index in 0..<Int(count) {
+            let entryStart = index * 12
+            let tag = decodeUInt16(block, at: entryStart)
+            let type = decodeUInt16(block, at: entryStart + 2)
+            let valueCount = Int(decodeUInt32(block, at: entryStart + 4))
+            var entry = TIFFEntry(tag: tag, type: type, count: valueCount, valueOffset: offset + 2 + entryStart + 8)
+            if let valueSize = entry.valueSize, valueSize * valueCount > 4 {
+                entry = TIFFEntry(tag: tag, type: type, count: valueCount,
+                                  valueOffset: base + Int(decodeUInt32(block, at: entryStart + 8)))
+            }
+            entries.append(entry)
+        }
+
+        let next = Int(decodeUInt32(block, at: Int(count) * 12))
+        return (entries, next == 0 ? nil : base + next)
+    }
+
+    /// Returns the unsigned integer values of a BYTE, SHORT or LONG entry. Returns an empty array for other types.
+    func integerValues(of entry: TIFFEntry, limit: Int = 64) -> [Int] {
+        guard [1, 3, 4, 13].contains(entry.type), let valueSize = entry.valueSize else { return [] }
+        let count = min(entry.count, limit)
+        guard let data = source.read(at: entry.valueOffset, count: count * valueSize) else { return [] }
+        return (0..<count).map({ index in
+            switch valueSize {
+            case 1: return Int(data[data.startIndex + index])
+            case 2: return Int(decodeUInt16(data, at: index * 2))
+            default: return Int(decodeUInt32(data, at: index * 4))
+            }
+        })
+    }
+
+    /// Returns the value of an ASCII entry, without its trailing null(s).
+    func stringValue(of entry: TIFFEntry, limit: Int = 256) -> String? {
+        guard entry.type == 2, entry.count <= limit, let data = rawValue(of: entry) else { return nil }
+        let bytes = data.prefix(while: { $0 != 0 })
+        let string = String(decoding: bytes, as: UTF8.self).trimmingCharacters(in: .whitespaces)
+        return string.isEmpty ? nil : string
+    }
+
+    /// Returns the values of a RATIONAL or SRATIONAL entry. Values with a zero denominator are skipped.
+    func rationalValues(of entry: TIFFEntry, limit: Int = 16) -> [Double] {
+        guard entry.type == 5 || entry.type == 10 else { return [] }
+        let count = min(entry.count, limit)
+        guard let data = source.read(at: entry.valueOffset, count: count * 8) else { return [] }
+        return (0..<count).compactMap({ index in
+            let numerator = decodeUInt32(data, at: index * 8)
+            let denominator = decodeUInt32(data, at: index * 8 + 4)
+            guard denominator != 0 else { return nil }
+            if entry.type == 10 { return Double(Int32(bitPattern: numerator)) / Double(Int32(bitPattern: denominator)) }
+            return Double(numerator) / Double(denominator)
+        })
+    }
+
+    /// Returns the raw bytes of an entry's value(s).
+    func rawValue(of entry: TIFFEntry, limit: Int = 64 * 1024) -> Data? {
+        guard let valueSize = entry.valueSize, entry.count * valueSize <= limit else { return nil }
+        return source.read(at: entry.valueOffset, count: entry.count * valueSize)
+    }
+
+    /// Returns a reader for the EXIF block of the JPEG at the given offset of the source, or `nil` if there isn't a
+    /// JPEG there or it doesn't have an EXIF block. Only the JPEG's marker segments before the image data are read.
+    static func exifReader(inJPEGAt offset: Int, of source: FileByteSource) -> TIFFReader? {
+        guard let soi = source.read(at: offset, count: 3), soi.elementsEqual([0xFF, 0xD8, 0xFF]) else { return nil }
+
+        var segmentOffset = offset + 2
+        for _ in 0..<64 {
+            guard let segmentHeader = source.read(at: segmentOffset, count: 4) else { return nil }
+            let bytes = [UInt8](segmentHeader)
+            guard bytes[0] == 0xFF else { return nil }
+            let marker = bytes[1]
+            if marker == 0xDA || marker == 0xD9 { return nil } // Start of scan/end of image.
+
+            if marker == 0xE1, let signature = source.read(at: segmentOffset + 4, count: 6),
+               signature.elementsEqual(Array("Exif".utf8) + [0, 0]) {
+                return TIFFReader(source: source, base: segmentOffset + 10)
+            }
+
+            segmentOffset += 2 + (Int(bytes[2]) << 8 | Int(bytes[3]))
+        }
+        return nil
+    }
+
+    /// Returns a reader for the primary TIFF/EXIF structure of an image file, whether it's a JPEG, a TIFF-based RAW,
+    /// or a RAF (whose metadata lives in its embedded JPEG).
+    static func metadataReader(for source: FileByteSource) -> TIFFReader? {
+        if let reader = exifReader(inJPEGAt: 0, of: source) { return reader }
+
+        if let header = source.read(at: 0, count: 16), header.starts(with: Array("FUJIFILMCCD-RAW".utf8)) {
+            guard let raf = source.read(at: 84, count: 4) else { return nil }
+            let bytes = [UInt8](raf)
+            return exifReader(inJPEGAt: Int(bytes[0]) << 24 | Int(bytes[1]) << 16 | Int(bytes[2]) << 8 | Int(bytes[3]), of: source)
+        }
+
+        return TIFFReader(source: source, base: 0)
+    }
+
+    func uint16(at offset: Int) -> UInt16? {
+        guard let data = source.read(at: offset, count: 2) else { return nil }
+        return decodeUInt16(data, at: 0)
+    }
+
+    func uint32(at offset: Int) -> UInt32? {
+        guard let data = source.read(at: offset, count: 4) else { return nil }
+        return decodeUInt32(data, at: 0)
+    }
+
+    func decodeUInt16(_ data: Data, at index: Int) -> UInt16 {
+        let first = UInt16(data[data.startIndex + index])
+        let second = UInt16(data[data.startIndex + index + 1])
+        return isBigEndian ? (first << 8 | second) : (second << 8 | first)
+    }
+
+    func decodeUInt32(_ data: Data, at index: Int) -> UInt32 {
+        let bytes = (0..<4).map({ UInt32(data[data.startIndex + index + $0]) })
+        return isBigEndian ?
+            (bytes[0] << 24 | bytes[1] << 16 | bytes[2] << 8 | bytes[3]) :
+            (bytes[3] << 24 | bytes[2] << 16 | bytes[1] << 8 | bytes[0])
+    }
+}
@@ -22,6 +22,11 @@ public struct SimulatedCameraConfiguration {
     /// The default value is the plugin's identifier (`se.cascable.CascableCore.plugin.simulated-camera`).
     public var identifier: String
 
+    /// The number of independent simulated cameras to discover. When greater than one, each camera's identifier (and
+    /// therefore its serial number) and model name are suffixed with its number, and each camera's live view stream
+    /// starts at a different frame. The default value is `1`.
+    public var cameraCount: Int
+
     /// Which authentication type to perform when connecting to the simulated camera.
     /// The default value is `.pairOnCamera`.
     public var connectionAuthentication: SimulatedAuthentication
@@ -42,6 +47,18 @@ public struct SimulatedCameraConfiguration {
     /// fail.
     public var liveViewImageFrames: [URL]
 
+    /// The rate, in shots per second, at which the simulated camera shoots when a continuous drive mode is set via
+    /// the `driveMode` property. The default value is 10.
+    public var burstFramesPerSecond: Double
+
+    /// The number of shots the simulated camera takes per shutter press when a continuous drive mode is set via the
+    /// `driveMode` property. The default value is 10.
+    public var burstLength: Int
+
+    /// The size, in bytes, of the synthetic full-size original delivered alongside the preview for each shot through
+    /// camera-initiated transfers. Set to zero to only deliver previews. The default value is 24MB.
+    public var syntheticOriginalByteCount: Int
+
     /// The local filesystem URL to expose as a storage device on the simulated camera. When set to an accessible
     /// directory, the simulated camera will use that directory's contents to populate the camera's storage device.
     /// For best results, it should simulate a real layout (`/DCIM/100CAMERA/etc`). The default value is `nil`.
@@ -50,10 +67,36 @@ public struct SimulatedCameraConfiguration {
     /// How the simulated camera grants filesystem access. Defaults to `.alongsideRemoteShooting`.
     public var fileSystemAccess: SimulatedFileSystemAccess
 
+    /// The maximum size, in bytes, of each chunk delivered when streaming a file from the simulated camera's storage.
+    /// The default value is 1MB.
+    public var fileStreamChunkSize: Int
+
+    /// A local directory in which to persistently cache thumbnails and previews fetched from the simulated camera's
+    /// storage. When set, image requests for items whose storage, path, size and date match a cached image are served
+    /// from the cache without going to the camera. The default value is `nil`, which disables the cache.
+    public var imageCacheDirectory: URL?
+
+    /// The maximum number of bytes of image data to keep in the image cache. Least recently used images are evicted
+    /// when this is exceeded. Cameras sharing an image cache directory must use the same budget — a camera whose budget
+    /// differs from that of an already-open cache in the same directory doesn't use the cache. The default value is 256MB.
+    public var imageCacheByteBudget: Int
+
+    /// A local directory in which to keep snapshots of the simulated camera's storage file tree. When set, a snapshot
+    /// is written when the camera disconnects and restored when it next connects, making the storage browseable
+    /// immediately — only directories that have changed in the meantime are re-listed. The default value is `nil`,
+    /// which disables snapshots.
+    public var storageIndexDirectory: URL?
+
     /// The internal dispatch queue to be used for internal and the default for public callbacks. Leave this as the main
     /// queue unless you have a specific reason to change it.
     public var internalCallbackQueue: DispatchQueue
 
+    /// Queues to multiplex the simulated cameras' work over. When non-empty, each simulated camera gets its own serial
+    /// internal callback queue targeting one of these queues in turn, so cameras only wait on each other when they
+    /// share a serial target. Pass a single concurrent queue to keep every camera independent. Discovery callbacks continue to use `internalCallbackQueue`. The default value is an empty
+    /// array, which makes every camera use `internalCallbackQueue` directly.
+    public var internalCallbackQueueTargets: [DispatchQueue]
+
     /// Apply the settings for newly-discovered simulated cameras. Changes won't be applied to simulated cameras
     /// that have already been discovered or connected to (i.e., you should apply your configuration before starting
     /// camera discovery).
@@ -74,14 +117,48 @@ public extension SimulatedCameraConfiguration {
         return SimulatedCameraConfiguration(manufacturer: "Cascable",
                                             model: "Simulated Camera",
                                             identifier: SimulatedCameraPluginIdentifier,
+                                            cameraCount: 1,
                                             connectionAuthentication: .pairOnCamera,
                                             connectionSpeed: .fast,
                                             connectionTransports: [.network, .USB],
                                             exposurePropertyType: .enumerated,
                                             liveViewImageFrames: imageUrls,
+                                            burstFramesPerSecond: 10.0,
+                                            burstLength: 10,
+                                            syntheticOriginalByteCount: 24 * 1024 * 1024,
                                             storageFileSystemRoot: nil,
                                             fileSystemAccess: .alongsideRemoteShooting,
-                                            internalCallbackQueue: .main)
+                                            fileStreamChunkSize: 1024 * 1024,
+                                            imageCacheDirectory: nil,
+                                            imageCacheByteBudget: 256 * 1024 * 1024,
+                                            storageIndexDirectory: nil,
+                                            internalCallbackQueue: .main,
+                                            internalCallbackQueueTargets: [])
+    }
+}
+
+internal extension SimulatedCameraConfiguration {
+
+    /// Returns the configuration for the simulated camera at the given index, making it distinct from the other
+    /// `cameraCount` cameras and giving it its own callback queue if `internalCallbackQueueTargets` is set. With a
+    /// single camera and no queue targets, the configuration is returned unchanged.
+    func configuration(forCameraAt index: Int) -> SimulatedCameraConfiguration {
+        var configuration = self
+        if cameraCount > 1 {
+            let number = String(format: "%02d", index + 1)
+            configuration.identifier = "\(identifier)-\(number)"
+            configuration.model = "\(model) \(number)"
+            if !liveViewImageFrames.isEmpty {
+                let offset = index % liveViewImageFrames.count
+                configuration.liveViewImageFrames = Array(liveViewImageFrames[offset...] + liveViewImageFrames[..<offset])
+            }
+        }
+
+        if !internalCallbackQueueTargets.isEmpty {
+            let target = internalCallbackQueueTargets[index % internalCallbackQueueTargets.count]
+            configuration.internalCallbackQueue = DispatchQueue(label: "Simulated Camera \(configuration.identifier)", target: target)
+        }
+        return configuration
     }
 }
 
@@ -148,18 +148,13 @@ public class ApertureValue: NSObject, NSCopying, NSSecureCoding, UniversalExposu
 
     /// Returns the localized display string for the receiver.
     public var localizedDisplayValue: String? {
-        return formatter.string(from: NSNumber(value: approximateDecimalValue))
+        return DisplayValueCache.shared.displayValue(for: .aperture, stops: stopsFromF8) { formatter in
+            return formatter.string(from: NSNumber(value: approximateDecimalValue))
+        }
     }
 
     // MARK: - Internal
 
-    private lazy var formatter: NumberFormatter = {
-        let formatter = NumberFormatter()
-        formatter.numberStyle = .decimal
-        formatter.usesGroupingSeparator = false
-        return formatter
-    }()
-
     public static func == (lhs: ApertureValue, rhs: ApertureValue) -> Bool {
         return lhs.stopsFromF8 == rhs.stopsFromF8
     }
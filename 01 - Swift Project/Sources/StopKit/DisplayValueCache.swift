@@ -0,0 +1,77 @@
+import Foundation
+
+/// The kinds of exposure value whose display strings can be cached by `DisplayValueCache`.
+internal enum DisplayValueKind: Int {
+    case iso
+    case aperture
+    case shutterSpeed
+    case exposureCompensation
+}
+
+/// A process-wide cache of number formatters and formatted display strings for exposure values.
+///
+/// `NumberFormatter` is expensive to construct, and exposure values are created (and thrown away) in large
+/// numbers when building lists of valid settable values. Rather than have each value own a formatter, all
+/// values share one formatter per locale, and the resulting display strings are memoised by the value's
+/// stops. After warm-up, producing the display list for a full property grid constructs no formatters at all.
+internal final class DisplayValueCache {
+
+    /// The shared cache instance.
+    static let shared = DisplayValueCache()
+
+    /// Returns the display string for the given value, building and caching it if it isn't already known.
+    ///
+    /// The builder block is only invoked on a cache miss. It's called with a shared decimal number formatter
+    /// (without grouping separators) for the current locale, and must not call back into the cache.
+    ///
+    /// @param kind The kind of value being displayed.
+    /// @param stops The stops of the value being displayed.
+    /// @param builder A block that builds the display string using the given formatter.
+    /// @return Returns the display string for the value.
+    func displayValue(for kind: DisplayValueKind, stops: ExposureStops, builder: (NumberFormatter) -> String?) -> String? {
+        let localeIdentifier = Locale.current.identifier
+        let key = Key(kind: kind, wholeStops: stops.wholeStopsFromZero, fraction: stops.fraction,
+                      isNegative: stops.isNegative, localeIdentifier: localeIdentifier)
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let cached = displayValues[key] { return cached }
+        guard let value = builder(formatter(for: localeIdentifier)) else { return nil }
+        displayValues[key] = value
+        return value
+    }
+
+    /// Removes all cached formatters and display strings. Useful if the app's localization changes at runtime.
+    func removeAllValues() {
+        lock.lock()
+        defer { lock.unlock() }
+        formatters.removeAll()
+        displayValues.removeAll()
+    }
+
+    // MARK: - Internal
+
+    private struct Key: Hashable {
+        let kind: DisplayValueKind
+        let wholeStops: UInt
+        let fraction: ExposureStopFraction
+        let isNegative: Bool
+        let localeIdentifier: String
+    }
+
+    private let lock = NSLock()
+    private var formatters: [String: NumberFormatter] = [:]
+    private var displayValues: [Key: String] = [:]
+
+    // Must be called with the lock held.
+    private func formatter(for localeIdentifier: String) -> NumberFormatter {
+        if let existing = formatters[localeIdentifier] { return existing }
+        let formatter = NumberFormatter()
+        formatter.locale = Locale(identifier: localeIdentifier)
+        formatter.numberStyle = .decimal
+        formatter.usesGroupingSeparator = false
+        formatters[localeIdentifier] = formatter
+        return formatter
+    }
+}
@@ -70,32 +70,34 @@ public class ExposureCompensationValue: NSObject, NSCopying, NSSecureCoding, Uni
 
     /// Returns the localized display string for the receiver.
     public var localizedDisplayValue: String? {
-        let fractionString: String = {
-            switch stopsFromZeroEV.fraction {
-            case .none: return ""
-            case .oneThird: return StopKitLocalizedString("OneThirdFraction", "UniversalExposureCompensations")
-            case .oneHalf: return StopKitLocalizedString("OneHalfFraction", "UniversalExposureCompensations")
-            case .twoThirds: return StopKitLocalizedString("TwoThirdsFraction", "UniversalExposureCompensations")
-            }
-        }()
-
-        let numberString: String = {
-            if stopsFromZeroEV.wholeStopsFromZero != 0 || (stopsFromZeroEV.wholeStopsFromZero == 0 && stopsFromZeroEV.fraction == .none) {
-                return formatter.string(from: NSNumber(value: stopsFromZeroEV.wholeStopsFromZero)) ?? "\(stopsFromZeroEV.wholeStopsFromZero)"
-            } else {
-                return ""
-            }
-        }()
-
-        let signString: String = {
-            if stopsFromZeroEV.wholeStopsFromZero == 0 && stopsFromZeroEV.fraction == .none {
-                return ""
-            } else {
-                return stopsFromZeroEV.isNegative ? "-" : "+"
-            }
-        }()
-
-        return "\(signString)\(numberString)\(fractionString)"
+        return DisplayValueCache.shared.displayValue(for: .exposureCompensation, stops: stopsFromZeroEV) { formatter in
+            let fractionString: String = {
+                switch stopsFromZeroEV.fraction {
+                case .none: return ""
+                case .oneThird: return StopKitLocalizedString("OneThirdFraction", "UniversalExposureCompensations")
+                case .oneHalf: return StopKitLocalizedString("OneHalfFraction", "UniversalExposureCompensations")
+                case .twoThirds: return StopKitLocalizedString("TwoThirdsFraction", "UniversalExposureCompensations")
+                }
+            }()
+
+            let numberString: String = {
+                if stopsFromZeroEV.wholeStopsFromZero != 0 || (stopsFromZeroEV.wholeStopsFromZero == 0 && stopsFromZeroEV.fraction == .none) {
+                    return formatter.string(from: NSNumber(value: stopsFromZeroEV.wholeStopsFromZero)) ?? "\(stopsFromZeroEV.wholeStopsFromZero)"
+                } else {
+                    return ""
+                }
+            }()
+
+            let signString: String = {
+                if stopsFromZeroEV.wholeStopsFromZero == 0 && stopsFromZeroEV.fraction == .none {
+                    return ""
+                } else {
+                    return stopsFromZeroEV.isNegative ? "-" : "+"
+                }
+            }()
+
+            return "\(signString)\(numberString)\(fractionString)"
+        }
     }
 
     // MARK: - Internal
@@ -132,12 +134,4 @@ public class ExposureCompensationValue: NSObject, NSCopying, NSSecureCoding, Uni
     override public var description: String {
         return succinctDescription
     }
-
-    private lazy var formatter: NumberFormatter = {
-        let formatter = NumberFormatter()
-        formatter.numberStyle = .decimal
-        formatter.usesGroupingSeparator = false
-        return formatter
-    }()
-
 }
\ No newline at end of file
@@ -0,0 +1,272 @@
+import Foundation
+
+/// Constraints to apply when solving for equivalent exposures. Any `nil` constraint is unbounded.
+public struct ExposureTriangleConstraints {
+
+    /// Creates an unconstrained set of constraints.
+    public init() {}
+
+    /// The highest ISO value that may be chosen.
+    public var maximumISO: ISOValue? = nil
+
+    /// The lowest ISO value that may be chosen.
+    public var minimumISO: ISOValue? = nil
+
+    /// The slowest (longest) shutter speed that may be chosen — for instance, to avoid camera shake.
+    public var slowestShutterSpeed: ShutterSpeedValue? = nil
+
+    /// The fastest (shortest) shutter speed that may be chosen — for instance, to stay within flash sync speed.
+    public var fastestShutterSpeed: ShutterSpeedValue? = nil
+
+    /// The widest aperture that may be chosen.
+    public var widestAperture: ApertureValue? = nil
+
+    /// The narrowest aperture that may be chosen.
+    public var narrowestAperture: ApertureValue? = nil
+}
+
+/// The exposure property the solver should try hardest to keep unchanged when picking a best-fit solution.
+public enum ExposureTrianglePriority {
+    /// Prefer solutions that keep the aperture (and therefore depth of field) unchanged.
+    case aperture
+    /// Prefer solutions that keep the shutter speed (and therefore motion blur) unchanged.
+    case shutterSpeed
+    /// Prefer solutions that keep the ISO (and therefore noise) unchanged.
+    case iso
+}
+
+/// A single (aperture, shutter speed, ISO) combination produced by `ExposureTriangleSolver`.
+public struct ExposureTriangleSolution {
+
+    /// The solution's aperture value.
+    public let aperture: ApertureValue
+
+    /// The solution's shutter speed value.
+    public let shutterSpeed: ShutterSpeedValue
+
+    /// The solution's ISO value.
+    public let iso: ISOValue
+
+    /// How far the solution's exposure is from the requested exposure. Negative values indicate underexposure.
+    /// Will be zero for exact solutions.
+    public let error: ExposureStops
+}
+
+/// A table-driven solver for the "exposure triangle" — finding (aperture, shutter speed, ISO) combinations that
+/// produce a given exposure.
+///
+/// The solver is built once from the valid values of each property (typically a property's `validSettableValues`),
+/// which are converted into tables of integer sixths-of-a-stop sorted by exposure. Queries then work entirely in
+/// integer arithmetic, iterating the aperture and shutter speed tables and binary searching the ISO table, which
+/// makes them cheap enough to recompute on every light meter update even for full 1/3-stop ranges.
+///
+/// Exposure is measured in "stops of light", so a wider aperture, slower shutter speed or higher ISO all
+/// increase exposure.
+public final class ExposureTriangleSolver {
+
+    /// Creates a new solver from the given valid values. Indeterminate values (automatic, bulb, etc) are ignored.
+    ///
+    /// @param apertures The valid aperture values.
+    /// @param shutterSpeeds The valid shutter speed values.
+    /// @param isos The valid ISO values.
+    public init(apertures: [ApertureValue], shutterSpeeds: [ShutterSpeedValue], isos: [ISOValue]) {
+        apertureTable = ExposureTriangleSolver.table(from: apertures, stops: { $0.stopsFromF8 })
+        shutterSpeedTable = ExposureTriangleSolver.table(from: shutterSpeeds, stops: { $0.stopsFromASecond })
+        isoTable = ExposureTriangleSolver.table(from: isos, stops: { $0.stopsFromISO100 })
+    }
+
+    /// Returns all combinations that exactly match the exposure of the given values, adjusted by the given delta.
+    ///
+    /// Solutions are ordered by aperture (widest first), then by shutter speed (fastest first).
+    ///
+    /// @param delta The exposure change to apply. Positive values brighten the exposure.
+    /// @param aperture The current aperture value.
+    /// @param shutterSpeed The current shutter speed value.
+    /// @param iso The current ISO value.
+    /// @param constraints The constraints to apply to the solutions.
+    /// @return Returns the matching solutions, which may be empty.
+    public func solutions(applying delta: ExposureStops, to aperture: ApertureValue, _ shutterSpeed: ShutterSpeedValue,
+                          _ iso: ISOValue, constraints: ExposureTriangleConstraints = ExposureTriangleConstraints()) throws -> [ExposureTriangleSolution] {
+        let target = try targetExposure(applying: delta, to: aperture, shutterSpeed, iso)
+        let bounds = Bounds(constraints)
+        var solutions: [ExposureTriangleSolution] = []
+
+        for apertureEntry in apertureTable.reversed() where bounds.aperture.contains(apertureEntry.sixths) {
+            for shutterEntry in shutterSpeedTable where bounds.shutterSpeed.contains(shutterEntry.sixths) {
+                let requiredISO = target - apertureEntry.sixths - shutterEntry.sixths
+                guard bounds.iso.contains(requiredISO), let isoIndex = indexOfEntry(in: isoTable, withSixths: requiredISO) else { continue }
+                solutions.append(ExposureTriangleSolution(aperture: apertureEntry.value, shutterSpeed: shutterEntry.value,
+                                                          iso: isoTable[isoIndex].value, error: .zero))
+            }
+        }
+
+        return solutions
+    }
+
+    /// Returns the combination that best matches the exposure of the given values, adjusted by the given delta.
+    ///
+    /// Candidates are ranked first by how close they are to the requested exposure, then by how little they
+    /// change the property given by `priority`, then by how little they change the other two properties, then by
+    /// lowest ISO.
+    ///
+    /// @param delta The exposure change to apply. Positive values brighten the exposure.
+    /// @param aperture The current aperture value.
+    /// @param shutterSpeed The current shutter speed value.
+    /// @param iso The current ISO value.
+    /// @param priority The property to try hardest to keep unchanged.
+    /// @param constraints The constraints to apply to the solution.
+    /// @return Returns the best solution, or `nil` if the constraints exclude every combination.
+    public func bestSolution(applying delta: ExposureStops, to aperture: ApertureValue, _ shutterSpeed: ShutterSpeedValue,
+                             _ iso: ISOValue, priority: ExposureTrianglePriority,
+                             constraints: ExposureTriangleConstraints = ExposureTriangleConstraints()) throws -> ExposureTriangleSolution? {
+        let target = try targetExposure(applying: delta, to: aperture, shutterSpeed, iso)
+        let bounds = Bounds(constraints)
+        let currentAperture = aperture.stopsFromF8.sixthsFromZero
+        let currentShutterSpeed = shutterSpeed.stopsFromASecond.sixthsFromZero
+        let currentISO = iso.stopsFromISO100.sixthsFromZero
+
+        let isoCandidates = isoTable.filter({ bounds.iso.contains($0.sixths) })
+        guard !isoCandidates.isEmpty else { return nil }
+
+        var best: (score: Score, aperture: Entry<ApertureValue>, shutterSpeed: Entry<ShutterSpeedValue>, iso: Entry<ISOValue>)? = nil
+
+        for apertureEntry in apertureTable where bounds.aperture.contains(apertureEntry.sixths) {
+            for shutterEntry in shutterSpeedTable where bounds.shutterSpeed.contains(shutterEntry.sixths) {
+                // For a given aperture and shutter speed, only the ISO entries either side of the ideal can be closest.
+                let requiredISO = target - apertureEntry.sixths - shutterEntry.sixths
+                let insertionIndex = self.insertionIndex(in: isoCandidates, forSixths: requiredISO)
+                for isoIndex in [insertionIndex - 1, insertionIndex] where isoCandidates.indices.contains(isoIndex) {
+                    let isoEntry = isoCandidates[isoIndex]
+                    let apertureChange = abs(apertureEntry.sixths - currentAperture)
+                    let shutterSpeedChange = abs(shutterEntry.sixths - currentShutterSpeed)
+                    let isoChange = abs(isoEntry.sixths - currentISO)
+                    let priorityChange: Int = {
+                        switch priority {
+                        case .aperture: return apertureChange
+                        case .shutterSpeed: return shutterSpeedChange
+                        case .iso: return isoChange
+                        }
+                    }()
+
+                    let score = Score(error: abs(apertureEntry.sixths + shutterEntry.sixths + isoEntry.sixths - target),
+                                      priorityChange: priorityChange,
+                                      totalChange: apertureChange + shutterSpeedChange + isoChange,
+                                      iso: isoEntry.sixths)
+
+                    if best == nil || score < best!.score {
+                        best = (score, apertureEntry, shutterEntry, isoEntry)
+                    }
+                }
+            }
+        }
+
+        guard let winner = best else { return nil }
+        let error = winner.aperture.sixths + winner.shutterSpeed.sixths + winner.iso.sixths - target
+        return ExposureTriangleSolution(aperture: winner.aperture.value, shutterSpeed: winner.shutterSpeed.value,
+                                        iso: winner.iso.value, error: ExposureStops(sixths: error))
+    }
+
+    // MARK: - Internal
+
+    private struct Entry<Value> {
+        let sixths: Int
+        let value: Value
+    }
+
+    private struct Score: Comparable {
+        let error: Int
+        let priorityChange: Int
+        let totalChange: Int
+        let iso: Int
+
+        static func < (lhs: Score, rhs: Score) -> Bool {
+            return (lhs.error, lhs.priorityChange, lhs.totalChange, lhs.iso) <
+                (rhs.error, rhs.priorityChange, rhs.totalChange, rhs.iso)
+        }
+    }
+
+    private struct Bounds {
+        let aperture: ClosedRange<Int>
+        let shutterSpeed: ClosedRange<Int>
+        let iso: ClosedRange<Int>
+
+        init(_ constraints: ExposureTriangleConstraints) {
+            aperture = Bounds.range(lower: constraints.narrowestAperture?.stopsFromF8,
+                                    upper: constraints.widestAperture?.stopsFromF8)
+            shutterSpeed = Bounds.range(lower: constraints.fastestShutterSpeed?.stopsFromASecond,
+                                        upper: constraints.slowestShutterSpeed?.stopsFromASecond)
+            iso = Bounds.range(lower: constraints.minimumISO?.stopsFromISO100,
+                               upper: constraints.maximumISO?.stopsFromISO100)
+        }
+
+        private static func range(lower: ExposureStops?, upper: ExposureStops?) -> ClosedRange<Int> {
+            let lowerBound = lower?.sixthsFromZero ?? Int.min
+            let upperBound = upper?.sixthsFromZero ?? Int.max
+            return min(lowerBound, upperBound)...max(lowerBound, upperBound)
+        }
+    }
+
+    private let apertureTable: [Entry<ApertureValue>]
+    private let shutterSpeedTable: [Entry<ShutterSpeedValue>]
+    private let isoTable: [Entry<ISOValue>]
+
+    private static func table<Value: UniversalExposurePropertyValue>(from values: [Value], stops: (Value) -> ExposureStops) -> [Entry<Value>] {
+        var seenSixths = Set<Int>()
+        return values
+            .filter({ $0.isDeterminate })
+            .map({ Entry(sixths: stops($0).sixthsFromZero, value: $0) })
+            .sorted(by: { $0.sixths < $1.sixths })
+            .filter({ seenSixths.insert($0.sixths).inserted })
+    }
+
+    private func targetExposure(applying delta: ExposureStops, to aperture: ApertureValue, _ shutterSpeed: ShutterSpeedValue,
+                                _ iso: ISOValue) throws -> Int {
+        guard aperture.isDeterminate, shutterSpeed.isDeterminate, iso.isDeterminate else {
+            throw ExposurePropertyComparisonError.containsIndeterminateValue
+        }
+
+        return aperture.stopsFromF8.sixthsFromZero + shutterSpeed.stopsFromASecond.sixthsFromZero +
+            iso.stopsFromISO100.sixthsFromZero + delta.sixthsFromZero
+    }
+
+    // Returns the index of the first entry whose sixths value is greater than or equal to the given value.
+    private func insertionIndex<Value>(in table: [Entry<Value>], forSixths sixths: Int) -> Int {
+        var low = 0
+        var high = table.count
+        while low < high {
+            let mid = (low + high) / 2
+            if table[mid].sixths < sixths { low = mid + 1 } else { high = mid }
+        }
+        return low
+    }
+
+    private func indexOfEntry<Value>(in table: [Entry<Value>], withSixths sixths: Int) -> Int? {
+        let index = insertionIndex(in: table, forSixths: sixths)
+        guard index < table.count, table[index].sixths == sixths else { return nil }
+        return index
+    }
+}
+
+internal extension ExposureStops {
+
+    /// Returns the receiver as an integer number of sixths of a stop, which can exactly represent
+    /// whole, third and half stops.
+    var sixthsFromZero: Int {
+        let fractionalSixths: Int = {
+            switch fraction {
+            case .none: return 0
+            case .oneThird: return 2
+            case .oneHalf: return 3
+            case .twoThirds: return 4
+            }
+        }()
+
+        let sixths = (Int(wholeStopsFromZero) * 6) + fractionalSixths
+        return isNegative ? -sixths : sixths
+    }
+
+    /// Creates a stop vector from the given number of sixths of a stop, clamped to the closest sensible fraction.
+    convenience init(sixths: Int) {
+        self.init(decimalValue: Double(sixths) / 6.0)
+    }
+}
@@ -129,18 +129,13 @@ public class ISOValue: NSObject, NSCopying, NSSecureCoding, UniversalExposurePro
 
     /// Returns the localized display string for the receiver.
     public var localizedDisplayValue: String? {
-        return formatter.string(from: NSNumber(value: numericISOValue))
+        return DisplayValueCache.shared.displayValue(for: .iso, stops: stopsFromISO100) { formatter in
+            return formatter.string(from: NSNumber(value: numericISOValue))
+        }
     }
 
     // MARK: - Internal
 
-    private lazy var formatter: NumberFormatter = {
-        let formatter = NumberFormatter()
-        formatter.numberStyle = .decimal
-        formatter.usesGroupingSeparator = false
-        return formatter
-    }()
-
     public static func == (lhs: ISOValue, rhs: ISOValue) -> Bool {
         return lhs.stopsFromISO100 == rhs.stopsFromISO100
     }
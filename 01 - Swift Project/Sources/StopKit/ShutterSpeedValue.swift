@@ -372,24 +372,19 @@ public class ShutterSpeedValue: NSObject, NSCopying, NSSecureCoding, UniversalEx
 
     /// Returns the localized display string for the receiver.
     public var localizedDisplayValue: String? {
-        if (self.approximateTimeInterval < 0.3) {
-            // Return 1/x representation.
-            return String("\(StopKitLocalizedString("OneOver", "UniversalShutterSpeeds"))\(ShutterSpeedValue.significantFraction(for: stopsFromASecond))")
-        } else {
-            // Return decimal representation.
-            return formatter.string(from: NSNumber(value: approximateTimeInterval))
+        return DisplayValueCache.shared.displayValue(for: .shutterSpeed, stops: stopsFromASecond) { formatter in
+            if (self.approximateTimeInterval < 0.3) {
+                // Return 1/x representation.
+                return String("\(StopKitLocalizedString("OneOver", "UniversalShutterSpeeds"))\(ShutterSpeedValue.significantFraction(for: stopsFromASecond))")
+            } else {
+                // Return decimal representation.
+                return formatter.string(from: NSNumber(value: approximateTimeInterval))
+            }
         }
     }
 
     // MARK: - Internal
 
-    private lazy var formatter: NumberFormatter = {
-        let formatter = NumberFormatter()
-        formatter.numberStyle = .decimal
-        formatter.usesGroupingSeparator = false
-        return formatter
-    }()
-
     public static func == (lhs: ShutterSpeedValue, rhs: ShutterSpeedValue) -> Bool {
         return lhs.stopsFromASecond == rhs.stopsFromASecond
     }
@@ -44,6 +44,35 @@ class CameraTests: XCTestCase, CameraDiscoveryProviderDelegate {
         XCTAssertNotNil(camera.lastLiveViewFrame)
     }
 
+    func testDiscoveryEventQueueAndHandleLookup() throws {
+        // The event queue is the same bounded queue transfers use, so overflowing it drops and counts the oldest events.
+        let camera = SimulatedCamera(configuration: .default, clientName: "Windows Test Runner", transport: .network)
+        let wrapped = BasicCamera(wrapping: camera, handle: 1, callbackQueue: .main)
+        let events = BasicBoundedQueue<BasicCameraDiscoveryEvent>(capacity: 2)
+        for type in [BasicCameraDiscoveryEventType.appeared, .metadataResolved, .lost] {
+            events.enqueue({ _ in BasicCameraDiscoveryEvent(type: type, camera: wrapped) })
+        }
+        XCTAssertEqual(events.droppedCount, 1)
+        XCTAssertEqual(events.dequeue(waitingUpTo: 0.0)?.type, .metadataResolved)
+        XCTAssertEqual(events.dequeue(waitingUpTo: 0.0)?.type, .lost)
+
+        // Cameras are looked up on the discovery queue, whether or not the caller is already on it.
+        BasicSimulatedCameraConfiguration.defaultConfiguration().apply()
+        let discovery = BasicCameraDiscovery.sharedInstance()
+        let discoveryQueue = discovery.discoveryQueue
+        let handle: Int = try XCTUnwrap(discoveryQueue.sync(execute: { () -> Int? in
+            discovery.cameraDiscoveryProvider(SimulatedCameraDiscovery.shared, didDiscover: camera)
+            // Looking up from the discovery queue itself mustn't deadlock.
+            return discovery.visibleCameras.first(where: { $0.wrappedCamera === camera })?.handle
+        }))
+        XCTAssert(discovery.camera(withHandle: handle)?.wrappedCamera === camera)
+        XCTAssert(discoveryQueue.sync(execute: { discovery.camera(withHandle: handle)?.wrappedCamera === camera }))
+
+        discoveryQueue.sync(execute: { discovery.cameraDiscoveryProvider(SimulatedCameraDiscovery.shared, didLoseSightOf: camera) })
+        XCTAssertNil(discovery.camera(withHandle: handle))
+        XCTAssertEqual(discovery.droppedEventCount, discovery.events.droppedCount)
+    }
+
     func testCameraDiscoveryAndConnection() throws {
         let modelName = "Windows Camera"
 
@@ -112,6 +141,817 @@ class CameraTests: XCTestCase, CameraDiscoveryProviderDelegate {
         }
     }
 
+    func testPropertySetStatusUpdatesImmediately() throws {
+        let camera = try connectedSimulatedCamera()
+        let basicCamera = BasicCamera(wrapping: camera, handle: 1, callbackQueue: camera.configuration.internalCallbackQueue)
+        let property = basicCamera.property(with: .autoExposureMode)
+        XCTAssertEqual(property.setStatus, .idle)
+
+        // The status should reflect the request as soon as setValue returns, not once it reaches the camera's queue.
+        let manualValue = try XCTUnwrap(property.validSettableValues.first(where: {
+            $0.wrappedValue.commonValue == PropertyCommonValueAutoExposureMode.fullyManual.rawValue
+        }))
+        property.setValue(manualValue)
+        XCTAssertEqual(property.setStatus, .inProgress)
+        XCTAssertNil(property.lastSetErrorDescription)
+
+        let finished = expectation(for: NSPredicate(block: { _, _ in property.setStatus != .inProgress }), evaluatedWith: nil)
+        wait(for: [finished], timeout: 5.0)
+        XCTAssertEqual(property.setStatus, .succeeded)
+        XCTAssertEqual(camera.property(with: .autoExposureMode).currentValue?.commonValue,
+                       PropertyCommonValueAutoExposureMode.fullyManual.rawValue)
+    }
+
+    func testDependentPropertyValuesAreMemoisedAndOnlyNotifiedOnChange() throws {
+        // Each list is only created once per source value, and equal lists for other source values share its objects.
+        var cache = DependentPropertyValueCache()
+        var createCount: Int = 0
+        let create: () -> PropertyValuesWithSuggestedDefault? = {
+            createCount += 1
+            let values = [SimulatedPropertyValue(commonValue: 1, localizedDisplayValue: "One"),
+                          SimulatedPropertyValue(commonValue: 2, localizedDisplayValue: "Two")]
+            return PropertyValuesWithSuggestedDefault(defaultValue: values[1], validValues: values)
+        }
+        func values(in mode: PropertyCommonValueAutoExposureMode) throws -> PropertyValuesWithSuggestedDefault {
+            return try XCTUnwrap(cache.values(for: .aperture, sourceValue: mode.rawValue, create: create))
+        }
+        let manual = try values(in: .fullyManual)
+        let manualAgain = try values(in: .fullyManual)
+        XCTAssertEqual(createCount, 1)
+        XCTAssertTrue(manual.validValues?.first === manualAgain.validValues?.first)
+        let aperturePriority = try values(in: .aperturePriority)
+        XCTAssertEqual(createCount, 2)
+        XCTAssertTrue(manual.validValues?.first === aperturePriority.validValues?.first)
+        XCTAssertTrue(manual.defaultValue === aperturePriority.defaultValue)
+
+        // Manual and aperture priority modes have the same apertures, so only the first change should be noticed.
+        let camera = try connectedSimulatedCamera()
+        let notifications = PropertyNotificationCounter()
+        let observer = camera.property(with: .aperture).addObserver({ _, _ in notifications.increment() })
+        defer { observer.invalidate() }
+
+        func setAutoExposureMode(_ mode: PropertyCommonValueAutoExposureMode) throws {
+            let property = camera.property(with: .autoExposureMode)
+            let value = try XCTUnwrap(property.validSettableValues?.first(where: { $0.commonValue == mode.rawValue }))
+            let finished = expectation(description: "Set auto exposure mode")
+            property.setValue(value, completionQueue: .global()) { error in
+                XCTAssertNil(error)
+                finished.fulfill()
+            }
+            wait(for: [finished], timeout: 5.0)
+        }
+
+        try setAutoExposureMode(.fullyManual)
+        XCTAssertEqual(notifications.count, 1)
+        try setAutoExposureMode(.aperturePriority)
+        try setAutoExposureMode(.fullyManual)
+        XCTAssertEqual(notifications.count, 1)
+    }
+
+    func testLiveViewFrameCallbackIsGivenEachFrame() throws {
+        let camera = try connectedSimulatedCamera()
+        let basicCamera = BasicCamera(wrapping: camera, handle: 1, callbackQueue: camera.configuration.internalCallbackQueue)
+
+        // The callback is given its own reference to each frame, so frames stay readable after later ones arrive.
+        let collector = LiveViewFrameCollector()
+        basicCamera.setLiveViewFrameCallback(context: Unmanaged.passRetained(collector).toOpaque(), callback: { context, frame in
+            let collector = Unmanaged<LiveViewFrameCollector>.fromOpaque(context!).takeUnretainedValue()
+            collector.append(Unmanaged<BasicLiveViewFrame>.fromOpaque(frame).takeRetainedValue())
+        }, releaseContext: { context in
+            Unmanaged<LiveViewFrameCollector>.fromOpaque(context!).release()
+        })
+
+        basicCamera.beginLiveViewStream()
+        let gotFrames = expectation(for: NSPredicate(block: { _, _ in collector.frames.count >= 2 }), evaluatedWith: nil)
+        wait(for: [gotFrames], timeout: 5.0)
+        basicCamera.clearLiveViewFrameCallback()
+        basicCamera.endLiveViewStream()
+
+        let frames = collector.frames
+        XCTAssertFalse(frames[0] === frames[1])
+        XCTAssertGreaterThan(frames[0].rawPixelDataLength, 0)
+    }
+
+    func testCompletionCallbacksAreNotCalledInline() throws {
+        // Each completion waits for the code that triggered it to carry on, which would time out if it were called
+        // inline. Abandoned callbacks are completed from deinit, which mustn't call them inline either.
+        let completedRecorder = CompletionRecorder()
+        do {
+            let callback = completedRecorder.makeCallback()
+            callback.complete(succeeded: true)
+            callback.complete(succeeded: false)
+        }
+        completedRecorder.callerReturned.signal()
+
+        let abandonedRecorder = CompletionRecorder()
+        _ = abandonedRecorder.makeCallback()
+        abandonedRecorder.callerReturned.signal()
+
+        let delivered = expectation(for: NSPredicate(block: { _, _ in
+            completedRecorder.events.count == 2 && abandonedRecorder.events.count == 2
+        }), evaluatedWith: nil)
+        wait(for: [delivered], timeout: 5.0)
+        XCTAssertEqual(completedRecorder.events, ["completed: true", "released"])
+        XCTAssertEqual(abandonedRecorder.events, ["completed: false", "released"])
+    }
+
+    func testQueuePoolDoesNotLetASlowCameraDelayAnother() throws {
+        let pool = BasicQueuePool(label: "Test Worker", width: 2, qos: .default)
+        let slowCamera = pool.makeSerialQueue(label: "Slow Camera")
+        let fastCamera = pool.makeSerialQueue(label: "Fast Camera")
+
+        // Hold one of the pool's slots until the fast camera has done its work in the other. If the two cameras were
+        // pinned to the same worker, the fast camera's work would be stuck behind the slow camera's and the wait would
+        // time out.
+        let fastCameraFinished = DispatchSemaphore(value: 0)
+        let slowCameraFinished = expectation(description: "Slow camera finished")
+        slowCamera.async {
+            BasicQueuePool.performGated({
+                XCTAssertEqual(fastCameraFinished.wait(timeout: .now() + 5.0), .success)
+            })
+            slowCameraFinished.fulfill()
+        }
+        fastCamera.async { BasicQueuePool.performGated({ fastCameraFinished.signal() }) }
+        wait(for: [slowCameraFinished], timeout: 10.0)
+    }
+
+    func testMultipleCameraConfigurations() throws {
+        var config = SimulatedCameraConfiguration.default
+        config.liveViewImageFrames = (1...3).map({ URL(fileURLWithPath: "/Frame\($0).jpg") })
+        XCTAssertEqual(config.configuration(forCameraAt: 0).identifier, config.identifier)
+
+        config.cameraCount = 4
+        let cameraConfigs = (0..<config.cameraCount).map({ config.configuration(forCameraAt: $0) })
+        XCTAssertEqual(Set(cameraConfigs.map({ $0.identifier })).count, 4)
+        XCTAssertEqual(cameraConfigs[1].identifier, "\(config.identifier)-02")
+        XCTAssertEqual(cameraConfigs[1].liveViewImageFrames.first?.lastPathComponent, "Frame2.jpg")
+        XCTAssertEqual(cameraConfigs[3].liveViewImageFrames.first?.lastPathComponent, "Frame1.jpg")
+        XCTAssertEqual(cameraConfigs[2].liveViewImageFrames.count, 3)
+    }
+
+    func testQueuePoolKeepsPerCameraOrder() throws {
+        let pool = BasicQueuePool(label: "Test Worker", width: 1, qos: .default)
+        let shared = BasicQueuePool.shared(label: "Test Shared", width: 2, qos: .default)
+        XCTAssert(BasicQueuePool.shared(label: "Test Shared", width: 2, qos: .default) === shared)
+        XCTAssert(BasicQueuePool.shared(label: "Test Shared", width: 3, qos: .default) !== shared)
+
+        // Cameras sharing the pool's concurrent executor must still see their own work in order.
+        let cameraQueues = (0..<5).map({ pool.makeSerialQueue(label: "Camera \($0)") })
+        let lock = NSLock()
+        var seen: [[Int]] = Array(repeating: [], count: cameraQueues.count)
+        let group = DispatchGroup()
+        for step in 0..<20 {
+            for (index, queue) in cameraQueues.enumerated() {
+                queue.async(group: group) {
+                    lock.lock()
+                    seen[index].append(step)
+                    lock.unlock()
+                }
+            }
+        }
+
+        XCTAssertEqual(group.wait(timeout: .now() + 5.0), .success)
+        XCTAssert(seen.allSatisfy({ $0 == Array(0..<20) }))
+    }
+
+    func testQueuePoolLimitsGatedWorkToItsWidth() throws {
+        let pool = BasicQueuePool(label: "Test Worker", width: 2, qos: .default)
+        let cameraQueues = (0..<6).map({ pool.makeSerialQueue(label: "Camera \($0)") })
+        let lock = NSLock()
+        var running: Int = 0
+        var mostRunning: Int = 0
+        let group = DispatchGroup()
+        for queue in cameraQueues {
+            queue.async(group: group) {
+                BasicQueuePool.performGated({
+                    lock.lock()
+                    running += 1
+                    mostRunning = max(mostRunning, running)
+                    lock.unlock()
+                    Thread.sleep(forTimeInterval: 0.05)
+                    lock.lock()
+                    running -= 1
+                    lock.unlock()
+                })
+            }
+        }
+
+        XCTAssertEqual(group.wait(timeout: .now() + 5.0), .success)
+        XCTAssertLessThanOrEqual(mostRunning, 2)
+        XCTAssertGreaterThan(mostRunning, 0)
+
+        // Off the pool's queues, gated work isn't held up.
+        XCTAssertEqual(BasicQueuePool.performGated({ 42 }), 42)
+    }
+
+    func testDiscoveringMultipleCameras() throws {
+        final class Recorder: CameraDiscoveryProviderDelegate {
+            var discovered: [Camera] = []
+            var lost: [Camera] = []
+            func cameraDiscoveryProvider(_ provider: CameraDiscoveryProvider, didDiscover camera: Camera) { discovered.append(camera) }
+            func cameraDiscoveryProvider(_ provider: CameraDiscoveryProvider, didLoseSightOf camera: Camera) { lost.append(camera) }
+        }
+
+        var config = SimulatedCameraConfiguration.default
+        config.connectionAuthentication = .none
+        config.connectionSpeed = .instant
+        config.cameraCount = 3
+        // Not the main queue (the default), so the test can safely wait on it.
+        config.internalCallbackQueue = DispatchQueue(label: "Simulated Discovery Tests")
+
+        let discovery = SimulatedCameraDiscovery()
+        discovery.applyConfiguration(config)
+        let recorder = Recorder()
+        discovery.delegate = recorder
+        discovery.startDiscovery(in: .networkAndUSB, clientName: "Windows Test Runner")
+        let discovered = expectation(for: NSPredicate(block: { _, _ in
+            config.internalCallbackQueue.sync(execute: { recorder.discovered.count == 3 })
+        }), evaluatedWith: nil)
+        wait(for: [discovered], timeout: 5.0)
+
+        // Each camera should be distinct, and the default camera's numbering should build on its existing identifier.
+        let identifiers = recorder.discovered.compactMap({ $0.friendlyIdentifier })
+        XCTAssertEqual(identifiers, ["se.cascable.simulated-camera-01", "se.cascable.simulated-camera-02", "se.cascable.simulated-camera-03"])
+        XCTAssertEqual(Set(recorder.discovered.compactMap({ $0.deviceInfo?.serialNumber })).count, 3)
+        XCTAssertEqual(discovery.visibleCameras.count, 3)
+
+        // Stopping discovery loses sight of every camera, on the discovery queue.
+        discovery.stopDiscovery()
+        let lost = expectation(for: NSPredicate(block: { _, _ in
+            config.internalCallbackQueue.sync(execute: { recorder.lost.count == 3 })
+        }), evaluatedWith: nil)
+        wait(for: [lost], timeout: 5.0)
+        XCTAssert(config.internalCallbackQueue.sync(execute: { discovery.visibleCameras.isEmpty }))
+
+        // A single default camera keeps the identifier it has always had.
+        let singleConfig = SimulatedCameraConfiguration.default
+        XCTAssertEqual(SimulatedCamera(configuration: singleConfig, clientName: "Windows Test Runner", transport: .network).friendlyIdentifier,
+                       "se.cascable.simulated-camera")
+    }
+
+    func testImageCachePersistenceAndEviction() throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        func key(_ path: String) -> SimulatedCameraImageCache.Key {
+            return SimulatedCameraImageCache.Key(storageIdentifier: "Storage", path: path, size: 1000, date: nil)
+        }
+
+        let cache = try XCTUnwrap(SimulatedCameraImageCache(directory: directory, byteBudget: 1000))
+        cache.store(Data(repeating: 1, count: 400), as: .thumbnail, for: key("/A.JPG"))
+        cache.store(Data(repeating: 2, count: 400), as: .thumbnail, for: key("/B.JPG"))
+        XCTAssertEqual(cache.imageData(.thumbnail, for: key("/A.JPG")), Data(repeating: 1, count: 400))
+        XCTAssertNil(cache.imageData(.preview, for: key("/A.JPG")))
+
+        // Going over budget should evict B, since A was used more recently.
+        cache.store(Data(repeating: 3, count: 400), as: .thumbnail, for: key("/C.JPG"))
+        XCTAssertNil(cache.imageData(.thumbnail, for: key("/B.JPG")))
+
+        // The cache's contents, including the eviction, should survive being reopened.
+        let reopened = try XCTUnwrap(SimulatedCameraImageCache(directory: directory, byteBudget: 1000))
+        XCTAssertEqual(reopened.imageData(.thumbnail, for: key("/A.JPG")), Data(repeating: 1, count: 400))
+        XCTAssertNil(reopened.imageData(.thumbnail, for: key("/B.JPG")))
+        XCTAssertEqual(reopened.imageData(.thumbnail, for: key("/C.JPG")), Data(repeating: 3, count: 400))
+    }
+
+    func testImageCacheKeepsRecencyAndVerifiesKeys() throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        func key(_ path: String) -> SimulatedCameraImageCache.Key {
+            return SimulatedCameraImageCache.Key(storageIdentifier: "Storage", path: path, size: 1000, date: nil)
+        }
+
+        // Reading A after writing B should make B the one to go, even after the cache is reopened.
+        let cache = try XCTUnwrap(SimulatedCameraImageCache(directory: directory, byteBudget: 1000))
+        cache.store(Data(repeating: 1, count: 400), as: .thumbnail, for: key("/A.JPG"))
+        cache.store(Data(repeating: 2, count: 400), as: .thumbnail, for: key("/B.JPG"))
+        XCTAssertNotNil(cache.imageData(.thumbnail, for: key("/A.JPG")))
+
+        let reopened = try XCTUnwrap(SimulatedCameraImageCache(directory: directory, byteBudget: 1000))
+        reopened.store(Data(repeating: 3, count: 400), as: .thumbnail, for: key("/C.JPG"))
+        XCTAssertEqual(reopened.imageData(.thumbnail, for: key("/A.JPG")), Data(repeating: 1, count: 400))
+        XCTAssertNil(reopened.imageData(.thumbnail, for: key("/B.JPG")))
+
+        // A record whose stored key doesn't match the one asked for is a miss, even though the digest matches.
+        let packURL = directory.appendingPathComponent("Images.pack")
+        var pack = [UInt8](try Data(contentsOf: packURL))
+        let storedPath = Array("/C.JPG".utf8)
+        let pathIndex = try XCTUnwrap((0...(pack.count - storedPath.count)).first(where: { Array(pack[$0..<($0 + storedPath.count)]) == storedPath }))
+        pack[pathIndex + 1] = UInt8(ascii: "X")
+        try Data(pack).write(to: packURL)
+        let tampered = try XCTUnwrap(SimulatedCameraImageCache(directory: directory, byteBudget: 1000))
+        XCTAssertNil(tampered.imageData(.thumbnail, for: key("/C.JPG")))
+        XCTAssertEqual(tampered.imageData(.thumbnail, for: key("/A.JPG")), Data(repeating: 1, count: 400))
+
+        // The shared cache for a directory can't be opened with two different budgets.
+        let sharedDirectory = directory.appendingPathComponent("Shared")
+        let shared = try XCTUnwrap(SimulatedCameraImageCache.cache(in: sharedDirectory, byteBudget: 1000))
+        XCTAssert(SimulatedCameraImageCache.cache(in: sharedDirectory, byteBudget: 1000) === shared)
+        XCTAssertNil(SimulatedCameraImageCache.cache(in: sharedDirectory, byteBudget: 2000))
+    }
+
+    func testTransferQueueSequencingAndOverflow() throws {
+        let queue = BasicBoundedQueue<BasicCameraInitiatedTransferResult>(capacity: 2)
+        let source = SimulatedCameraInitiatedTransferResult(jpegFileUrl: URL(fileURLWithPath: "/nonexistent.jpg"))
+        for _ in 0..<3 {
+            queue.enqueue({ BasicCameraInitiatedTransferResult(wrapping: source, representation: .preview, sequenceNumber: $0,
+                                                               imageData: Data(), localPath: nil) })
+        }
+
+        // The oldest transfer should have been dropped to make room, leaving a visible gap in the sequence.
+        XCTAssertEqual(queue.receivedCount, 3)
+        XCTAssertEqual(queue.droppedCount, 1)
+        XCTAssertEqual(queue.dequeue(waitingUpTo: 0.0)?.sequenceNumber, 2)
+        XCTAssertEqual(queue.dequeue(waitingUpTo: 0.0)?.sequenceNumber, 3)
+        XCTAssertNil(queue.dequeue(waitingUpTo: 0.0))
+
+        // A blocked dequeue should wake up when a transfer arrives.
+        DispatchQueue.global().asyncAfter(deadline: .now() + 0.1) {
+            queue.enqueue({ BasicCameraInitiatedTransferResult(wrapping: source, representation: .preview, sequenceNumber: $0,
+                                                               imageData: Data(), localPath: nil) })
+        }
+        XCTAssertEqual(queue.dequeue(waitingUpTo: 5.0)?.sequenceNumber, 4)
+    }
+
+    func testTransferQueueClearingAndDroppedRequests() throws {
+        let queue = BasicBoundedQueue<BasicCameraInitiatedTransferResult>(capacity: 4)
+        let source = SimulatedCameraInitiatedTransferResult(jpegFileUrl: URL(fileURLWithPath: "/nonexistent.jpg"))
+        func enqueue(inGeneration generation: Int? = nil) {
+            queue.enqueue(inGeneration: generation, { BasicCameraInitiatedTransferResult(wrapping: source, representation: .preview,
+                                                                                          sequenceNumber: $0, imageData: Data(), localPath: nil) })
+        }
+
+        // Requests that are rejected outright count as dropped without using a sequence number.
+        queue.noteDropped()
+        XCTAssertEqual(queue.droppedCount, 1)
+        XCTAssertEqual(queue.receivedCount, 0)
+
+        // A transfer that started before the queue was cleared is dropped when it finishes, as are waiting ones.
+        let inFlightGeneration = queue.generation
+        enqueue()
+        enqueue()
+        queue.removeAll()
+        XCTAssertEqual(queue.pendingCount, 0)
+        XCTAssertEqual(queue.droppedCount, 3)
+        enqueue(inGeneration: inFlightGeneration)
+        XCTAssertEqual(queue.pendingCount, 0)
+        XCTAssertEqual(queue.droppedCount, 4)
+
+        // Transfers from the new generation are queued, and sequence numbers carry on.
+        enqueue(inGeneration: queue.generation)
+        XCTAssertEqual(queue.dequeue(waitingUpTo: 0.0)?.sequenceNumber, 3)
+        XCTAssertEqual(queue.receivedCount, 3)
+    }
+
+    func testTransferDestinationsAreReservedUntilWritten() throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directory) }
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        try Data(count: 1).write(to: directory.appendingPathComponent("IMG_0001.JPG"))
+
+        let camera = try connectedSimulatedCamera()
+        let basicCamera = BasicCamera(wrapping: camera, handle: 1, callbackQueue: camera.configuration.internalCallbackQueue)
+        let result = SimulatedCameraInitiatedTransferResult(jpegFileUrl: URL(fileURLWithPath: "/nonexistent.jpg"), fileNameHint: "IMG_0001.JPG")
+
+        // Neither write has started, so only the reservations keep the second transfer from reusing the first's name.
+        let (first, second, afterRelease) = basicCamera.queue.sync(execute: { () -> (URL, URL, URL) in
+            let first = basicCamera.reserveTransferDestination(for: result, representation: .preview, in: directory.path)
+            let second = basicCamera.reserveTransferDestination(for: result, representation: .preview, in: directory.path)
+            basicCamera.releaseTransferDestination(first)
+            let afterRelease = basicCamera.reserveTransferDestination(for: result, representation: .preview, in: directory.path)
+            return (first, second, afterRelease)
+        })
+
+        XCTAssertEqual(first.deletingPathExtension().lastPathComponent, "IMG_0001-1")
+        XCTAssertEqual(second.deletingPathExtension().lastPathComponent, "IMG_0001-2")
+        // Released names that were never written to are free again.
+        XCTAssertEqual(afterRelease, first)
+    }
+
+    func testSyntheticOriginalGeneration() throws {
+        let previewUrl = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString).appendingPathExtension("jpg")
+        let preview = Data([0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0xFF, 0xD9])
+        try preview.write(to: previewUrl)
+        defer { try? FileManager.default.removeItem(at: previewUrl) }
+
+        let byteCount = 3 * 1024 * 1024 + 5
+        let originalUrl = try XCTUnwrap(SimulatedSyntheticOriginal.fileUrl(basedOn: previewUrl, byteCount: byteCount))
+        defer { try? FileManager.default.removeItem(at: originalUrl) }
+
+        // The original should be the preview padded out to exactly the requested size, and be reused once generated.
+        let original = try Data(contentsOf: originalUrl)
+        XCTAssertEqual(original.count, byteCount)
+        XCTAssertEqual(original.prefix(preview.count), preview)
+        XCTAssertEqual(SimulatedSyntheticOriginal.fileUrl(basedOn: previewUrl, byteCount: byteCount), originalUrl)
+        XCTAssertNil(SimulatedSyntheticOriginal.fileUrl(basedOn: previewUrl, byteCount: 0))
+
+        // Asynchronous requests are answered in order, on the requested queue.
+        let completionQueue = DispatchQueue(label: "Synthetic original completions")
+        var answered: [URL?] = []
+        let finished = expectation(description: "Requests answered")
+        SimulatedSyntheticOriginal.fileUrl(basedOn: previewUrl, byteCount: byteCount, completionQueue: completionQueue, completionHandler: {
+            dispatchPrecondition(condition: .onQueue(completionQueue))
+            answered.append($0)
+        })
+        SimulatedSyntheticOriginal.fileUrl(basedOn: previewUrl, byteCount: 0, completionQueue: completionQueue, completionHandler: {
+            answered.append($0)
+            finished.fulfill()
+        })
+        wait(for: [finished], timeout: 5.0)
+        XCTAssertEqual(answered, [originalUrl, nil])
+    }
+
+    func testFileStreamReaderChunks() throws {
+        let fileUrl = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        let contents = Data((0..<10_000).map({ UInt8(truncatingIfNeeded: $0) }))
+        try contents.write(to: fileUrl)
+        defer { try? FileManager.default.removeItem(at: fileUrl) }
+
+        func readAll(from reader: SimulatedFileStreamReader) -> [(chunk: Data?, isLast: Bool)] {
+            var results: [(chunk: Data?, isLast: Bool)] = []
+            let semaphore = DispatchSemaphore(value: 0)
+            repeat {
+                reader.readNextChunk { chunk, isLast in
+                    results.append((chunk, isLast))
+                    semaphore.signal()
+                }
+                semaphore.wait()
+            } while results.last?.chunk != nil && results.last?.isLast == false
+            reader.close()
+            return results
+        }
+
+        let reader = try XCTUnwrap(SimulatedFileStreamReader(url: fileUrl, offset: 100, length: 9000, chunkSize: 4096))
+        XCTAssertEqual(reader.totalFileSize, 10_000)
+        XCTAssertEqual(reader.range, 100..<9100)
+
+        let results = readAll(from: reader)
+        XCTAssertEqual(results.map({ $0.chunk?.count }), [4096, 4096, 808])
+        XCTAssertEqual(results.map({ $0.isLast }), [false, false, true])
+        // Chunks are indexed from zero, even though they're views into the middle of the file.
+        XCTAssert(results.allSatisfy({ $0.chunk?.startIndex == 0 }))
+        // They're views of the mapping rather than copies of it, so consecutive chunks are next to each other in memory.
+        let addresses = results.compactMap({ $0.chunk?.withUnsafeBytes({ $0.baseAddress }) })
+        XCTAssertEqual(addresses.count, 3)
+        XCTAssertEqual(addresses[0].distance(to: addresses[1]), 4096)
+        XCTAssertEqual(results[1].chunk?[0], contents[100 + 4096])
+        XCTAssertEqual(Data(results.compactMap({ $0.chunk }).joined()), contents[100..<9100])
+
+        // A range starting past the end of the file is clamped to nothing.
+        let pastEnd = try XCTUnwrap(SimulatedFileStreamReader(url: fileUrl, offset: 20_000, chunkSize: 4096))
+        XCTAssertEqual(pastEnd.range.count, 0)
+        let pastEndResults = readAll(from: pastEnd)
+        XCTAssertEqual(pastEndResults.count, 1)
+        XCTAssertNil(pastEndResults[0].chunk)
+        XCTAssert(pastEndResults[0].isLast)
+
+        XCTAssertNil(SimulatedFileStreamReader(url: fileUrl.appendingPathExtension("missing"), chunkSize: 4096))
+    }
+
+    func testCatalogKeepsExistingItemsAcrossListings() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+        try FileManager.default.createDirectory(at: root.appendingPathComponent("DCIM/100CANON"), withIntermediateDirectories: true)
+        try FileManager.default.createDirectory(at: root.appendingPathComponent("MISC"), withIntermediateDirectories: true)
+        try Data(count: 10).write(to: root.appendingPathComponent("DCIM/100CANON/IMG_0001.JPG"))
+
+        let camera = try connectedSimulatedCamera(configuredWith: { $0.storageFileSystemRoot = root })
+        let storage = try XCTUnwrap(camera.storageDevices?.first as? SimulatedCameraStorage)
+        let rootFolder = try XCTUnwrap(storage.rootDirectory as? SimulatedCameraFolder)
+        let cataloged = expectation(for: NSPredicate(block: { _, _ in storage.catalogProgress?.isFinished ?? false }), evaluatedWith: nil)
+        wait(for: [cataloged], timeout: 5.0)
+
+        func child(named name: String, of folder: SimulatedCameraFolder) -> FileSystemItem? {
+            return folder.children?.first(where: { ($0 as? SimulatedCameraFolder)?.url.lastPathComponent == name ||
+                                                   ($0 as? SimulatedCameraFile)?.url.lastPathComponent == name })
+        }
+
+        let dcim = try XCTUnwrap(child(named: "DCIM", of: rootFolder) as? SimulatedCameraFolder)
+        let misc = try XCTUnwrap(child(named: "MISC", of: rootFolder) as? SimulatedCameraFolder)
+        XCTAssertNotNil(dcim.children?.first as? SimulatedCameraFolder)
+
+        // Change the card, then reload the root. The first load is answered by the catalog; the second lists again.
+        try FileManager.default.removeItem(at: root.appendingPathComponent("MISC"))
+        try Data(count: 10).write(to: root.appendingPathComponent("NEW.JPG"))
+        for _ in 0..<2 {
+            let loaded = expectation(description: "Children loaded")
+            rootFolder.loadChildren({ error in
+                XCTAssertNil(error)
+                loaded.fulfill()
+            })
+            wait(for: [loaded], timeout: 5.0)
+        }
+
+        // Items that are still there should be the same objects, so clients holding them stay attached to the tree.
+        XCTAssert(child(named: "DCIM", of: rootFolder) === dcim)
+        XCTAssertNotNil(dcim.children?.first as? SimulatedCameraFolder)
+        XCTAssertNotNil(child(named: "NEW.JPG", of: rootFolder))
+        XCTAssertNil(child(named: "MISC", of: rootFolder))
+        XCTAssert(misc.isDetached)
+        XCTAssertFalse(dcim.isDetached)
+
+        // A fresh catalog pass should only report the differences, without replacing anything.
+        var added: [String] = []
+        var removed: [String] = []
+        let observerToken = storage.addFileSystemObserver({ _, _, operation, items in
+            let names = (items ?? []).compactMap({ ($0 as? SimulatedCameraFile)?.url.lastPathComponent })
+            if operation == .filesAdded { added.append(contentsOf: names) } else { removed.append(contentsOf: names) }
+        })
+        try Data(count: 10).write(to: root.appendingPathComponent("DCIM/100CANON/IMG_0002.JPG"))
+        let recatalog = SimulatedCameraCatalog(storage: storage)
+        recatalog.start()
+        let recataloged = expectation(for: NSPredicate(block: { _, _ in recatalog.progress.isFinished }), evaluatedWith: nil)
+        wait(for: [recataloged], timeout: 5.0)
+        XCTAssertEqual(added, ["IMG_0002.JPG"])
+        XCTAssertEqual(removed, [])
+        XCTAssert(child(named: "DCIM", of: rootFolder) === dcim)
+
+        // Disconnecting should drop observers.
+        let disconnected = expectation(description: "Disconnected")
+        camera.disconnect({ _ in disconnected.fulfill() }, callbackQueue: .main)
+        wait(for: [disconnected], timeout: 5.0)
+        let invalidated = expectation(for: NSPredicate(block: { _, _ in storage.fileSystemObserverCount == 0 }), evaluatedWith: nil)
+        wait(for: [invalidated], timeout: 5.0)
+        storage.removeFileSystemObserver(withToken: observerToken)
+    }
+
+    func testStorageRelativePathsAndHashing() throws {
+        let camera = try connectedSimulatedCamera()
+
+        let rootStorage = SimulatedCameraStorage(camera: camera, rootFolder: URL(fileURLWithPath: "/"))
+        XCTAssertEqual(rootStorage.relativePath(for: URL(fileURLWithPath: "/")), "")
+        XCTAssertEqual(rootStorage.relativePath(for: URL(fileURLWithPath: "/DCIM/100CANON")), "/DCIM/100CANON")
+
+        let cardStorage = SimulatedCameraStorage(camera: camera, rootFolder: URL(fileURLWithPath: "/Volumes/Card 1", isDirectory: true))
+        XCTAssertEqual(cardStorage.relativePath(for: URL(fileURLWithPath: "/Volumes/Card 1/")), "")
+        XCTAssertEqual(cardStorage.relativePath(for: URL(fileURLWithPath: "/Volumes/Card 1/DCIM/IMG_0001.JPG")), "/DCIM/IMG_0001.JPG")
+        XCTAssertEqual(cardStorage.relativePath(for: URL(fileURLWithPath: "/Volumes/Card 1/DCIM/../MISC")), "/MISC")
+        // A sibling that shares the root's name as a prefix isn't inside it.
+        XCTAssertEqual(cardStorage.relativePath(for: URL(fileURLWithPath: "/Volumes/Card 10/DCIM")), "/Volumes/Card 10/DCIM")
+
+        // Published FNV-1a 64 test vectors.
+        XCTAssertEqual(FNV1aHash.hash(""), 0xcbf29ce484222325)
+        XCTAssertEqual(FNV1aHash.hash("a"), 0xaf63dc4c8601ec8c)
+        XCTAssertEqual(FNV1aHash.hash("foobar"), 0x85944171f73967e8)
+        XCTAssertEqual(FNV1aHash.hexString("a"), "af63dc4c8601ec8c")
+    }
+
+    func testStorageSnapshotNoticesFilesChangedInPlace() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        let indexDirectory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer {
+            try? FileManager.default.removeItem(at: root)
+            try? FileManager.default.removeItem(at: indexDirectory)
+        }
+        let imageUrl = root.appendingPathComponent("DCIM/IMG_0001.JPG")
+        try FileManager.default.createDirectory(at: imageUrl.deletingLastPathComponent(), withIntermediateDirectories: true)
+        try Data(count: 10).write(to: imageUrl)
+
+        func connectAndCatalog() throws -> (SimulatedCamera, SimulatedCameraStorage) {
+            let camera = try connectedSimulatedCamera(configuredWith: {
+                $0.storageFileSystemRoot = root
+                $0.storageIndexDirectory = indexDirectory
+            })
+            let storage = try XCTUnwrap(camera.storageDevices?.first as? SimulatedCameraStorage)
+            let cataloged = expectation(for: NSPredicate(block: { _, _ in storage.catalogProgress?.isFinished ?? false }), evaluatedWith: nil)
+            wait(for: [cataloged], timeout: 5.0)
+            return (camera, storage)
+        }
+
+        func disconnect(_ camera: SimulatedCamera) {
+            let disconnected = expectation(description: "Disconnected")
+            camera.disconnect({ _ in disconnected.fulfill() }, callbackQueue: .main)
+            wait(for: [disconnected], timeout: 5.0)
+        }
+
+        func imageFile(in storage: SimulatedCameraStorage) -> SimulatedCameraFile? {
+            let dcim = (storage.rootDirectory as? SimulatedCameraFolder)?.children?.first as? SimulatedCameraFolder
+            return dcim?.children?.first as? SimulatedCameraFile
+        }
+
+        let (firstCamera, firstStorage) = try connectAndCatalog()
+        XCTAssertEqual(imageFile(in: firstStorage)?.size, 10)
+        let snapshotUrl = SimulatedStorageSnapshot.url(forStorageIdentifier: firstStorage.cacheIdentifier, in: indexDirectory)
+        disconnect(firstCamera)
+        let written = expectation(for: NSPredicate(block: { _, _ in SimulatedStorageSnapshot.load(from: snapshotUrl) != nil }), evaluatedWith: nil)
+        wait(for: [written], timeout: 5.0)
+        let snapshot = try XCTUnwrap(SimulatedStorageSnapshot.load(from: snapshotUrl))
+        XCTAssertEqual(snapshot.directories["/DCIM"]?.entries.first?.size, 10)
+        XCTAssertNotNil(snapshot.directories["/DCIM"]?.entries.first?.modificationDate)
+
+        // Growing the file in place leaves its directory's modification date alone.
+        let directoryDate = SimulatedStorageSnapshot.modificationDate(ofDirectoryAt: imageUrl.deletingLastPathComponent())
+        let handle = try FileHandle(forWritingTo: imageUrl)
+        handle.seekToEndOfFile()
+        handle.write(Data(count: 20))
+        handle.closeFile()
+        XCTAssertEqual(SimulatedStorageSnapshot.modificationDate(ofDirectoryAt: imageUrl.deletingLastPathComponent()), directoryDate)
+
+        let (secondCamera, secondStorage) = try connectAndCatalog()
+        XCTAssertEqual(imageFile(in: secondStorage)?.size, 30)
+        disconnect(secondCamera)
+    }
+
+    func testFolderListingRecordsAndLargeSizes() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+        try FileManager.default.createDirectory(at: root.appendingPathComponent("DCIM"), withIntermediateDirectories: true)
+        // A sparse file, so it doesn't actually take up disk space but is bigger than a 32-bit int can describe.
+        let largeSize: UInt64 = 5 * 1024 * 1024 * 1024
+        let largeUrl = root.appendingPathComponent("MVI_0001.MOV")
+        FileManager.default.createFile(atPath: largeUrl.path, contents: nil)
+        let handle = try FileHandle(forWritingTo: largeUrl)
+        handle.truncateFile(atOffset: largeSize)
+        handle.closeFile()
+        try Data(count: 10).write(to: root.appendingPathComponent("Ünïcödé.JPG"))
+
+        let camera = try connectedSimulatedCamera(configuredWith: { $0.storageFileSystemRoot = root })
+        let storage = try XCTUnwrap(camera.storageDevices?.first as? SimulatedCameraStorage)
+        let cataloged = expectation(for: NSPredicate(block: { _, _ in storage.catalogProgress?.isFinished ?? false }), evaluatedWith: nil)
+        wait(for: [cataloged], timeout: 5.0)
+
+        let basicStorage = BasicFileStorage(wrapping: storage, queue: camera.configuration.internalCallbackQueue)
+        XCTAssertEqual(UInt64(basicStorage.capacity), storage.capacity)
+        XCTAssertEqual(UInt64(basicStorage.availableSpace), storage.availableSpace)
+
+        let listing = basicStorage.rootFolder.listing()
+        XCTAssertEqual(listing.count, 3)
+        var records = [UInt8](repeating: 0xFF, count: listing.recordBufferLength)
+        records.withUnsafeMutableBufferPointer({ listing.copyRecords(into: $0.baseAddress!) })
+        let recordBuffer = listing.recordBuffer
+        XCTAssertEqual(Data(records), Data(bytes: try XCTUnwrap(recordBuffer.bytes), count: recordBuffer.count))
+        // The buffer is built once, so repeated reads hand out the same bytes rather than a fresh copy.
+        XCTAssertTrue(listing.recordBuffer === recordBuffer)
+        XCTAssertEqual(listing.recordBuffer.bytes, recordBuffer.bytes)
+
+        func value<T: FixedWidthInteger>(_: T.Type, at offset: Int) -> T {
+            return records[offset..<(offset + MemoryLayout<T>.size)].reversed().reduce(0, { ($0 << 8) | T($1) })
+        }
+
+        var entries: [String: (size: UInt64, flags: UInt32, handle: Int)] = [:]
+        for index in 0..<listing.count {
+            let recordOffset = index * listing.recordStride
+            let nameOffset = Int(value(UInt32.self, at: recordOffset + 16))
+            let nameLength = Int(value(UInt32.self, at: recordOffset + 20))
+            XCTAssertEqual(records[nameOffset + nameLength], 0)
+            let name = try XCTUnwrap(String(bytes: records[nameOffset..<(nameOffset + nameLength)], encoding: .utf8))
+            entries[name] = (value(UInt64.self, at: recordOffset), value(UInt32.self, at: recordOffset + 24),
+                             Int(value(UInt32.self, at: recordOffset + 28)))
+        }
+
+        XCTAssertEqual(Set(entries.keys), ["DCIM", "MVI_0001.MOV", "Ünïcödé.JPG"])
+        XCTAssertEqual(entries["DCIM"]?.flags, UInt32(BasicFolderListingFlags.folder.rawValue))
+        XCTAssertEqual(entries["Ünïcödé.JPG"]?.size, 10)
+        XCTAssertEqual(entries["MVI_0001.MOV"]?.size, largeSize)
+
+        // Handles resolve back to the right kind of item, with sizes that don't get truncated to 32 bits.
+        let movie = try XCTUnwrap(listing.item(withHandle: try XCTUnwrap(entries["MVI_0001.MOV"]?.handle)))
+        XCTAssertEqual(movie.size, Int64(largeSize))
+        XCTAssertNil(listing.folder(withHandle: try XCTUnwrap(entries["MVI_0001.MOV"]?.handle)))
+        XCTAssertNotNil(listing.folder(withHandle: try XCTUnwrap(entries["DCIM"]?.handle)))
+        XCTAssertNil(listing.item(withHandle: listing.count))
+    }
+
+    func testFileTransferRangesAndFolders() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+        try FileManager.default.createDirectory(at: root.appendingPathComponent("DCIM"), withIntermediateDirectories: true)
+        let contents = Data((0..<10_000).map({ UInt8(truncatingIfNeeded: $0) }))
+        try contents.write(to: root.appendingPathComponent("IMG_0001.JPG"))
+
+        let camera = try connectedSimulatedCamera(configuredWith: { $0.storageFileSystemRoot = root })
+        let storage = try XCTUnwrap(camera.storageDevices?.first as? SimulatedCameraStorage)
+        let rootFolder = try XCTUnwrap(storage.rootDirectory as? SimulatedCameraFolder)
+        let cataloged = expectation(for: NSPredicate(block: { _, _ in storage.catalogProgress?.isFinished ?? false }), evaluatedWith: nil)
+        wait(for: [cataloged], timeout: 5.0)
+
+        let queue = camera.configuration.internalCallbackQueue
+        let file = BasicFileSystemItem(wrapping: try XCTUnwrap(rootFolder.children?.first(where: { $0 is SimulatedCameraFile })), queue: queue)
+        let folder = BasicFileSystemItem(wrapping: try XCTUnwrap(rootFolder.children?.first(where: { $0 is SimulatedCameraFolder })), queue: queue)
+        let localFolder = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try FileManager.default.createDirectory(at: localFolder, withIntermediateDirectories: true)
+        defer { try? FileManager.default.removeItem(at: localFolder) }
+        let localPath = localFolder.appendingPathComponent("Transfer.JPG").path
+
+        // Ranges land at the same offset in the local file.
+        let transfer = file.beginTransfer(toPath: localPath, fromOffset: 4000, length: 3000)
+        let finished = expectation(for: NSPredicate(block: { _, _ in transfer.state != .inProgress }), evaluatedWith: nil)
+        wait(for: [finished], timeout: 5.0)
+        XCTAssertEqual(transfer.state, .completed)
+        XCTAssertEqual(transfer.totalFileSize, 10_000)
+        XCTAssertEqual(transfer.rangeStart, 4000)
+        XCTAssertEqual(transfer.rangeLength, 3000)
+        XCTAssertEqual(transfer.bytesTransferred, 3000)
+        let written = try Data(contentsOf: URL(fileURLWithPath: localPath))
+        XCTAssertEqual(written.count, 7000)
+        XCTAssertEqual(written.suffix(3000), contents[4000..<7000])
+
+        // Folders fail straight away, without leaving a file behind.
+        let folderPath = localFolder.appendingPathComponent("Folder.JPG").path
+        let folderTransfer = folder.beginTransfer(toPath: folderPath, fromOffset: 0, length: 0)
+        XCTAssertEqual(folderTransfer.state, .failed)
+        XCTAssertNotNil(folderTransfer.errorDescription)
+        XCTAssertFalse(FileManager.default.fileExists(atPath: folderPath))
+    }
+
+    func testFileDownloadManagerKeepsDestinationsApart() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+        for (folder, byte) in [("100CANON", UInt8(1)), ("101CANON", UInt8(2))] {
+            try FileManager.default.createDirectory(at: root.appendingPathComponent("DCIM/\(folder)"), withIntermediateDirectories: true)
+            try Data(repeating: byte, count: 100).write(to: root.appendingPathComponent("DCIM/\(folder)/IMG_0001.JPG"))
+        }
+
+        let camera = try connectedSimulatedCamera(configuredWith: { $0.storageFileSystemRoot = root })
+        let storage = try XCTUnwrap(camera.storageDevices?.first as? SimulatedCameraStorage)
+        let cataloged = expectation(for: NSPredicate(block: { _, _ in storage.catalogProgress?.isFinished ?? false }), evaluatedWith: nil)
+        wait(for: [cataloged], timeout: 5.0)
+
+        func child(named name: String, of folder: FileSystemFolderItem?) -> FileSystemItem? {
+            return folder?.children?.first(where: { $0.name == name })
+        }
+        let dcim = child(named: "DCIM", of: storage.rootDirectory) as? FileSystemFolderItem
+        let first = try XCTUnwrap(child(named: "IMG_0001.JPG", of: child(named: "100CANON", of: dcim) as? FileSystemFolderItem))
+        let second = try XCTUnwrap(child(named: "IMG_0001.JPG", of: child(named: "101CANON", of: dcim) as? FileSystemFolderItem))
+
+        // Same-named files from different folders, plus the same file twice, should all end up in different places.
+        let destination = root.appendingPathComponent("Downloads")
+        let manager = FileDownloadManager()
+        let finished = expectation(description: "Downloads finished")
+        finished.expectedFulfillmentCount = 3
+        manager.enqueue([first, second, first], kind: .file(destination: destination), priority: .backgroundOffload,
+                        completion: { _, error, _ in
+            XCTAssertNil(error)
+            finished.fulfill()
+        })
+        wait(for: [finished], timeout: 5.0)
+
+        XCTAssertEqual(try Data(contentsOf: destination.appendingPathComponent("DCIM/100CANON/IMG_0001.JPG")), Data(repeating: 1, count: 100))
+        XCTAssertEqual(try Data(contentsOf: destination.appendingPathComponent("DCIM/101CANON/IMG_0001.JPG")), Data(repeating: 2, count: 100))
+        XCTAssertEqual(try Data(contentsOf: destination.appendingPathComponent("DCIM/100CANON/IMG_0001 2.JPG")), Data(repeating: 1, count: 100))
+    }
+
+    func testFileDownloadManagerCancelsInFlightThumbnails() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+        try FileManager.default.createDirectory(at: root, withIntermediateDirectories: true)
+        try Data(repeating: 1, count: 100).write(to: root.appendingPathComponent("IMG_0001.JPG"))
+
+        // Thumbnails take a second to arrive, which gives us time to cancel one that the camera is working on.
+        let camera = try connectedSimulatedCamera(configuredWith: {
+            $0.storageFileSystemRoot = root
+            $0.connectionSpeed = SimulatedConnectionSpeed(small: 0.0, medium: 1.0, large: 0.0)
+        })
+        let storage = try XCTUnwrap(camera.storageDevices?.first as? SimulatedCameraStorage)
+        let cataloged = expectation(for: NSPredicate(block: { _, _ in storage.catalogProgress?.isFinished ?? false }), evaluatedWith: nil)
+        wait(for: [cataloged], timeout: 10.0)
+        let item = try XCTUnwrap(storage.rootDirectory.children?.first)
+
+        let manager = FileDownloadManager()
+        let cancelled = expectation(description: "Request cancelled")
+        let request = try XCTUnwrap(manager.enqueue([item], kind: .thumbnail, priority: .userRequested, completion: { _, error, data in
+            XCTAssertEqual((error as NSError?)?.code, Int(CascableCoreErrorCode.cancelledByUser.rawValue))
+            XCTAssertNil(data)
+            cancelled.fulfill()
+        }).first)
+        XCTAssertEqual(request.state, .inProgress)
+        Thread.sleep(forTimeInterval: 0.1)
+
+        // The request should finish straight away, without waiting for the camera, and only once.
+        manager.cancel(request)
+        wait(for: [cancelled], timeout: 0.5)
+        XCTAssertEqual(request.state, .cancelled)
+
+        // The camera is still busy with it, though, so it should hold its slot until the thumbnail arrives.
+        XCTAssertEqual(manager.statistics.inProgressCount, 1)
+        let slotReleased = expectation(for: NSPredicate(block: { _, _ in manager.statistics.inProgressCount == 0 }), evaluatedWith: nil)
+        wait(for: [slotReleased], timeout: 5.0)
+        XCTAssertEqual(manager.statistics.failedCount, 1)
+    }
+
+    /// Creates a simulated camera with the given configuration and connects to it, bypassing discovery.
+    func connectedSimulatedCamera(configuredWith configure: (inout SimulatedCameraConfiguration) -> Void = { _ in }) throws -> SimulatedCamera {
+        var config = SimulatedCameraConfiguration.default
+        config.connectionAuthentication = .none
+        config.connectionSpeed = .instant
+        configure(&config)
+
+        let camera = SimulatedCamera(configuration: config, clientName: "Windows Test Runner", transport: .network)
+        let connectedToCameraExpectation = XCTestExpectation(description: "Connected to camera")
+        camera.connect(authenticationRequestCallback: { _ in
+            XCTFail("Camera was configured for no auth, but we got an auth request!")
+        }, authenticationResolvedCallback: {
+        }, completionCallback: { error, _ in
+            XCTAssertNil(error)
+            connectedToCameraExpectation.fulfill()
+        })
+
+        wait(for: [connectedToCameraExpectation], timeout: 5.0)
+        XCTAssert(camera.connectionState == .connected)
+        return camera
+    }
+
     /// Inform CascableCore that a new camera has been discovered.
     ///
     /// This method must be called on the main queue/thread.
@@ -133,3 +973,66 @@ class CameraTests: XCTestCase, CameraDiscoveryProviderDelegate {
 
     }
 }
+
+/// Collects the live view frames given to a callback registered through the C function pointer API.
+private final class LiveViewFrameCollector {
+    private let lock = NSLock()
+    private var _frames: [BasicLiveViewFrame] = []
+
+    var frames: [BasicLiveViewFrame] {
+        lock.lock()
+        defer { lock.unlock() }
+        return _frames
+    }
+
+    func append(_ frame: BasicLiveViewFrame) {
+        lock.lock()
+        _frames.append(frame)
+        lock.unlock()
+    }
+}
+
+private final class CompletionRecorder {
+    let callerReturned = DispatchSemaphore(value: 0)
+    private let lock = NSLock()
+    private var _events: [String] = []
+
+    var events: [String] {
+        lock.lock()
+        defer { lock.unlock() }
+        return _events
+    }
+
+    func record(_ event: String) {
+        lock.lock()
+        _events.append(event)
+        lock.unlock()
+    }
+
+    func makeCallback() -> BasicCompletionCallback {
+        return BasicCompletionCallback(context: Unmanaged.passRetained(self).toOpaque(), completion: { context, succeeded in
+            let recorder = Unmanaged<CompletionRecorder>.fromOpaque(context!).takeUnretainedValue()
+            let calledInline = (recorder.callerReturned.wait(timeout: .now() + 2.0) == .timedOut)
+            recorder.record(calledInline ? "called inline" : "completed: \(succeeded)")
+        }, releaseContext: { context in
+            Unmanaged<CompletionRecorder>.fromOpaque(context!).takeRetainedValue().record("released")
+        })
+    }
+}
+
+private final class PropertyNotificationCounter {
+    private let lock = NSLock()
+    private var _count: Int = 0
+
+    var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return _count
+    }
+
+    func increment() {
+        lock.lock()
+        _count += 1
+        lock.unlock()
+    }
+}
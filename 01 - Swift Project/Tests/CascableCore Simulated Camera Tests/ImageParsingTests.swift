@@ -0,0 +1,365 @@
+import Foundation
+import XCTest
+@testable import CascableCoreSimulatedCamera
+
+class ImageParsingTests: XCTestCase {
+
+    // MARK: - TIFFReader
+
+    func testTIFFReaderReadsDirectoriesAndValues() throws {
+        var tiff = TIFFFixture()
+        let make = tiff.append(Array("Cascable\u{0}".utf8))
+        let exposureTime = tiff.append(rational: 1, 250)
+        let ifd0 = tiff.appendDirectory([
+            (tag: 0x010F, type: 2, count: 9, value: UInt32(make)),
+            (tag: 0x0112, type: 3, count: 1, value: 6),
+            (tag: 0x829A, type: 5, count: 1, value: UInt32(exposureTime))
+        ])
+        tiff.setFirstDirectory(ifd0)
+
+        let reader = try XCTUnwrap(TIFFReader(source: try source(containing: tiff.bytes), base: 0))
+        XCTAssertFalse(reader.isBigEndian)
+        let directory = try XCTUnwrap(reader.directory(at: reader.firstIFDOffset))
+        XCTAssertEqual(directory.entries.map({ $0.tag }), [0x010F, 0x0112, 0x829A])
+        XCTAssertNil(directory.nextIFDOffset)
+        XCTAssertEqual(reader.stringValue(of: directory.entries[0]), "Cascable")
+        XCTAssertEqual(reader.integerValues(of: directory.entries[1]), [6])
+        XCTAssertEqual(reader.rationalValues(of: directory.entries[2]), [1.0 / 250.0])
+
+        // The same directory, big-endian, with its value stored inline.
+        let bigEndian: [UInt8] = [0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08,
+                                  0x00, 0x01, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00,
+                                  0x00, 0x00, 0x00, 0x00]
+        let bigEndianReader = try XCTUnwrap(TIFFReader(source: try source(containing: bigEndian), base: 0))
+        XCTAssert(bigEndianReader.isBigEndian)
+        let bigEndianDirectory = try XCTUnwrap(bigEndianReader.directory(at: bigEndianReader.firstIFDOffset))
+        XCTAssertEqual(bigEndianReader.integerValues(of: try XCTUnwrap(bigEndianDirectory.entries.first)), [6])
+    }
+
+    func testTIFFReaderRejectsMalformedData() throws {
+        // Truncated and unrecognised headers.
+        XCTAssertNil(TIFFReader(source: try source(containing: [0x49, 0x49, 0x2A, 0x00]), base: 0))
+        XCTAssertNil(TIFFReader(source: try source(containing: [0x49, 0x49, 0x2B, 0x00, 0x08, 0x00, 0x00, 0x00]), base: 0))
+        XCTAssertNil(TIFFReader(source: try source(containing: [0x50, 0x4B, 0x2A, 0x00, 0x08, 0x00, 0x00, 0x00]), base: 0))
+
+        // An IFD offset past the end of the file.
+        var outOfRange = TIFFFixture()
+        outOfRange.setFirstDirectory(0xFFFFFF00)
+        let outOfRangeReader = try XCTUnwrap(TIFFReader(source: try source(containing: outOfRange.bytes), base: 0))
+        XCTAssertNil(outOfRangeReader.directory(at: outOfRangeReader.firstIFDOffset))
+
+        // An IFD whose entries run off the end of the file.
+        var truncated = TIFFFixture()
+        let directory = truncated.appendDirectory([(tag: 0x0112, type: 3, count: 1, value: 6),
+                                                   (tag: 0x0112, type: 3, count: 1, value: 6)])
+        truncated.setFirstDirectory(directory)
+        let truncatedReader = try XCTUnwrap(TIFFReader(source: try source(containing: Array(truncated.bytes.dropLast(6))), base: 0))
+        XCTAssertNil(truncatedReader.directory(at: truncatedReader.firstIFDOffset))
+
+        // Out-of-line values that point past the end of the file, or claim to be enormous.
+        var badValues = TIFFFixture()
+        let badDirectory = badValues.appendDirectory([
+            (tag: 0x010F, type: 2, count: 20, value: 0x7FFFFFFF),
+            (tag: 0x0111, type: 4, count: 3, value: 0x7FFFFFFF),
+            (tag: 0x829A, type: 5, count: 1, value: 0xFFFFFFF0),
+            (tag: 0x0110, type: 2, count: 0xFFFFFFFF, value: 8),
+            (tag: 0x0117, type: 4, count: 0xFFFFFFFF, value: 8)
+        ])
+        badValues.setFirstDirectory(badDirectory)
+        let badReader = try XCTUnwrap(TIFFReader(source: try source(containing: badValues.bytes), base: 0))
+        let entries = try XCTUnwrap(badReader.directory(at: badReader.firstIFDOffset)).entries
+        XCTAssertNil(badReader.stringValue(of: entries[0]))
+        XCTAssertEqual(badReader.integerValues(of: entries[1]), [])
+        XCTAssertEqual(badReader.rationalValues(of: entries[2]), [])
+        XCTAssertNil(badReader.stringValue(of: entries[3]))
+        XCTAssertNil(badReader.rawValue(of: entries[4]))
+        XCTAssertEqual(badReader.integerValues(of: entries[4]), [])
+    }
+
+    func testEXIFReaderSkipsBrokenJPEGSegments() throws {
+        // A zero-length segment sends the scan into the next segment's payload, which isn't a marker.
+        let zeroLength: [UInt8] = [0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD9]
+        XCTAssertNil(TIFFReader.exifReader(inJPEGAt: 0, of: try source(containing: zeroLength)))
+
+        // An APP1 segment that runs off the end of the file.
+        let truncated: [UInt8] = [0xFF, 0xD8, 0xFF, 0xE1, 0x10, 0x00] + Array("Exif".utf8)
+        XCTAssertNil(TIFFReader.exifReader(inJPEGAt: 0, of: try source(containing: truncated)))
+
+        // More (empty) segments than the scan will look through before the EXIF block.
+        let emptySegments: [UInt8] = Array(repeating: [0xFF, 0xE0, 0x00, 0x02], count: 100).flatMap({ $0 })
+        let exif = exifSegment(containing: tiffWithThumbnail(ImageParsingTests.jpeg(payloadLength: 10)))
+        let manySegments: [UInt8] = [0xFF, 0xD8] + emptySegments + exif
+        XCTAssertNil(TIFFReader.exifReader(inJPEGAt: 0, of: try source(containing: manySegments)))
+    }
+
+    // MARK: - EmbeddedImageExtractor
+
+    func testEmbeddedImageExtractorFindsThumbnailAndPreview() throws {
+        let thumbnail = ImageParsingTests.jpeg(payloadLength: 20)
+        let preview = ImageParsingTests.jpeg(payloadLength: 200)
+        let raw = rawFixture(thumbnail: thumbnail, preview: preview)
+
+        let rawURL = try file(containing: raw.bytes)
+        XCTAssertEqual(EmbeddedImageExtractor.embeddedJPEG(.thumbnail, inImageAt: rawURL), Data(thumbnail))
+        XCTAssertEqual(EmbeddedImageExtractor.embeddedJPEG(.preview, inImageAt: rawURL), Data(preview))
+
+        // A JPEG's thumbnail lives in its EXIF block, with offsets relative to the block. The JPEG is its own preview.
+        let jpegFile: [UInt8] = [0xFF, 0xD8] + exifSegment(containing: tiffWithThumbnail(thumbnail)) +
+            Array(ImageParsingTests.jpeg(payloadLength: 500).dropFirst(2))
+        let jpegURL = try file(containing: jpegFile)
+        XCTAssertEqual(EmbeddedImageExtractor.embeddedJPEG(.thumbnail, inImageAt: jpegURL), Data(thumbnail))
+        XCTAssertEqual(EmbeddedImageExtractor.embeddedJPEG(.preview, inImageAt: jpegURL), Data(jpegFile))
+
+        // Raw image data stored as lossless JPEG isn't something we can show.
+        let lossless = rawFixture(thumbnail: thumbnail, preview: ImageParsingTests.jpeg(payloadLength: 200, frameMarker: 0xC3))
+        XCTAssertEqual(EmbeddedImageExtractor.embeddedJPEG(.preview, inImageAt: try file(containing: lossless.bytes)), Data(thumbnail))
+    }
+
+    func testEmbeddedImageExtractorSurvivesMalformedFiles() throws {
+        let thumbnail = ImageParsingTests.jpeg(payloadLength: 20)
+        let preview = ImageParsingTests.jpeg(payloadLength: 200)
+
+        // IFDs that point back at themselves and each other.
+        var loops = rawFixture(thumbnail: thumbnail, preview: preview)
+        loops.tiff.setNextDirectory(of: loops.ifd0, to: loops.ifd0)
+        loops.tiff.setNextDirectory(of: loops.subIFD, to: loops.ifd0)
+        let loopsURL = try file(containing: loops.bytes)
+        XCTAssertEqual(EmbeddedImageExtractor.embeddedJPEG(.thumbnail, inImageAt: loopsURL), Data(thumbnail))
+        XCTAssertEqual(EmbeddedImageExtractor.embeddedJPEG(.preview, inImageAt: loopsURL), Data(preview))
+
+        // Images and IFDs that are out of range are ignored.
+        var outOfRange = TIFFFixture()
+        let subIFDs = outOfRange.append(uint32s: [0xFFFFFF00, 0x7FFFFFFF])
+        let outOfRangeIFD = outOfRange.appendDirectory([
+            (tag: TIFFReader.Tag.jpegInterchangeFormat, type: 4, count: 1, value: 0xFFFFFF00),
+            (tag: TIFFReader.Tag.jpegInterchangeFormatLength, type: 4, count: 1, value: 0x100),
+            (tag: TIFFReader.Tag.subIFDs, type: 4, count: 2, value: UInt32(subIFDs))
+        ], next: 0xFFFFFFF0)
+        outOfRange.setFirstDirectory(outOfRangeIFD)
+        let outOfRangeURL = try file(containing: outOfRange.bytes)
+        XCTAssertNil(EmbeddedImageExtractor.embeddedJPEG(.thumbnail, inImageAt: outOfRangeURL))
+        XCTAssertNil(EmbeddedImageExtractor.embeddedJPEG(.preview, inImageAt: outOfRangeURL))
+
+        // Wherever the file is cut off, we should get one of the intact images or nothing.
+        let raw = rawFixture(thumbnail: thumbnail, preview: preview).bytes
+        for length in 0..<raw.count {
+            let url = try file(containing: Array(raw.prefix(length)))
+            for kind in [EmbeddedImageExtractor.Kind.thumbnail, .preview] {
+                let image = EmbeddedImageExtractor.embeddedJPEG(kind, inImageAt: url)
+                XCTAssert(image == nil || image == Data(thumbnail) || image == Data(preview), "Bad \(kind) for length \(length)")
+            }
+        }
+    }
+
+    // MARK: - EXIFMetadataParser
+
+    func testEXIFMetadataParserReadsJPEGAndRAWMetadata() throws {
+        let tiff = metadataFixture()
+        let jpegFile: [UInt8] = [0xFF, 0xD8] + exifSegment(containing: tiff.bytes) +
+            Array(ImageParsingTests.jpeg(payloadLength: 500).dropFirst(2))
+
+        for url in [try file(containing: jpegFile), try file(containing: tiff.bytes)] {
+            let metadata = try XCTUnwrap(EXIFMetadataParser.metadata(forImageAt: url))
+            XCTAssertEqual(metadata["Orientation"] as? Int, 6)
+            XCTAssertEqual(metadata["PixelWidth"] as? Int, 6000)
+            XCTAssertEqual(metadata["PixelHeight"] as? Int, 4000)
+
+            let tiffProperties = try XCTUnwrap(metadata["{TIFF}"] as? [String: Any])
+            XCTAssertEqual(tiffProperties["Make"] as? String, "Cascable")
+            XCTAssertEqual(tiffProperties["Model"] as? String, "Simulated Camera")
+
+            let exifProperties = try XCTUnwrap(metadata["{Exif}"] as? [String: Any])
+            XCTAssertEqual(exifProperties["ExposureTime"] as? Double, 1.0 / 250.0)
+            XCTAssertEqual(exifProperties["FNumber"] as? Double, 2.8)
+            XCTAssertEqual(exifProperties["ISOSpeedRatings"] as? [Int], [400])
+
+            let gpsProperties = try XCTUnwrap(metadata["{GPS}"] as? [String: Any])
+            XCTAssertEqual(gpsProperties["LatitudeRef"] as? String, "N")
+            XCTAssertEqual(try XCTUnwrap(gpsProperties["Latitude"] as? Double), 59.5, accuracy: 0.0001)
+        }
+
+        // The whole file fits in one page, so a budget smaller than that stops the parser before it finds anything.
+        XCTAssertNil(EXIFMetadataParser.metadata(forImageAt: try file(containing: jpegFile), readBudget: 1))
+    }
+
+    func testEXIFMetadataParserSurvivesMalformedFiles() throws {
+        // Not an image at all.
+        XCTAssertNil(EXIFMetadataParser.metadata(forImageAt: try file(containing: Array(repeating: 0x42, count: 100))))
+        XCTAssertNil(EXIFMetadataParser.metadata(forImageAt: try file(containing: [])))
+
+        // A TIFF whose EXIF IFD is out of range and whose GPS "IFD" is IFD0 again.
+        var tiff = TIFFFixture()
+        let make = tiff.append(Array("Cascable\u{0}".utf8))
+        let ifd0Offset = 8 + 9
+        let ifd0 = tiff.appendDirectory([
+            (tag: 0x010F, type: 2, count: 9, value: UInt32(make)),
+            (tag: TIFFReader.Tag.exifIFD, type: 4, count: 1, value: 0xFFFFFF00),
+            (tag: TIFFReader.Tag.gpsIFD, type: 4, count: 1, value: UInt32(ifd0Offset))
+        ], next: UInt32(ifd0Offset))
+        XCTAssertEqual(ifd0, ifd0Offset)
+        tiff.setFirstDirectory(ifd0)
+        let metadata = try XCTUnwrap(EXIFMetadataParser.metadata(forImageAt: try file(containing: tiff.bytes)))
+        XCTAssertEqual((metadata["{TIFF}"] as? [String: Any])?["Make"] as? String, "Cascable")
+        XCTAssertNil(metadata["{Exif}"])
+        XCTAssertNil(metadata["{GPS}"])
+
+        // Wherever the file is cut off, parsing should finish, and anything found should be from the full metadata.
+        let jpegFile: [UInt8] = [0xFF, 0xD8] + exifSegment(containing: metadataFixture().bytes) +
+            Array(ImageParsingTests.jpeg(payloadLength: 50).dropFirst(2))
+        let expectedKeys: Set<String> = ["{TIFF}", "{Exif}", "{GPS}", "Orientation", "PixelWidth", "PixelHeight"]
+        for length in 0..<jpegFile.count {
+            let truncated = EXIFMetadataParser.metadata(forImageAt: try file(containing: Array(jpegFile.prefix(length))))
+            let keys = Set(truncated.map({ Array($0.keys) }) ?? [])
+            XCTAssert(keys.isSubset(of: expectedKeys), "Unexpected keys for length \(length)")
+        }
+    }
+
+    // MARK: - Fixtures
+
+    /// Builds little-endian TIFF data, starting with the header.
+    struct TIFFFixture {
+        typealias Entry = (tag: UInt16, type: UInt16, count: UInt32, value: UInt32)
+
+        private(set) var bytes: [UInt8] = [0x49, 0x49, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00]
+
+        /// Appends the given bytes, returning their offset.
+        mutating func append(_ data: [UInt8]) -> Int {
+            let offset = bytes.count
+            bytes.append(contentsOf: data)
+            return offset
+        }
+
+        mutating func append(rational numerator: UInt32, _ denominator: UInt32) -> Int {
+            return append(uint32s: [numerator, denominator])
+        }
+
+        mutating func append(uint32s values: [UInt32]) -> Int {
+            return append(values.flatMap({ TIFFFixture.encode($0) }))
+        }
+
+        /// Appends an IFD with the given entries, returning its offset. Each entry's value is either its (inline)
+        /// value or the offset of its values.
+        mutating func appendDirectory(_ entries: [Entry], next: UInt32 = 0) -> Int {
+            var directory: [UInt8] = [UInt8(entries.count & 0xFF), UInt8(entries.count >> 8)]
+            for entry in entries {
+                directory += [UInt8(entry.tag & 0xFF), UInt8(entry.tag >> 8), UInt8(entry.type & 0xFF), UInt8(entry.type >> 8)]
+                directory += TIFFFixture.encode(entry.count) + TIFFFixture.encode(entry.value)
+            }
+            return append(directory + TIFFFixture.encode(next))
+        }
+
+        mutating func setFirstDirectory(_ offset: Int) {
+            set(UInt32(offset), at: 4)
+        }
+
+        mutating func setNextDirectory(of directory: Int, to next: Int) {
+            let entryCount = Int(bytes[directory]) | Int(bytes[directory + 1]) << 8
+            set(UInt32(next), at: directory + 2 + entryCount * 12)
+        }
+
+        private mutating func set(_ value: UInt32, at offset: Int) {
+            bytes.replaceSubrange(offset..<(offset + 4), with: TIFFFixture.encode(value))
+        }
+
+        private static func encode(_ value: UInt32) -> [UInt8] {
+            return [UInt8(value & 0xFF), UInt8((value >> 8) & 0xFF), UInt8((value >> 16) & 0xFF), UInt8(value >> 24)]
+        }
+    }
+
+    /// A TIFF-based RAW file with a thumbnail in IFD0 and a preview in a SubIFD.
+    struct RAWFixture {
+        var tiff: TIFFFixture
+        let ifd0: Int
+        let subIFD: Int
+        var bytes: [UInt8] { return tiff.bytes }
+    }
+
+    func rawFixture(thumbnail: [UInt8], preview: [UInt8]) -> RAWFixture {
+        // The directories come first, so cutting the file short loses images before the directories pointing at them.
+        let ifd0 = 8
+        let subIFD = ifd0 + 2 + 3 * 12 + 4
+        let thumbnailOffset = subIFD + 2 + 2 * 12 + 4
+        let previewOffset = thumbnailOffset + thumbnail.count
+
+        var tiff = TIFFFixture()
+        XCTAssertEqual(tiff.appendDirectory([
+            (tag: TIFFReader.Tag.subIFDs, type: 4, count: 1, value: UInt32(subIFD)),
+            (tag: TIFFReader.Tag.jpegInterchangeFormat, type: 4, count: 1, value: UInt32(thumbnailOffset)),
+            (tag: TIFFReader.Tag.jpegInterchangeFormatLength, type: 4, count: 1, value: UInt32(thumbnail.count))
+        ]), ifd0)
+        XCTAssertEqual(tiff.appendDirectory([
+            (tag: TIFFReader.Tag.jpegInterchangeFormat, type: 4, count: 1, value: UInt32(previewOffset)),
+            (tag: TIFFReader.Tag.jpegInterchangeFormatLength, type: 4, count: 1, value: UInt32(preview.count))
+        ]), subIFD)
+        XCTAssertEqual(tiff.append(thumbnail), thumbnailOffset)
+        XCTAssertEqual(tiff.append(preview), previewOffset)
+        tiff.setFirstDirectory(ifd0)
+        return RAWFixture(tiff: tiff, ifd0: ifd0, subIFD: subIFD)
+    }
+
+    /// TIFF data with a handful of values in IFD0 and the EXIF and GPS IFDs.
+    func metadataFixture() -> TIFFFixture {
+        var tiff = TIFFFixture()
+        let make = tiff.append(Array("Cascable\u{0}".utf8))
+        let model = tiff.append(Array("Simulated Camera\u{0}".utf8))
+        let exposureTime = tiff.append(rational: 1, 250)
+        let fNumber = tiff.append(rational: 28, 10)
+        let latitude = tiff.append(uint32s: [59, 1, 30, 1, 0, 1])
+        let exifIFD = tiff.appendDirectory([
+            (tag: 0x829A, type: 5, count: 1, value: UInt32(exposureTime)),
+            (tag: 0x829D, type: 5, count: 1, value: UInt32(fNumber)),
+            (tag: 0x8827, type: 3, count: 1, value: 400),
+            (tag: 0xA002, type: 4, count: 1, value: 6000),
+            (tag: 0xA003, type: 4, count: 1, value: 4000)
+        ])
+        let gpsIFD = tiff.appendDirectory([
+            (tag: 0x0001, type: 2, count: 2, value: 0x4E), // "N"
+            (tag: 0x0002, type: 5, count: 3, value: UInt32(latitude))
+        ])
+        let ifd0 = tiff.appendDirectory([
+            (tag: 0x010F, type: 2, count: 9, value: UInt32(make)),
+            (tag: 0x0110, type: 2, count: 17, value: UInt32(model)),
+            (tag: 0x0112, type: 3, count: 1, value: 6),
+            (tag: TIFFReader.Tag.exifIFD, type: 4, count: 1, value: UInt32(exifIFD)),
+            (tag: TIFFReader.Tag.gpsIFD, type: 4, count: 1, value: UInt32(gpsIFD))
+        ])
+        tiff.setFirstDirectory(ifd0)
+        return tiff
+    }
+
+    /// Returns EXIF-style TIFF data: an empty-ish IFD0 followed by an IFD1 holding the given thumbnail.
+    func tiffWithThumbnail(_ thumbnail: [UInt8]) -> [UInt8] {
+        var tiff = TIFFFixture()
+        let thumbnailOffset = tiff.append(thumbnail)
+        let ifd1 = tiff.appendDirectory([
+            (tag: TIFFReader.Tag.jpegInterchangeFormat, type: 4, count: 1, value: UInt32(thumbnailOffset)),
+            (tag: TIFFReader.Tag.jpegInterchangeFormatLength, type: 4, count: 1, value: UInt32(thumbnail.count))
+        ])
+        let ifd0 = tiff.appendDirectory([(tag: 0x0112, type: 3, count: 1, value: 1)], next: UInt32(ifd1))
+        tiff.setFirstDirectory(ifd0)
+        return tiff.bytes
+    }
+
+    /// Returns a JPEG APP1 segment containing the given TIFF data as an EXIF block.
+    func exifSegment(containing tiff: [UInt8]) -> [UInt8] {
+        let length = 2 + 6 + tiff.count
+        return [0xFF, 0xE1, UInt8(length >> 8), UInt8(length & 0xFF)] + Array("Exif".utf8) + [0, 0] + tiff
+    }
+
+    /// Returns a minimal JPEG: a start of image marker, a frame header, some filler and an end of image marker.
+    static func jpeg(payloadLength: Int, frameMarker: UInt8 = 0xC0) -> [UInt8] {
+        return [0xFF, 0xD8, 0xFF, frameMarker, 0x00, 0x0B] + Array(repeating: 0x00, count: 9) +
+            Array(repeating: 0x55, count: payloadLength) + [0xFF, 0xD9]
+    }
+
+    func file(containing bytes: [UInt8]) throws -> URL {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try Data(bytes).write(to: url)
+        addTeardownBlock { try? FileManager.default.removeItem(at: url) }
+        return url
+    }
+
+    func source(containing bytes: [UInt8]) throws -> FileByteSource {
+        return try XCTUnwrap(FileByteSource(url: try file(containing: bytes)))
+    }
+}
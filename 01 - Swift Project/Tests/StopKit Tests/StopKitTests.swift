@@ -77,4 +77,31 @@ class StopKitTests: XCTestCase {
         let decodedEv = try NSKeyedUnarchiver.unarchivedObject(ofClass: ExposureCompensationValue.self, from: encodedEv)
         XCTAssertEqual(ev, decodedEv)
     }
+
+    func testExposureTriangleSolver() throws {
+
+        let apertures = ExposureStops.stops(between: ApertureValue.f2Point8.stopsFromF8, and: ApertureValue.f16.stopsFromF8,
+                                            fractions: [.oneThird, .twoThirds]).map({ ApertureValue(stopsFromF8: $0) })
+        let shutterSpeeds = try ShutterSpeedValue.shutterSpeeds(between: .oneSecond, and: .oneTwoHundredFiftieth)
+        let isos: [ISOValue] = [.automaticISO, .iso100, .iso200, .iso400, .iso800, .iso1600]
+        let solver = ExposureTriangleSolver(apertures: apertures, shutterSpeeds: shutterSpeeds, isos: isos)
+
+        // One stop brighter while keeping the aperture should open up the shutter or ISO by a stop.
+        let oneStop = ExposureStops(wholeStops: 1, fraction: .none, isNegative: false)
+        let solution = try XCTUnwrap(try solver.bestSolution(applying: oneStop, to: .f8, .oneTwoHundredFiftieth, .iso100,
+                                                             priority: .aperture))
+        XCTAssertEqual(solution.aperture, .f8)
+        XCTAssertEqual(solution.error, .zero)
+        XCTAssertEqual(try solution.shutterSpeed.stopsDifference(from: .oneTwoHundredFiftieth).approximateDecimalValue +
+                       (try solution.iso.stopsDifference(from: .iso100).approximateDecimalValue), 1.0, accuracy: 0.01)
+
+        // Capping ISO at 100 should force every exact solution to ISO 100.
+        var constraints = ExposureTriangleConstraints()
+        constraints.maximumISO = .iso100
+        let solutions = try solver.solutions(applying: oneStop, to: .f8, .oneTwoHundredFiftieth, .iso100, constraints: constraints)
+        XCTAssertFalse(solutions.isEmpty)
+        XCTAssertTrue(solutions.allSatisfy({ $0.iso == .iso100 }))
+
+        XCTAssertThrowsError(try solver.solutions(applying: oneStop, to: .automaticAperture, .oneSecond, .iso100))
+    }
 }
@@ -28,6 +28,9 @@ struct ModuleToUnmanagedCommand: ParsableCommand {
     @Option(name: .shortAndLong, help: "The output directory. C++ implementation and header files will be emitted here, named after the output namespace.")
     var outputDirectory: String
 
+    @Option(name: .long, help: "A directory to cache generated code in. If given, runs with the same input as the last reuse its output instead of parsing the input again.")
+    var cacheDirectory: String?
+
     @Flag(name: .shortAndLong, help: "Output more stuff.")
     var verbose: Bool = false
 
@@ -45,20 +48,35 @@ struct ModuleToUnmanagedCommand: ParsableCommand {
 
         let interopParent = URL(fileURLWithPath: cxxInteropHeaderDirectory).deletingLastPathComponent().path
 
-        let generatedFiles: [GeneratedFile] = try ModuleToUnmanagedOperation.execute(
-            inputHeaderPath: inputHeader,
-            inputModuleName: inputModule,
-            wrappedObjectVariableName: wrappedObjectVariableName,
-            outputNamespace: outputNamespace,
-            platformRoot: platformRoot,
-            cxxInteropContainerPath: interopParent,
-            verbose: verbose)
+        let generate = { [self] in
+            return try ModuleToUnmanagedOperation.execute(
+                inputHeaderPath: inputHeader,
+                inputModuleName: inputModule,
+                wrappedObjectVariableName: wrappedObjectVariableName,
+                outputNamespace: outputNamespace,
+                platformRoot: platformRoot,
+                cxxInteropContainerPath: interopParent,
+                verbose: verbose)
+        }
+
+        let generatedFiles: [GeneratedFile]
+        if let cacheDirectory {
+            let cache = try GenerationCache(directory: URL(fileURLWithPath: cacheDirectory))
+            let key = try GenerationCache.Key(name: outputNamespace, inputHeaderPath: inputHeader, platformRoot: platformRoot,
+                                              includeDirectories: [cxxInteropHeaderDirectory], parameters: [
+                "module-to-unmanaged", inputModule, wrappedObjectVariableName, platformRoot ?? "", interopParent
+            ])
+            generatedFiles = try cache.files(for: key, generatingWith: generate)
+        } else {
+            generatedFiles = try generate()
+        }
 
         for file in generatedFiles {
-            let outputPath = URL(fileURLWithPath: outputDirectory)
-                .appendingPathComponent(file.name)
-            try file.contents.write(to: outputPath)
-            print("Successfully wrote", file.name)
+            if try file.write(toDirectory: URL(fileURLWithPath: outputDirectory)) {
+                print("Successfully wrote", file.name)
+            } else {
+                print(file.name, "is up-to-date")
+            }
         }
     }
 }
@@ -31,6 +31,9 @@ struct SwiftToCLR: ParsableCommand {
     @Option(name: .shortAndLong, help: "The output directory. C++ implementation and header files will be emitted here, named after the input module.")
     var outputDirectory: String
 
+    @Option(name: .long, help: "A directory to cache generated code in. If given, runs with the same input as the last reuse its output instead of parsing the input again.")
+    var cacheDirectory: String?
+
     @Flag(name: .shortAndLong, help: "Output more stuff.")
     var verbose: Bool = false
 
@@ -49,41 +52,72 @@ struct SwiftToCLR: ParsableCommand {
         let interopParent = URL(fileURLWithPath: cxxInteropHeaderDirectory).deletingLastPathComponent().path
         let unmanagedWrapperNamespace: String = "Unmanaged" + inputModule
         let managedWrapperNamespace: String = "Managed" + inputModule
+        let cache: GenerationCache? = try cacheDirectory.map({ try GenerationCache(directory: URL(fileURLWithPath: $0)) })
 
         // First, we generate the "unmanaged" C++ API. This is for the Microsoft C++ compiler.
-        let generatedUnmanagedFiles: [GeneratedFile] = try ModuleToUnmanagedOperation.execute(
-            inputHeaderPath: inputHeader,
-            inputModuleName: inputModule,
-            wrappedObjectVariableName: "swiftObj",
-            outputNamespace: unmanagedWrapperNamespace,
-            platformRoot: platformRoot,
-            cxxInteropContainerPath: interopParent,
-            verbose: verbose)
+        let generateUnmanagedFiles = { [self] in
+            return try ModuleToUnmanagedOperation.execute(
+                inputHeaderPath: inputHeader,
+                inputModuleName: inputModule,
+                wrappedObjectVariableName: "swiftObj",
+                outputNamespace: unmanagedWrapperNamespace,
+                platformRoot: platformRoot,
+                cxxInteropContainerPath: interopParent,
+                verbose: verbose)
+        }
+
+        let generatedUnmanagedFiles: [GeneratedFile]
+        if let cache {
+            let key = try GenerationCache.Key(name: unmanagedWrapperNamespace, inputHeaderPath: inputHeader, platformRoot: platformRoot,
+                                              includeDirectories: [cxxInteropHeaderDirectory], parameters: [
+                "module-to-unmanaged", inputModule, "swiftObj", platformRoot ?? "", interopParent
+            ])
+            generatedUnmanagedFiles = try cache.files(for: key, generatingWith: generateUnmanagedFiles)
+        } else {
+            generatedUnmanagedFiles = try generateUnmanagedFiles()
+        }
 
         for file in generatedUnmanagedFiles {
-            let outputPath = URL(fileURLWithPath: outputDirectory)
-                .appendingPathComponent(file.name)
-            try file.contents.write(to: outputPath)
-            print("Successfully wrote", file.name)
+            if try file.write(toDirectory: URL(fileURLWithPath: outputDirectory)) {
+                print("Successfully wrote", file.name)
+            } else {
+                print(file.name, "is up-to-date")
+            }
         }
 
         guard let unmanagedHeader = generatedUnmanagedFiles.first(where: { $0.kind == .header }) else {
             throw ValidationError("Filed to find unmanaged C++ API header! This is most likely a bug.")
         }
 
-        let generatedManagedFiles: [GeneratedFile] = try UnmanagedToManagedOperation.execute(
-            inputHeaderPath: URL(fileURLWithPath: outputDirectory).appendingPathComponent(unmanagedHeader.name).path,
-            inputNamespace: unmanagedWrapperNamespace,
-            wrappedObjectVariableName: "wrappedObj",
-            outputNamespace: managedWrapperNamespace,
-            platformRoot: platformRoot,
-            verbose: verbose)
+        let unmanagedHeaderPath = URL(fileURLWithPath: outputDirectory).appendingPathComponent(unmanagedHeader.name).path
+        let generateManagedFiles = { [self] in
+            return try UnmanagedToManagedOperation.execute(
+                inputHeaderPath: unmanagedHeaderPath,
+                inputNamespace: unmanagedWrapperNamespace,
+                wrappedObjectVariableName: "wrappedObj",
+                outputNamespace: managedWrapperNamespace,
+                platformRoot: platformRoot,
+                verbose: verbose)
+        }
+
+        // If the unmanaged header didn't change, neither will the managed wrapper.
+        let generatedManagedFiles: [GeneratedFile]
+        if let cache {
+            let key = try GenerationCache.Key(name: managedWrapperNamespace, inputHeaderPath: unmanagedHeaderPath,
+                                              platformRoot: platformRoot, parameters: [
+                "unmanaged-to-managed", unmanagedWrapperNamespace, "wrappedObj", platformRoot ?? ""
+            ])
+            generatedManagedFiles = try cache.files(for: key, generatingWith: generateManagedFiles)
+        } else {
+            generatedManagedFiles = try generateManagedFiles()
+        }
 
         for file in generatedManagedFiles {
-            let outputPath = URL(fileURLWithPath: outputDirectory)
-                .appendingPathComponent(file.name)
-            try file.contents.write(to: outputPath)
-            print("Successfully wrote", file.name)
+            if try file.write(toDirectory: URL(fileURLWithPath: outputDirectory)) {
+                print("Successfully wrote", file.name)
+            } else {
+                print(file.name, "is up-to-date")
+            }
         }
     }
 }
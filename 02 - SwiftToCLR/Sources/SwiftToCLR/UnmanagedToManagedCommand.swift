@@ -25,6 +25,9 @@ struct UnmanagedToManagedCommand: ParsableCommand {
     @Option(name: .shortAndLong, help: "The output directory. C++ implementation and header files will be emitted here, named after the output namespace.")
     var outputDirectory: String
 
+    @Option(name: .long, help: "A directory to cache generated code in. If given, runs with the same input as the last reuse its output instead of parsing the input again.")
+    var cacheDirectory: String?
+
     @Flag(name: .shortAndLong, help: "Output more stuff.")
     var verbose: Bool = false
 
@@ -40,20 +43,35 @@ struct UnmanagedToManagedCommand: ParsableCommand {
 
         print("Using clang version:", clangVersionString())
 
-        let generatedFiles: [GeneratedFile] = try UnmanagedToManagedOperation.execute(
-            inputHeaderPath: inputHeader,
-            inputNamespace: inputNamespace,
-            wrappedObjectVariableName: wrappedObjectVariableName,
-            outputNamespace: outputNamespace,
-            platformRoot: platformRoot,
-            verbose: verbose
-        )
+        let generate = { [self] in
+            return try UnmanagedToManagedOperation.execute(
+                inputHeaderPath: inputHeader,
+                inputNamespace: inputNamespace,
+                wrappedObjectVariableName: wrappedObjectVariableName,
+                outputNamespace: outputNamespace,
+                platformRoot: platformRoot,
+                verbose: verbose
+            )
+        }
+
+        let generatedFiles: [GeneratedFile]
+        if let cacheDirectory {
+            let cache = try GenerationCache(directory: URL(fileURLWithPath: cacheDirectory))
+            let key = try GenerationCache.Key(name: outputNamespace, inputHeaderPath: inputHeader, platformRoot: platformRoot,
+                                              parameters: [
+                "unmanaged-to-managed", inputNamespace, wrappedObjectVariableName, platformRoot ?? ""
+            ])
+            generatedFiles = try cache.files(for: key, generatingWith: generate)
+        } else {
+            generatedFiles = try generate()
+        }
 
         for file in generatedFiles {
-            let outputPath = URL(fileURLWithPath: outputDirectory)
-                .appendingPathComponent(file.name)
-            try file.contents.write(to: outputPath)
-            print("Successfully wrote", file.name)
+            if try file.write(toDirectory: URL(fileURLWithPath: outputDirectory)) {
+                print("Successfully wrote", file.name)
+            } else {
+                print(file.name, "is up-to-date")
+            }
         }
     }
 }
@@ -0,0 +1,122 @@
+import Foundation
+
+/// An on-disk cache of generated files, keyed by a digest of everything that went into generating them.
+///
+/// Parsing the input header with clang is by far the most expensive part of generating wrappers, and most runs (for
+/// instance, as part of every build) have the same input as the last. When the key matches, the previous run's files
+/// are returned without parsing anything.
+public struct GenerationCache {
+
+    /// Identifies one run of an operation.
+    public struct Key: Hashable {
+        /// The name of the cache entry. Runs with the same name replace each other's entries.
+        public let name: String
+        /// A SHA-256 digest of the run's input, as a hex string.
+        public let digest: String
+
+        /// Creates a key for a run of an operation.
+        ///
+        /// - Parameter name: The name of the cache entry, such as the output namespace.
+        /// - Parameter inputHeaderPath: The input header. Its contents are part of the key.
+        /// - Parameter platformRoot: The SDK the input is parsed against, or `nil` for the default SDK.
+        /// - Parameter includeDirectories: Any other directories the input includes headers from, such as the C++
+        ///   interop headers. Like the SDK's, their files are part of the key.
+        /// - Parameter parameters: Anything else that affects the output, such as the operation's options.
+        public init(name: String, inputHeaderPath: String, platformRoot: String?, includeDirectories: [String] = [],
+                    parameters: [String]) throws {
+            self.name = name
+            var hasher = SHA256()
+            hasher.update(with: try Data(contentsOf: URL(fileURLWithPath: inputHeaderPath)))
+            // A new build of the tool (or of clang) may generate different code from the same input.
+            let environment: [String] = [String(GenerationCache.formatVersion), clangVersionString(), GenerationCache.executableFingerprint()]
+            let directories: [String] = [platformRoot ?? Platform.defaultSDKRoot] + includeDirectories
+            for parameter in environment + parameters + directories.flatMap({ [$0] + GenerationCache.fileFingerprints(in: $0) }) {
+                // The separator keeps, say, ["ab", "c"] and ["a", "bc"] from having the same digest.
+                hasher.update(with: "\u{0}" + parameter)
+            }
+            self.digest = hasher.finalize()
+        }
+    }
+
+    /// Opens (or creates) a cache in the given directory.
+    public init(directory: URL) throws {
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true, attributes: nil)
+        self.directory = directory
+    }
+
+    public let directory: URL
+
+    /// Returns the cached files for the given key, or `nil` if there aren't any.
+    public func cachedFiles(for key: Key) -> [GeneratedFile]? {
+        guard let data = try? Data(contentsOf: url(for: key)),
+              let entry = try? PropertyListDecoder().decode(Entry.self, from: data),
+              entry.formatVersion == GenerationCache.formatVersion, entry.digest == key.digest else { return nil }
+        return entry.files.map({ GeneratedFile(kind: $0.isHeader ? .header : .implementation, name: $0.name, contents: $0.contents) })
+    }
+
+    /// Stores the given files under the given key, replacing any files previously stored under its name.
+    public func store(_ files: [GeneratedFile], for key: Key) throws {
+        let entry = Entry(formatVersion: GenerationCache.formatVersion, digest: key.digest, files: files.map({
+            Entry.File(name: $0.name, isHeader: $0.kind == .header, contents: $0.contents)
+        }))
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .binary
+        try encoder.encode(entry).write(to: url(for: key), options: .atomic)
+    }
+
+    /// Returns the cached files for the given key if there are any. Otherwise, generates them and caches the result.
+    public func files(for key: Key, generatingWith generate: () throws -> [GeneratedFile]) throws -> [GeneratedFile] {
+        if let cachedFiles = cachedFiles(for: key) { return cachedFiles }
+        let files = try generate()
+        try store(files, for: key)
+        return files
+    }
+
+    // MARK: - Internal
+
+    // Bump this when the entry format changes.
+    static let formatVersion: Int = 2
+
+    private struct Entry: Codable {
+        struct File: Codable {
+            let name: String
+            let isHeader: Bool
+            let contents: Data
+        }
+
+        let formatVersion: Int
+        let digest: String
+        let files: [File]
+    }
+
+    private static func executableFingerprint() -> String {
+        guard let executableURL = Bundle.main.executableURL,
+              let attributes = try? FileManager.default.attributesOfItem(atPath: executableURL.path) else { return "" }
+        let size = (attributes[.size] as? NSNumber)?.int64Value ?? 0
+        let modificationDate = (attributes[.modificationDate] as? Date)?.timeIntervalSince1970 ?? 0.0
+        return "\(size)-\(modificationDate)"
+    }
+
+    /// Returns a fingerprint of each file in the given directory and its subdirectories, in a stable order.
+    ///
+    /// SDKs hold thousands of headers, and reading them all would take longer than the parse the cache saves, so files
+    /// are fingerprinted by their size and modification date rather than their contents.
+    static func fileFingerprints(in directoryPath: String) -> [String] {
+        let directory = URL(fileURLWithPath: directoryPath).standardizedFileURL
+        let keys: [URLResourceKey] = [.isRegularFileKey, .fileSizeKey, .contentModificationDateKey]
+        guard let enumerator = FileManager.default.enumerator(at: directory, includingPropertiesForKeys: keys) else { return [] }
+
+        var fingerprints: [String] = []
+        for case let fileURL as URL in enumerator {
+            guard let values = try? fileURL.resourceValues(forKeys: Set(keys)), values.isRegularFile == true else { continue }
+            let relativePath = String(fileURL.standardizedFileURL.path.dropFirst(directory.path.count))
+            let modificationDate = values.contentModificationDate?.timeIntervalSince1970 ?? 0.0
+            fingerprints.append("\(relativePath)-\(values.fileSize ?? 0)-\(modificationDate)")
+        }
+        return fingerprints.sorted()
+    }
+
+    private func url(for key: Key) -> URL {
+        return directory.appendingPathComponent(key.name).appendingPathExtension("swifttoclrcache")
+    }
+}
@@ -8,6 +8,11 @@ struct MethodArgument: Hashable {
     let isArrayType: Bool
     let isVoidType: Bool
 
+    /// If the argument is a callback, the types of the parameters it's called with (excluding its context parameter).
+    var callbackParameterTypeNames: [String]? = nil
+
+    var isCallbackType: Bool { return callbackParameterTypeNames != nil }
+
     init(typeName: String, argumentName: String, isOptionalType: Bool, isArrayType: Bool, isVoidType: Bool) {
         self.typeName = typeName
         self.argumentName = argumentName
@@ -133,4 +138,15 @@ public struct GeneratedFile {
     public let kind: Kind
     public let name: String
     public let contents: Data
+
+    /// Writes the file into the given directory, unless an identical file is already there. Identical files are left
+    /// alone so that their modification dates don't change, and builds depending on them don't redo any work.
+    ///
+    /// - Returns: `true` if the file was written, or `false` if it was already up-to-date.
+    @discardableResult public func write(toDirectory directory: URL) throws -> Bool {
+        let url = directory.appendingPathComponent(name)
+        if let existingContents = try? Data(contentsOf: url), existingContents == contents { return false }
+        try contents.write(to: url, options: .atomic)
+        return true
+    }
 }
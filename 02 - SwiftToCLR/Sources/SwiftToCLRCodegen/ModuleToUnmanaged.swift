@@ -131,12 +131,71 @@ public struct ModuleToUnmanagedOperation {
                         return didEncounterUnavailableAttribute
                     }()
 
+                    // Swift classes are declared as subclasses of swift::_impl::RefCountedClass. Structs and enums
+                    // are declared as final classes holding their value in inline storage, which means we can hold
+                    // them inline too rather than putting them on the heap. We can only tell from the definition,
+                    // since the forward declarations come first.
+                    let valueTypeLayout: ValueTypeLayout? = {
+                        guard clang_isCursorDefinition(cursor) != 0 else { return nil }
+                        var isReferenceType: Bool = false
+
+                        clang_visitChildrenWithBlock(cursor) { classChildCursor, _ in
+                            guard clang_getCursorKind(classChildCursor) == CXCursor_CXXBaseSpecifier else { return CXChildVisit_Continue }
+                            let baseName = clang_getTypeSpelling(clang_getCursorType(classChildCursor)).consumeToString
+                            guard baseName.contains("RefCountedClass") else { return CXChildVisit_Continue }
+                            isReferenceType = true
+                            return CXChildVisit_Break
+                        }
+
+                        guard !isReferenceType else { return nil }
+                        let classType: CXType = clang_getCursorType(cursor)
+                        // These return negative error codes if the type's layout isn't known.
+                        let size = clang_Type_getSizeOf(classType)
+                        let alignment = clang_Type_getAlignOf(classType)
+                        guard size > 0, alignment > 0 else { return nil }
+                        return ValueTypeLayout(size: Int(size), alignment: Int(alignment))
+                    }()
+
+                    if verbose, valueTypeLayout != nil { print("Class \(className) is a value type - it'll be stored inline.") }
+
+                    // Data and the buffer pointer types aren't exposed to C++, so blobs are exposed from Swift as types
+                    // with a `bytes: UnsafePointer<UInt8>?` property and a `count: Int` property. Wrappers of these get
+                    // a span for reading the bytes in place, with the wrapper itself keeping the bytes alive.
+                    let classIsByteBuffer: Bool = {
+                        guard clang_isCursorDefinition(cursor) != 0 else { return false }
+                        var hasBytes: Bool = false
+                        var hasCount: Bool = false
+
+                        clang_visitChildrenWithBlock(cursor) { classChildCursor, _ in
+                            guard clang_getCursorKind(classChildCursor) == CXCursor_CXXMethod,
+                                  clang_Cursor_getNumArguments(classChildCursor) == 0 else { return CXChildVisit_Continue }
+                            let resultType: CXType = clang_getResultType(clang_getCursorType(classChildCursor))
+                            let resultTypeName = clang_getTypeSpelling(resultType).consumeToString
+                            switch clang_getCursorSpelling(classChildCursor).consumeToString {
+                            case "getBytes": hasBytes = (resultTypeName.contains("uint8_t") && resultTypeName.contains("*"))
+                            case "getCount": hasCount = (resultTypeName == "swift::Int")
+                            default: break
+                            }
+                            return CXChildVisit_Continue
+                        }
+
+                        return hasBytes && hasCount
+                    }()
+
+                    if verbose, classIsByteBuffer { print("Class \(className) is a byte buffer - adding a span accessor.") }
+
                     let wrapperClass: UnmanagedManagedCPPWrapperClass = {
                         if var existing = wrapperClasses[className] {
                             if !existing.isUnavailable && classIsUnavailable {
                                 existing.isUnavailable = classIsUnavailable
-                                wrapperClasses[className] = existing
                             }
+                            if existing.valueTypeLayout == nil, let valueTypeLayout {
+                                existing.valueTypeLayout = valueTypeLayout
+                            }
+                            if classIsByteBuffer {
+                                existing.isByteBuffer = true
+                            }
+                            wrapperClasses[className] = existing
                             return existing
                         }
 
@@ -145,7 +204,9 @@ public struct ModuleToUnmanagedOperation {
                                                                        swiftObjectName: wrappedObjectVariableName,
                                                                        wrapperClassName: className,
                                                                        wrapperNamespace: outputNamespace,
-                                                                       isUnavailable: classIsUnavailable)
+                                                                       isUnavailable: classIsUnavailable,
+                                                                       valueTypeLayout: valueTypeLayout,
+                                                                       isByteBuffer: classIsByteBuffer)
                         wrapperClasses[className] = newClass
                         return newClass
                     }()
@@ -153,21 +214,34 @@ public struct ModuleToUnmanagedOperation {
                     let constMapping = TypeMapping(wrappedTypeName: "const " + wrapperClass.swiftModuleName + "::" + wrapperClass.swiftClassName + " &",
                                                    wrapperTypeName: "const " + wrapperClass.wrapperNamespace + "::" + wrapperClass.wrapperClassName + " &",
                                                    convertWrapperToWrapped: { name, _ in
-                        return "*\(name).\(wrapperClass.swiftObjectName).get()"
+                        if wrapperClass.isValueType {
+                            return "\(name).\(wrapperClass.swiftObjectName)()"
+                        } else {
+                            return "*\(name).\(wrapperClass.swiftObjectName).get()"
+                        }
                     }, convertWrappedToWrapper: { name, _ in
-                        return "\(wrapperClass.wrapperNamespace)::\(wrapperClass.wrapperClassName)(std::make_shared<\(wrapperClass.swiftModuleName)::\(wrapperClass.swiftClassName)>(\(name)))"
+                        if wrapperClass.isValueType {
+                            return "\(wrapperClass.wrapperNamespace)::\(wrapperClass.wrapperClassName)(\(name))"
+                        } else {
+                            return "\(wrapperClass.wrapperNamespace)::\(wrapperClass.wrapperClassName)(std::make_shared<\(wrapperClass.swiftModuleName)::\(wrapperClass.swiftClassName)>(\(name)))"
+                        }
                     })
 
                     let flatMapping = TypeMapping(wrappedTypeName: wrapperClass.swiftModuleName + "::" + wrapperClass.swiftClassName,
                                                   wrapperTypeName: wrapperClass.wrapperNamespace + "::" + wrapperClass.wrapperClassName,
                                                   convertWrapperToWrapped: { name, isConst in
-                        if isConst {
-                            return "*\(name).\(wrapperClass.swiftObjectName).get()"
-                        } else {
-                            return "\(name)->\(wrapperClass.swiftObjectName).get()"
+                        switch (wrapperClass.isValueType, isConst) {
+                        case (true, true): return "\(name).\(wrapperClass.swiftObjectName)()"
+                        case (true, false): return "&\(name)->\(wrapperClass.swiftObjectName)()"
+                        case (false, true): return "*\(name).\(wrapperClass.swiftObjectName).get()"
+                        case (false, false): return "\(name)->\(wrapperClass.swiftObjectName).get()"
                         }
                     }, convertWrappedToWrapper: { name, _ in
-                        return "\(wrapperClass.wrapperNamespace)::\(wrapperClass.wrapperClassName)(std::make_shared<\(wrapperClass.swiftModuleName)::\(wrapperClass.swiftClassName)>(\(name)))"
+                        if wrapperClass.isValueType {
+                            return "\(wrapperClass.wrapperNamespace)::\(wrapperClass.wrapperClassName)(\(name))"
+                        } else {
+                            return "\(wrapperClass.wrapperNamespace)::\(wrapperClass.wrapperClassName)(std::make_shared<\(wrapperClass.swiftModuleName)::\(wrapperClass.swiftClassName)>(\(name)))"
+                        }
                     })
 
                     internalTypeMappings["const " + className + " &"] = constMapping // This seems fragile.
@@ -238,10 +312,21 @@ public struct ModuleToUnmanagedOperation {
             "",
             "#ifndef " + outputNamespace + "_hpp",
             "#define " + outputNamespace + "_hpp",
+            "#include <cstddef>",
+            "#include <cstdint>",
+            "#include <functional>",
             "#include <memory>",
             "#include <string>",
             "#include <optional>",
             "#include <vector>",
+            "",
+            "// Completion-handler methods get awaitable versions when compiling as C++20 or later.",
+            "#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)",
+            "#include <coroutine>",
+            "#define " + outputNamespace + "_HAS_COROUTINES 1",
+            "#else",
+            "#define " + outputNamespace + "_HAS_COROUTINES 0",
+            "#endif",
             ""
         ]
 
@@ -263,9 +348,24 @@ public struct ModuleToUnmanagedOperation {
             hppContent.append("    " + "class " + wrapperClass.wrapperClassName + ";")
         }
 
+        if availableWrapperClasses.contains(where: { $0.isByteBuffer }) {
+            hppContent.append("")
+            hppContent.append(contentsOf: UnmanagedManagedCPPWrapperClass.generateByteSpanDefinition().map({ "    " + $0 }))
+        }
+
+        if availableWrapperClasses.contains(where: { !$0.generatedAwaitableMethodDefinitions.isEmpty }) {
+            hppContent.append("")
+            hppContent.append("#if " + outputNamespace + "_HAS_COROUTINES")
+            hppContent.append(contentsOf: UnmanagedManagedCPPWrapperClass.generateCompletionAwaitableDefinition().map({
+                $0.isEmpty ? $0 : "    " + $0
+            }))
+            hppContent.append("#endif")
+        }
+
         for wrapperClass in availableWrapperClasses {
             hppContent.append("")
-            hppContent.append(contentsOf: wrapperClass.generateClassDefinition().map({ "    " + $0 }))
+            // Preprocessor directives stay in the first column.
+            hppContent.append(contentsOf: wrapperClass.generateClassDefinition().map({ $0.hasPrefix("#") ? $0 : "    " + $0 }))
         }
 
         hppContent.append("}")
@@ -278,6 +378,8 @@ public struct ModuleToUnmanagedOperation {
             "",
             "#include \"" + outputNamespace + ".hpp\"",
             "#include <" + inputFileName + ">",
+            "#include <new>",
+            "#include <utility>",
             ""
         ]
 
@@ -363,7 +465,16 @@ struct SwiftToUnmanagedTypeMappings {
     }
 }
 
+/// The size and alignment of a Swift value type's C++ representation.
+struct ValueTypeLayout: Hashable {
+    let size: Int
+    let alignment: Int
+}
+
 /// Represents an unmanaged C++ class wrapping a Swift object's C++ interface.
+///
+/// Swift classes are held via a `std::shared_ptr`. Swift structs and enums are held by value in inline storage
+/// inside the wrapper, so copying them around doesn't involve heap allocations or reference counting.
 struct UnmanagedManagedCPPWrapperClass {
     let swiftClassName: String
     let swiftModuleName: String
@@ -375,26 +486,53 @@ struct UnmanagedManagedCPPWrapperClass {
     // True if the type is marked as unavailable in the source header.
     var isUnavailable: Bool
 
+    // The layout of the wrapped type if it's a Swift value type, or `nil` if it's a Swift class.
+    var valueTypeLayout: ValueTypeLayout?
+
+    var isValueType: Bool { return valueTypeLayout != nil }
+
+    // The expression used to call methods on the wrapped Swift object from inside the wrapper.
+    var swiftObjectMemberAccess: String {
+        return isValueType ? swiftObjectName + "()." : swiftObjectName + "->"
+    }
+
+    // The name of the inline storage holding a wrapped value type.
+    var swiftObjectStorageName: String { return swiftObjectName + "Storage" }
+
+    // True if the type exposes a block of bytes via `getBytes()` and `getCount()`.
+    var isByteBuffer: Bool
+
+    static let byteSpanTypeName: String = "ByteSpan"
+    static let completionAwaitableTypeName: String = "CompletionAwaitable"
+    static let completionExecutorTypeName: String = "CompletionExecutor"
+
+    // The macro the header defines to 1 if C++20 coroutines are available.
+    var coroutineSupportMacroName: String { return wrapperNamespace + "_HAS_COROUTINES" }
+
     var generatedMethodDefinitions: [String] // For the header file
     var generatedConstructorDefinitions: [String] // For the header file
     var generatedEnumCaseDefinitions: [String] // For the header file
     var generatedStaticMethodDefinitions: [String] // For the header file
+    var generatedAwaitableMethodDefinitions: [[String]] // For the header file, defined inline.
     var generatedMethodImplementations: [[String]]  // For the implementation file.
     var generatedConstructorImplementations: [[String]] // For the implementation file.
     var generatedEnumCaseImplementations: [[String]] // For the implementation file.
 
     init(swiftClassName: String, swiftModuleName: String, swiftObjectName: String, wrapperClassName: String,
-         wrapperNamespace: String, isUnavailable: Bool) {
+         wrapperNamespace: String, isUnavailable: Bool, valueTypeLayout: ValueTypeLayout?, isByteBuffer: Bool) {
         self.swiftClassName = swiftClassName
         self.swiftModuleName = swiftModuleName
         self.swiftObjectName = swiftObjectName
         self.wrapperClassName = wrapperClassName
         self.wrapperNamespace = wrapperNamespace
         self.isUnavailable = isUnavailable
+        self.valueTypeLayout = valueTypeLayout
+        self.isByteBuffer = isByteBuffer
         self.generatedMethodDefinitions = []
         self.generatedConstructorDefinitions = []
         self.generatedEnumCaseDefinitions = []
         self.generatedStaticMethodDefinitions = []
+        self.generatedAwaitableMethodDefinitions = []
         self.generatedMethodImplementations = []
         self.generatedConstructorImplementations = []
         self.generatedEnumCaseImplementations = []
@@ -420,7 +558,11 @@ struct UnmanagedManagedCPPWrapperClass {
         var implementationLines: [String] = []
         implementationLines.append(scopedWrapperClassName + " " + scopedWrapperClassName + "::" + enumCaseName + "() {")
         implementationLines.append("    " + scopedSwiftClassName + " value = " + scopedSwiftClassName + "::" + enumCaseName + "();")
-        implementationLines.append("    return " + scopedWrapperClassName + "(std::make_shared<" + scopedSwiftClassName + ">(value));")
+        if isValueType {
+            implementationLines.append("    return " + scopedWrapperClassName + "(value);")
+        } else {
+            implementationLines.append("    return " + scopedWrapperClassName + "(std::make_shared<" + scopedSwiftClassName + ">(value));")
+        }
         implementationLines.append("}")
         generatedEnumCaseImplementations.append(implementationLines)
     }
@@ -443,12 +585,16 @@ struct UnmanagedManagedCPPWrapperClass {
         let swiftReturnArgument: MethodArgument = {
             let swiftReturnType: CXType = clang_getResultType(cursorType)
             let returnIsVoid = (swiftReturnType.kind == CXType_Void)
+            let returnTypeName = clang_getTypeSpelling(swiftReturnType).consumeToString
+            // Pointers are never wrapped in swift::Optional (optional pointers are nullable instead), and clang
+            // spells them fine. The condensed tokenization would mangle them, since it has its spaces stripped.
+            let returnIsPointer = returnTypeName.hasSuffix("*") || returnTypeName.contains("* _")
 
-            if !returnIsVoid, let tokenization = cursor.condensedTokenization(in: unit),
+            if !returnIsVoid, !returnIsPointer, let tokenization = cursor.condensedTokenization(in: unit),
                 let argument = MethodArgument(extractingOptionalReturnTypeFromCondensedMethodTokenization: tokenization, of: swiftMethodName) {
                 return argument
             } else {
-                return MethodArgument(typeName: clang_getTypeSpelling(swiftReturnType).consumeToString, argumentName: "",
+                return MethodArgument(typeName: Self.strippingNullability(from: returnTypeName), argumentName: "",
                                       isOptionalType: false, isArrayType: false, isVoidType: returnIsVoid)
             }
         }()
@@ -461,13 +607,35 @@ struct UnmanagedManagedCPPWrapperClass {
             let argumentType: CXType = clang_getArgType(cursorType, argumentIndex)
             let argumentTypeName = clang_getTypeSpelling(argumentType).consumeToString
 
-            if let argumentSpelling = argumentCursor.condensedTokenization(in: unit) {
+            if let callbackParameterTypeNames = Self.callbackParameterTypeNames(of: argumentType) {
+                var argument = MethodArgument(typeName: Self.strippingNullability(from: argumentTypeName), argumentName: argumentName,
+                                              isOptionalType: false, isArrayType: false, isVoidType: false)
+                argument.callbackParameterTypeNames = callbackParameterTypeNames
+                return argument
+            } else if argumentTypeName.hasSuffix("*") || argumentTypeName.contains("* _") {
+                // As with return types, pointers are spelled fine by clang and mangled by the condensed tokenization.
+                return MethodArgument(typeName: Self.strippingNullability(from: argumentTypeName), argumentName: argumentName,
+                                      isOptionalType: false, isArrayType: false, isVoidType: false)
+            } else if let argumentSpelling = argumentCursor.condensedTokenization(in: unit) {
                 return MethodArgument(extractingOptionalTypeFromCondensedArgumentTokenization: argumentSpelling, argumentName: argumentName)
             } else {
                 return MethodArgument(typeName: argumentTypeName, argumentName: argumentName, isOptionalType: false, isArrayType: false, isVoidType: false)
             }
         })
 
+        // Swift closures aren't exposed to C++, but C function pointers are. Methods taking a callback do so as a
+        // `context` pointer, a function called with the context, and a `releaseContext` function called once the
+        // callback is no longer needed. We expose these as a single std::function argument.
+        guard !swiftArguments.contains(where: { !$0.isCallbackType && $0.typeName.contains("(*") }) else { return false }
+        let callbackRegistration: CallbackRegistration?
+        if swiftArguments.contains(where: { $0.isCallbackType }) {
+            let handleMapping = Self.callbackHandleMapping(forRegistrationMethodNamed: swiftMethodName, in: internalTypeMappings)
+            guard !isConstructor, let registration = CallbackRegistration(arguments: swiftArguments, handleMapping: handleMapping) else { return false }
+            callbackRegistration = registration
+        } else {
+            callbackRegistration = nil
+        }
+
         // We have everything we need to wrap the method now!
 
         func wrapping(for swiftTypeName: String) -> TypeMapping {
@@ -479,11 +647,20 @@ struct UnmanagedManagedCPPWrapperClass {
         let returnTypeMapping = wrapping(for: swiftReturnArgument.typeName)
         let unmanagedReturnTypeName = returnTypeMapping.wrapperTypeName
 
-        let unmanagedMethodArguments: [String] = swiftArguments.map({ argument in
+        let unmanagedMethodArguments: [String] = swiftArguments.enumerated().compactMap({ index, argument in
+            if let callbackRegistration {
+                if index == callbackRegistration.callbackIndex {
+                    return "\(callbackRegistration.unmanagedFunctionTypeName) \(argument.argumentName)"
+                } else if callbackRegistration.replacedIndexes.contains(index) {
+                    return nil
+                }
+            }
             let coreType: String = wrapping(for: argument.typeName).wrapperTypeName
             let arrayedType: String = (argument.isArrayType ? "std::vector<\(coreType)>" : coreType)
             if argument.isOptionalType {
                 return "const std::optional<\(arrayedType)> & \(argument.argumentName)"
+            } else if argument.isArrayType {
+                return "const \(arrayedType) & \(argument.argumentName)"
             } else {
                 return "\(arrayedType) \(argument.argumentName)"
             }
@@ -516,6 +693,34 @@ struct UnmanagedManagedCPPWrapperClass {
                 }
             }()
             generatedMethodDefinitions.append(methodDefinition)
+
+            // Methods taking a completion also get a version that can be awaited from a coroutine. It's defined inline
+            // so that it's only compiled by clients with coroutine support.
+            if let callbackRegistration, !isStatic, swiftReturnArgument.isVoidType,
+               let resultTypeName = callbackRegistration.awaitableResultTypeName(for: swiftArguments) {
+                let awaitableTypeName = wrapperNamespace + "::" + Self.completionAwaitableTypeName + "<" + resultTypeName + ">"
+                let awaitableMethodName = (swiftMethodName.hasSuffix("WithCompletion") ?
+                    String(swiftMethodName.dropLast("WithCompletion".count)) : swiftMethodName) + "Async"
+                let completionArgumentName = swiftArguments[callbackRegistration.callbackIndex].argumentName
+                let completionDeclaration = callbackRegistration.unmanagedFunctionTypeName + " " + completionArgumentName
+                let awaitableArguments = unmanagedMethodArguments.filter({ $0 != completionDeclaration })
+                let capturedArgumentNames = swiftArguments.enumerated().filter({ index, _ in
+                    index != callbackRegistration.callbackIndex && !callbackRegistration.replacedIndexes.contains(index)
+                }).map({ $0.element.argumentName })
+                let callArguments: [String] = swiftArguments.enumerated().compactMap({ index, argument in
+                    if index == callbackRegistration.callbackIndex { return "std::move(" + completionArgumentName + ")" }
+                    return callbackRegistration.replacedIndexes.contains(index) ? nil : argument.argumentName
+                })
+
+                generatedAwaitableMethodDefinitions.append([
+                    awaitableTypeName + " " + awaitableMethodName + "(" + awaitableArguments.joined(separator: ", ") + ") {",
+                    "    return " + awaitableTypeName + "([" + (["self = *this"] + capturedArgumentNames).joined(separator: ", ") + "](" +
+                        completionDeclaration + ") mutable {",
+                    "        self." + swiftMethodName + "(" + callArguments.joined(separator: ", ") + ");",
+                    "    });",
+                    "}"
+                ])
+            }
         }
 
         let scopedSwiftClassName = swiftModuleName + "::" + swiftClassName
@@ -546,7 +751,12 @@ struct UnmanagedManagedCPPWrapperClass {
             let args: String = (0..<swiftArguments.count).map({ "arg\($0)" }).joined(separator: ", ")
 
             constructorLines.append("    " + scopedSwiftClassName + " instance = " + scopedSwiftClassName + "::init(" + args + ");")
-            constructorLines.append("    " + swiftObjectName + " = std::make_shared<" + scopedSwiftClassName + ">(instance);")
+            if isValueType {
+                // Swift values can't be moved in C++, so copy the named instance into our storage.
+                constructorLines.append("    new (" + swiftObjectStorageName + ") " + scopedSwiftClassName + "(instance);")
+            } else {
+                constructorLines.append("    " + swiftObjectName + " = std::make_shared<" + scopedSwiftClassName + ">(instance);")
+            }
             constructorLines.append("}")
             generatedConstructorImplementations.append(constructorLines)
         } else {
@@ -576,14 +786,24 @@ struct UnmanagedManagedCPPWrapperClass {
             func adaptArray(fromStdVectorNamed sourceName: String, toSwiftArrayNamed destName: String, containing destType: String, mapping: TypeMapping) -> [String] {
                 var lines: [String] = []
                 lines.append("swift::Array<" + destType + "> " + destName + " = swift::Array<" + destType + ">::init();");
-                lines.append("for (auto element: " + sourceName + ") {")
+                lines.append("for (const auto &element : " + sourceName + ") {")
                 lines.append("    " + destName + ".append(" + mapping.convertWrapperToWrapped("element", true) + ");")
                 lines.append("}")
                 return lines
             }
 
+            if let callbackRegistration {
+                methodLines.append(contentsOf: callbackRegistration.generateArgumentAdaptation(
+                    from: swiftArguments[callbackRegistration.callbackIndex].argumentName, parameterName: parameterName).map({ "    " + $0 }))
+            }
+
             // Adapt the parameters
             for (index, argument) in swiftArguments.enumerated() {
+                // Callback arguments have been adapted above.
+                if let callbackRegistration, callbackRegistration.replacedIndexes.contains(index) || index == callbackRegistration.callbackIndex {
+                    continue
+                }
+
                 // We need to bridge each argument to the Swift type.
                 let swiftType = argument.typeName
                 let mapping = wrapping(for: swiftType)
@@ -592,7 +812,7 @@ struct UnmanagedManagedCPPWrapperClass {
                     let wrappedTypeName: String = (argument.isArrayType ? "swift::Optional<swift::Array<" + mapping.wrappedTypeName + ">>" : "swift::Optional<" + mapping.wrappedTypeName + ">")
                     // swift::Optional<swift::String> arg1 = (optionalString.has_value() ? swift::Optional<swift::String>::init((swift::String)optionalString.value()) : swift::Optional<swift::String>::none());
                     let adaptedArgument: String = wrappedTypeName + " " + parameterName + "\(index) = (" + argument.argumentName + ".has_value() ? " +
-                        wrappedTypeName + "::init(*" + mapping.convertWrapperToWrapped(argument.argumentName, false) + ") : " +
+                        wrappedTypeName + "::init(" + mapping.convertWrapperToWrapped(argument.argumentName + ".value()", true) + ") : " +
                         wrappedTypeName + "::none());"
                     methodLines.append("    " + adaptedArgument)
                     if argument.isArrayType {
@@ -613,7 +833,7 @@ struct UnmanagedManagedCPPWrapperClass {
             }).joined(separator: ", ")
 
             if swiftReturnArgument.isVoidType {
-                let methodCall: String = swiftObjectName + "->" + swiftMethodName + "(" + args + ");"
+                let methodCall: String = swiftObjectMemberAccess + swiftMethodName + "(" + args + ");"
                 methodLines.append("    " + methodCall)
             } else {
                 // Call the method!
@@ -624,7 +844,7 @@ struct UnmanagedManagedCPPWrapperClass {
                     let methodCall: String = returnType + " swiftResult = " + scopedSwiftClassName + "::" + swiftMethodName + "(" + args + ");"
                     methodLines.append("    " + methodCall)
                 } else {
-                    let call: String = (isStatic ? scopedSwiftClassName + "::" : swiftObjectName + "->")
+                    let call: String = (isStatic ? scopedSwiftClassName + "::" : swiftObjectMemberAccess)
                     let methodCall: String = returnType + " swiftResult = " + call + swiftMethodName + "(" + args + ");"
                     methodLines.append("    " + methodCall)
                 }
@@ -632,8 +852,8 @@ struct UnmanagedManagedCPPWrapperClass {
                 /*
                 std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> arrayResult;
                 arrayResult.reserve(swiftResult.getCount());
-                for (auto element : swiftResult) {
-                    arrayResult.push_back(UnmanagedCascableCoreBasicAPI::BasicPropertyValue(std::make_shared<CascableCoreBasicAPI::BasicPropertyValue>(element)));
+                for (const auto &element : swiftResult) {
+                    arrayResult.emplace_back(UnmanagedCascableCoreBasicAPI::BasicPropertyValue(std::make_shared<CascableCoreBasicAPI::BasicPropertyValue>(element)));
                 }
                 return arrayResult;
                 */
@@ -642,8 +862,8 @@ struct UnmanagedManagedCPPWrapperClass {
                     var lines: [String] = []
                     lines.append("std::vector<" + mapping.wrapperTypeName + "> " + vectorName + ";")
                     lines.append(vectorName + ".reserve(" + sourceName + ".getCount());")
-                    lines.append("for (auto element : " + sourceName + ") {")
-                    lines.append("    " + vectorName + ".push_back(" + mapping.convertWrappedToWrapper("element", true) + ");")
+                    lines.append("for (const auto &element : " + sourceName + ") {")
+                    lines.append("    " + vectorName + ".emplace_back(" + mapping.convertWrappedToWrapper("element", true) + ");")
                     lines.append("}")
                     return lines
                 }
@@ -658,7 +878,7 @@ struct UnmanagedManagedCPPWrapperClass {
                         optionalConversionLines.append("    swift::Array<" + returnTypeMapping.wrappedTypeName + "> unwrapped = swiftResult.get();")
                         let arrayLines = adaptArray(toStdVectorNamed: "unwrappedArray", fromSwiftArrayNamed: "unwrapped", using: returnTypeMapping)
                         optionalConversionLines.append(contentsOf: arrayLines.map({ "    " + $0 }))
-                        optionalConversionLines.append("    return std::optional<std::vector<" + returnTypeMapping.wrapperTypeName + ">>(unwrappedArray);")
+                        optionalConversionLines.append("    return std::optional<std::vector<" + returnTypeMapping.wrapperTypeName + ">>(std::move(unwrappedArray));")
                     } else {
                         optionalConversionLines.append("    " + returnTypeMapping.wrappedTypeName + " unwrapped = swiftResult.get();")
                         optionalConversionLines.append("    return std::optional<" + returnTypeMapping.wrapperTypeName + ">(" +
@@ -693,13 +913,40 @@ struct UnmanagedManagedCPPWrapperClass {
 
         lines.append("class " + wrapperClassName + " {")
         lines.append("private:")
+        if let valueTypeLayout {
+            lines.append("    alignas(\(valueTypeLayout.alignment)) unsigned char " + swiftObjectStorageName + "[\(valueTypeLayout.size)];")
+        }
         lines.append("public:")
-        lines.append("    std::shared_ptr<" + scopedSwiftClassName + "> " + swiftObjectName + ";")
-        lines.append("    " + wrapperClassName + "(std::shared_ptr<" + scopedSwiftClassName + "> " + swiftObjectName + ");")
+        if isValueType {
+            lines.append("    " + wrapperClassName + "(const " + scopedSwiftClassName + " &value);")
+            lines.append("    " + wrapperClassName + "(const " + scopedWrapperClassName + " &other);")
+            lines.append("    " + scopedWrapperClassName + " &operator=(const " + scopedWrapperClassName + " &other);")
+        } else {
+            lines.append("    std::shared_ptr<" + scopedSwiftClassName + "> " + swiftObjectName + ";")
+            lines.append("    " + wrapperClassName + "(std::shared_ptr<" + scopedSwiftClassName + "> " + swiftObjectName + ");")
+            // Our destructor is user-declared, which would otherwise suppress the implicit move operations and
+            // make every copy of a wrapper bump the shared pointer's reference count.
+            lines.append("    " + wrapperClassName + "(const " + scopedWrapperClassName + " &other) = default;")
+            lines.append("    " + wrapperClassName + "(" + scopedWrapperClassName + " &&other) noexcept = default;")
+            lines.append("    " + scopedWrapperClassName + " &operator=(const " + scopedWrapperClassName + " &other) = default;")
+            lines.append("    " + scopedWrapperClassName + " &operator=(" + scopedWrapperClassName + " &&other) noexcept = default;")
+        }
         lines.append(contentsOf: generatedConstructorDefinitions.map({ "    " + $0 }))
         lines.append("    ~" + wrapperClassName + "();")
         lines.append("")
 
+        if isValueType {
+            lines.append("    const " + scopedSwiftClassName + " &" + swiftObjectName + "() const;")
+            lines.append("    " + scopedSwiftClassName + " &" + swiftObjectName + "();")
+            lines.append("")
+        }
+
+        if isByteBuffer {
+            lines.append("    // The span is valid for as long as this object, or any copy of it, exists.")
+            lines.append("    " + wrapperNamespace + "::" + Self.byteSpanTypeName + " span() const;")
+            lines.append("")
+        }
+
         if !generatedStaticMethodDefinitions.isEmpty {
             lines.append(contentsOf: generatedStaticMethodDefinitions.map({ "    " + $0 }))
             lines.append("")
@@ -716,6 +963,17 @@ struct UnmanagedManagedCPPWrapperClass {
             lines.append("    "  + methodDefinition)
         }
 
+        if !generatedAwaitableMethodDefinitions.isEmpty {
+            lines.append("")
+            lines.append("#if " + coroutineSupportMacroName)
+            lines.append("    // Awaitable versions of the methods taking a completion. The awaiting coroutine is resumed on the thread")
+            lines.append("    // the completion is called on, unless the awaitable is given an executor with resumingOn().")
+            for awaitableMethodDefinition in generatedAwaitableMethodDefinitions {
+                lines.append(contentsOf: awaitableMethodDefinition.map({ "    " + $0 }))
+            }
+            lines.append("#endif")
+        }
+
         lines.append("};")
         return lines
     }
@@ -726,18 +984,52 @@ struct UnmanagedManagedCPPWrapperClass {
         let scopedSwiftClassName: String = swiftModuleName + "::" + swiftClassName
         let scopedWrapperClassName: String = wrapperNamespace + "::" + wrapperClassName
 
-        lines.append(scopedWrapperClassName + "::" + wrapperClassName + "(std::shared_ptr<" + scopedSwiftClassName + "> " + swiftObjectName + ") {")
-        lines.append("    this->" + swiftObjectName + " = " + swiftObjectName + ";")
-        lines.append("}")
-        lines.append("")
+        if let valueTypeLayout {
+            let storage = swiftObjectStorageName
+            lines.append(scopedWrapperClassName + "::" + wrapperClassName + "(const " + scopedSwiftClassName + " &value) {")
+            lines.append("    static_assert(sizeof(" + scopedSwiftClassName + ") <= \(valueTypeLayout.size) && alignof(" +
+                         scopedSwiftClassName + ") <= \(valueTypeLayout.alignment), \"Inline storage for " +
+                         swiftClassName + " is too small. Regenerate the wrapper.\");")
+            lines.append("    new (" + storage + ") " + scopedSwiftClassName + "(value);")
+            lines.append("}")
+            lines.append("")
+            lines.append(scopedWrapperClassName + "::" + wrapperClassName + "(const " + scopedWrapperClassName + " &other) {")
+            lines.append("    new (" + storage + ") " + scopedSwiftClassName + "(other." + swiftObjectName + "());")
+            lines.append("}")
+            lines.append("")
+            lines.append(scopedWrapperClassName + " &" + scopedWrapperClassName + "::operator=(const " + scopedWrapperClassName + " &other) {")
+            lines.append("    " + swiftObjectName + "() = other." + swiftObjectName + "();")
+            lines.append("    return *this;")
+            lines.append("}")
+            lines.append("")
+        } else {
+            lines.append(scopedWrapperClassName + "::" + wrapperClassName + "(std::shared_ptr<" + scopedSwiftClassName + "> " + swiftObjectName + ")")
+            lines.append("    : " + swiftObjectName + "(std::move(" + swiftObjectName + ")) {}")
+            lines.append("")
+        }
 
         for constructor in generatedConstructorImplementations {
             lines.append(contentsOf: constructor)
             lines.append("")
         }
 
-        lines.append(scopedWrapperClassName + "::~" + wrapperClassName + "() {}")
-        lines.append("")
+        if isValueType {
+            lines.append(scopedWrapperClassName + "::~" + wrapperClassName + "() {")
+            lines.append("    " + swiftObjectName + "().~" + swiftClassName + "();")
+            lines.append("}")
+            lines.append("")
+            lines.append("const " + scopedSwiftClassName + " &" + scopedWrapperClassName + "::" + swiftObjectName + "() const {")
+            lines.append("    return *reinterpret_cast<const " + scopedSwiftClassName + " *>(" + swiftObjectStorageName + ");")
+            lines.append("}")
+            lines.append("")
+            lines.append(scopedSwiftClassName + " &" + scopedWrapperClassName + "::" + swiftObjectName + "() {")
+            lines.append("    return *reinterpret_cast<" + scopedSwiftClassName + " *>(" + swiftObjectStorageName + ");")
+            lines.append("}")
+            lines.append("")
+        } else {
+            lines.append(scopedWrapperClassName + "::~" + wrapperClassName + "() {}")
+            lines.append("")
+        }
 
         if !generatedEnumCaseImplementations.isEmpty {
             for generatedEnumCaseImplementation in generatedEnumCaseImplementations {
@@ -750,17 +1042,280 @@ struct UnmanagedManagedCPPWrapperClass {
             // }
             var comparator: [String] = []
             comparator.append("bool " + scopedWrapperClassName + "::operator==(const " + scopedWrapperClassName + " &other) const {")
-            comparator.append("    return (*\(swiftObjectName).get() == *other.\(swiftObjectName).get());")
+            if isValueType {
+                comparator.append("    return (\(swiftObjectName)() == other.\(swiftObjectName)());")
+            } else {
+                comparator.append("    return (*\(swiftObjectName).get() == *other.\(swiftObjectName).get());")
+            }
             comparator.append("}")
 
             lines.append(contentsOf: comparator)
             lines.append("")
         }
 
+        if isByteBuffer {
+            let scopedSpanTypeName = wrapperNamespace + "::" + Self.byteSpanTypeName
+            lines.append(scopedSpanTypeName + " " + scopedWrapperClassName + "::span() const {")
+            lines.append("    return " + scopedSpanTypeName + " { " + swiftObjectMemberAccess + "getBytes(), (size_t)" +
+                         swiftObjectMemberAccess + "getCount() };")
+            lines.append("}")
+            lines.append("")
+        }
+
         for implementation in generatedMethodImplementations {
             lines.append(contentsOf: implementation)
             lines.append("")
         }
         return lines
     }
+
+    /// Returns the definition of the awaitable returned by the coroutine versions of completion-handler methods.
+    ///
+    /// The operation is started when the awaitable is awaited, and completing it resumes the awaiting coroutine. By
+    /// default the coroutine is resumed inline on the thread the completion is called on. Callers whose coroutines
+    /// shouldn't run there (a UI thread, say, or a thread pool of their own) give the awaitable an executor with
+    /// `resumingOn()`, which is handed the coroutine to resume however it likes.
+    static func generateCompletionAwaitableDefinition() -> [String] {
+        let name = completionAwaitableTypeName
+        return [
+            "// Resumes a coroutine awaiting a completion, on whichever thread it chooses.",
+            "using " + completionExecutorTypeName + " = std::function<void(std::coroutine_handle<>)>;",
+            "",
+            "template <typename Result>",
+            "class " + name + " {",
+            "public:",
+            "    using Completion = std::function<void(Result)>;",
+            "    explicit " + name + "(std::function<void(Completion)> start) : start(std::move(start)) {}",
+            "",
+            "    // Returns the awaitable with the awaiting coroutine resumed by the given executor, rather than inline on",
+            "    // the thread the completion is called on.",
+            "    " + name + " resumingOn(" + completionExecutorTypeName + " executor) && {",
+            "        this->executor = std::move(executor);",
+            "        return std::move(*this);",
+            "    }",
+            "",
+            "    bool await_ready() const noexcept { return false; }",
+            "",
+            "    void await_suspend(std::coroutine_handle<> handle) {",
+            "        // Once started, the coroutine may be resumed and this awaitable destroyed before we return, so we",
+            "        // mustn't touch our members after that.",
+            "        std::function<void(Completion)> starter = std::move(start);",
+            "        starter([this, handle, executor = std::move(executor)](Result value) {",
+            "            result.emplace(std::move(value));",
+            "            if (executor) { executor(handle); } else { handle.resume(); }",
+            "        });",
+            "    }",
+            "",
+            "    Result await_resume() { return std::move(*result); }",
+            "",
+            "private:",
+            "    std::function<void(Completion)> start;",
+            "    " + completionExecutorTypeName + " executor;",
+            "    std::optional<Result> result;",
+            "};",
+            "",
+            "template <>",
+            "class " + name + "<void> {",
+            "public:",
+            "    using Completion = std::function<void()>;",
+            "    explicit " + name + "(std::function<void(Completion)> start) : start(std::move(start)) {}",
+            "",
+            "    " + name + " resumingOn(" + completionExecutorTypeName + " executor) && {",
+            "        this->executor = std::move(executor);",
+            "        return std::move(*this);",
+            "    }",
+            "",
+            "    bool await_ready() const noexcept { return false; }",
+            "",
+            "    void await_suspend(std::coroutine_handle<> handle) {",
+            "        std::function<void(Completion)> starter = std::move(start);",
+            "        starter([handle, executor = std::move(executor)]() {",
+            "            if (executor) { executor(handle); } else { handle.resume(); }",
+            "        });",
+            "    }",
+            "",
+            "    void await_resume() {}",
+            "",
+            "private:",
+            "    std::function<void(Completion)> start;",
+            "    " + completionExecutorTypeName + " executor;",
+            "};"
+        ]
+    }
+
+    /// Returns the given type name with clang's nullability qualifiers removed. They're a clang extension, so they'd
+    /// trip up other compilers.
+    static func strippingNullability(from typeName: String) -> String {
+        return ["_Nullable", "_Nonnull", "_Null_unspecified"].reduce(typeName, {
+            $0.replacingOccurrences(of: " " + $1, with: "")
+        })
+    }
+
+    /// If the given type is a pointer to a C function taking a context pointer and returning nothing, returns the
+    /// types of the function's other parameters. Otherwise, returns `nil`.
+    static func callbackParameterTypeNames(of type: CXType) -> [String]? {
+        var pointerType: CXType = type
+        while pointerType.kind == CXType_Attributed { pointerType = clang_Type_getModifiedType(pointerType) }
+        guard pointerType.kind == CXType_Pointer else { return nil }
+
+        // Function pointer declarators can leave the function type behind parentheses.
+        var functionType: CXType = clang_getPointeeType(pointerType)
+        if functionType.kind != CXType_FunctionProto { functionType = clang_getCanonicalType(functionType) }
+        guard functionType.kind == CXType_FunctionProto, clang_getResultType(functionType).kind == CXType_Void else { return nil }
+
+        let parameterCount = clang_getNumArgTypes(functionType)
+        guard parameterCount > 0 else { return nil }
+        let parameterTypeNames: [String] = (0..<UInt32(parameterCount)).map({
+            strippingNullability(from: clang_getTypeSpelling(clang_getArgType(functionType, $0)).consumeToString)
+        })
+
+        guard parameterTypeNames[0] == CallbackRegistration.contextTypeName else { return nil }
+        return Array(parameterTypeNames.dropFirst())
+    }
+
+    /// Swift objects can't be passed through C function types, so callbacks are given them as `void *` handles, each
+    /// holding a reference that the receiver takes over. The objects' class is named by the registration method:
+    /// `setLiveViewFrameCallback` is given `BasicLiveViewFrame` handles, for example.
+    ///
+    /// Returns a mapping that adopts a handle into a wrapper of the named class, or `nil` if the method doesn't name
+    /// exactly one wrapped class.
+    static func callbackHandleMapping(forRegistrationMethodNamed methodName: String,
+                                      in internalTypeMappings: [String: TypeMapping]) -> TypeMapping? {
+        let prefix: String = "set"
+        let suffix: String = "Callback"
+        guard methodName.hasPrefix(prefix), methodName.hasSuffix(suffix),
+              methodName.count > prefix.count + suffix.count else { return nil }
+        let objectName = String(methodName.dropFirst(prefix.count).dropLast(suffix.count))
+
+        // Class names can carry a prefix that the method name leaves out.
+        let classNames = internalTypeMappings.keys.filter({ !$0.hasSuffix("&") && $0.hasSuffix(objectName) })
+        let className: String? = (classNames.contains(objectName) ? objectName : (classNames.count == 1 ? classNames.first : nil))
+        guard let className, let classMapping = internalTypeMappings[className],
+              let separator = classMapping.wrappedTypeName.range(of: "::", options: .backwards) else { return nil }
+
+        let scopedSwiftClassName = classMapping.wrappedTypeName
+        let implClassName: String = String(scopedSwiftClassName[..<separator.lowerBound]) + "::_impl::_impl_" +
+            String(scopedSwiftClassName[separator.upperBound...])
+        return TypeMapping(wrappedTypeName: CallbackRegistration.contextTypeName, wrapperTypeName: classMapping.wrapperTypeName,
+                           convertWrapperToWrapped: { name, _ in
+            // Wrappers are never passed back as handles.
+            return name
+        }, convertWrappedToWrapper: { name, isConst in
+            // makeRetained() takes over the handle's reference, rather than adding one of its own.
+            return classMapping.convertWrappedToWrapper(implClassName + "::makeRetained(" + name + ")", isConst)
+        })
+    }
+
+    /// Returns the definition of the non-owning span type returned by byte buffer wrappers.
+    static func generateByteSpanDefinition() -> [String] {
+        return [
+            "struct " + byteSpanTypeName + " {",
+            "    const uint8_t *data;",
+            "    size_t size;",
+            "",
+            "    const uint8_t *begin() const { return data; }",
+            "    const uint8_t *end() const { return data + size; }",
+            "    bool empty() const { return size == 0; }",
+            "};"
+        ]
+    }
+}
+
+/// A Swift method's callback registration arguments: an opaque context pointer, a callback that's called with it,
+/// and a function to release it with.
+///
+/// The wrapper takes a `std::function` instead, and boxes it on the heap to use as the context. The callback and
+/// release functions are capture-less trampolines that call and delete the box, respectively.
+struct CallbackRegistration {
+    static let contextTypeName: String = "void *"
+    static let contextArgumentName: String = "context"
+    static let releaseArgumentName: String = "releaseContext"
+    static let completionArgumentName: String = "completion"
+
+    let contextIndex: Int
+    let callbackIndex: Int
+    let releaseIndex: Int
+
+    // The C types the callback is called with (excluding the context), and the unmanaged types we present them as.
+    let parameterTypeNames: [String]
+    let parameterMappings: [TypeMapping]
+
+    // The indexes of the callback's parameters that are handles to Swift objects. See callbackHandleMapping(…).
+    let handleParameterIndexes: [Int]
+
+    /// Finds the registration arguments in the given list, or returns `nil` if they don't follow the convention.
+    /// Callbacks given Swift object handles need a mapping to adopt them with.
+    init?(arguments: [MethodArgument], handleMapping: TypeMapping? = nil) {
+        guard let contextIndex = arguments.firstIndex(where: {
+                  $0.argumentName == Self.contextArgumentName && $0.typeName == Self.contextTypeName && !$0.isCallbackType }),
+              let releaseIndex = arguments.firstIndex(where: {
+                  $0.argumentName == Self.releaseArgumentName && $0.callbackParameterTypeNames == [] }) else { return nil }
+
+        // We only support one callback per context.
+        let callbackIndexes = arguments.indices.filter({ arguments[$0].isCallbackType && $0 != releaseIndex })
+        guard callbackIndexes.count == 1, let parameterTypeNames = arguments[callbackIndexes[0]].callbackParameterTypeNames else { return nil }
+
+        let handleParameterIndexes = parameterTypeNames.indices.filter({ parameterTypeNames[$0] == Self.contextTypeName })
+        guard handleParameterIndexes.isEmpty || handleMapping != nil else { return nil }
+
+        self.contextIndex = contextIndex
+        self.callbackIndex = callbackIndexes[0]
+        self.releaseIndex = releaseIndex
+        self.parameterTypeNames = parameterTypeNames
+        self.handleParameterIndexes = handleParameterIndexes
+        self.parameterMappings = parameterTypeNames.map({ typeName in
+            if typeName == Self.contextTypeName, let handleMapping { return handleMapping }
+            // Swift's integer types are spelled as their C equivalents in function pointer types.
+            let swiftTypeName: String = ["ptrdiff_t": "swift::Int", "size_t": "swift::UInt"][typeName] ?? typeName
+            return SwiftToUnmanagedTypeMappings.unmanagedMapping(from: swiftTypeName) ?? .direct(for: typeName)
+        })
+    }
+
+    /// If the callback is a completion, called once when an operation finishes, returns the type its result is
+    /// presented as when awaited. Only completions called with at most one value can be awaited.
+    func awaitableResultTypeName(for arguments: [MethodArgument]) -> String? {
+        guard arguments[callbackIndex].argumentName == Self.completionArgumentName, parameterMappings.count <= 1 else { return nil }
+        return parameterMappings.first?.wrapperTypeName ?? "void"
+    }
+
+    /// The indexes of the arguments that don't appear in the wrapper's signature.
+    var replacedIndexes: [Int] { return [contextIndex, releaseIndex] }
+
+    /// The type of the wrapper's callback argument.
+    var unmanagedFunctionTypeName: String {
+        return "std::function<void(" + parameterMappings.map({ $0.wrapperTypeName }).joined(separator: ", ") + ")>"
+    }
+
+    /// Returns lines declaring the Swift method's context, callback and release arguments, named with the given
+    /// parameter name and their index.
+    func generateArgumentAdaptation(from argumentName: String, parameterName: String) -> [String] {
+        let functionTypeName = unmanagedFunctionTypeName
+        let contextParameterTypes = ([Self.contextTypeName] + parameterTypeNames).joined(separator: ", ")
+        let contextParameters = ([Self.contextTypeName + "context"] + parameterTypeNames.enumerated().map({ "\($1) value\($0)" }))
+            .joined(separator: ", ")
+        let invocationArguments = parameterMappings.enumerated().map({ index, mapping in
+            return handleParameterIndexes.contains(index) ? "std::move(object\(index))" : mapping.convertWrappedToWrapper("value\(index)", false)
+        }).joined(separator: ", ")
+
+        var lines: [String] = []
+        lines.append(functionTypeName + " *" + parameterName + "\(contextIndex) = new " + functionTypeName + "(std::move(" + argumentName + "));")
+        lines.append("void (*" + parameterName + "\(callbackIndex))(" + contextParameterTypes + ") = [](" + contextParameters + ") {")
+        lines.append("    const " + functionTypeName + " &function = *static_cast<" + functionTypeName + " *>(context);")
+        lines.append("    // Exceptions can't unwind through Swift, so they have to stop here.")
+        lines.append("    try {")
+        if !handleParameterIndexes.isEmpty {
+            lines.append("        // Handles are adopted even if there's no function to pass them to, so their references are always released.")
+        }
+        for index in handleParameterIndexes {
+            let mapping = parameterMappings[index]
+            lines.append("        " + mapping.wrapperTypeName + " object\(index) = " + mapping.convertWrappedToWrapper("value\(index)", false) + ";")
+        }
+        lines.append("        if (function) { function(" + invocationArguments + "); }")
+        lines.append("    } catch (...) {}")
+        lines.append("};")
+        lines.append("void (*" + parameterName + "\(releaseIndex))(" + Self.contextTypeName + ") = [](" + Self.contextTypeName + "context) {")
+        lines.append("    delete static_cast<" + functionTypeName + " *>(context);")
+        lines.append("};")
+        return lines
+    }
 }
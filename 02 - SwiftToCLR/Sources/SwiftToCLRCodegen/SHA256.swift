@@ -0,0 +1,112 @@
+import Foundation
+
+/// SHA-256, as specified in FIPS 180-4.
+///
+/// CryptoKit isn't available on Windows, and the generation cache only needs a digest, so this saves depending on a
+/// whole crypto library. It isn't fast, but it's only ever given headers.
+struct SHA256 {
+
+    init() {}
+
+    /// Adds the given bytes to the message.
+    mutating func update(with data: Data) {
+        messageLength &+= UInt64(data.count)
+        for byte in data {
+            block.append(byte)
+            if block.count == Self.blockSize {
+                processBlock()
+                block.removeAll(keepingCapacity: true)
+            }
+        }
+    }
+
+    /// Adds the given string's UTF-8 bytes to the message.
+    mutating func update(with string: String) {
+        update(with: Data(string.utf8))
+    }
+
+    /// Returns the digest of the message so far, as a lowercase hex string. More can be added to the message afterwards.
+    func finalize() -> String {
+        var padded = self
+        let bitLength: UInt64 = messageLength &* 8
+
+        // The message is padded with a single set bit, then zeros up to 8 bytes short of a whole block, then its length.
+        var padding = Data([0x80])
+        let zeroCount = (Self.blockSize - 8 - (block.count + 1) % Self.blockSize + Self.blockSize) % Self.blockSize
+        padding.append(contentsOf: [UInt8](repeating: 0, count: zeroCount))
+        padding.append(contentsOf: (0..<8).reversed().map({ UInt8(truncatingIfNeeded: bitLength >> UInt64($0 * 8)) }))
+        padded.update(with: padding)
+
+        return padded.state.map({ word in
+            let hex = String(word, radix: 16)
+            return String(repeating: "0", count: 8 - hex.count) + hex
+        }).joined()
+    }
+
+    // MARK: - Internal
+
+    private static let blockSize: Int = 64
+
+    private var state: [UInt32] = [0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19]
+    private var block: [UInt8] = []
+    private var messageLength: UInt64 = 0
+
+    private mutating func processBlock() {
+        var schedule = [UInt32](repeating: 0, count: 64)
+        for index in 0..<16 {
+            let high = UInt32(block[index * 4]) << 24 | UInt32(block[index * 4 + 1]) << 16
+            let low = UInt32(block[index * 4 + 2]) << 8 | UInt32(block[index * 4 + 3])
+            schedule[index] = high | low
+        }
+        for index in 16..<64 {
+            let early = schedule[index - 15]
+            let late = schedule[index - 2]
+            let sigma0 = Self.rotateRight(early, by: 7) ^ Self.rotateRight(early, by: 18) ^ (early >> 3)
+            let sigma1 = Self.rotateRight(late, by: 17) ^ Self.rotateRight(late, by: 19) ^ (late >> 10)
+            schedule[index] = schedule[index - 16] &+ sigma0 &+ schedule[index - 7] &+ sigma1
+        }
+
+        var a = state[0], b = state[1], c = state[2], d = state[3]
+        var e = state[4], f = state[5], g = state[6], h = state[7]
+        for index in 0..<64 {
+            let sum1 = Self.rotateRight(e, by: 6) ^ Self.rotateRight(e, by: 11) ^ Self.rotateRight(e, by: 25)
+            let choice = (e & f) ^ (~e & g)
+            let temp1 = h &+ sum1 &+ choice &+ Self.roundConstants[index] &+ schedule[index]
+            let sum0 = Self.rotateRight(a, by: 2) ^ Self.rotateRight(a, by: 13) ^ Self.rotateRight(a, by: 22)
+            let majority = (a & b) ^ (a & c) ^ (b & c)
+            let temp2 = sum0 &+ majority
+            h = g
+            g = f
+            f = e
+            e = d &+ temp1
+            d = c
+            c = b
+            b = a
+            a = temp1 &+ temp2
+        }
+
+        state[0] &+= a
+        state[1] &+= b
+        state[2] &+= c
+        state[3] &+= d
+        state[4] &+= e
+        state[5] &+= f
+        state[6] &+= g
+        state[7] &+= h
+    }
+
+    private static func rotateRight(_ value: UInt32, by amount: UInt32) -> UInt32 {
+        return (value >> amount) | (value << (32 - amount))
+    }
+
+    private static let roundConstants: [UInt32] = [
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    ]
+}
@@ -61,6 +61,10 @@ public struct UnmanagedToManagedOperation {
         var wrapperClasses: OrderedDictionary<String, ManagedCPPWrapperClass> = [:]
         var internalTypeMappings: [String: TypeMapping] = [:]
 
+        // The namespaces of the types the unmanaged classes wrap. The unmanaged header forward-declares these, and
+        // members exposing them are plumbing between the unmanaged classes rather than API to wrap.
+        var wrappedNamespaces: Set<String> = []
+
         let translationCursor: CXCursor = clang_getTranslationUnitCursor(unit)
 
         // We have to do this to avoid captuing self
@@ -88,6 +92,9 @@ public struct UnmanagedToManagedOperation {
             if cursorKind == CXCursor_ClassDecl && parentKind == CXCursor_Namespace {
                 let className = displayName
                 let namespaceName = clang_getCursorDisplayName(parent).consumeToString
+                if namespaceName != inputNamespace {
+                    wrappedNamespaces.insert(namespaceName)
+                }
                 if namespaceName == inputNamespace {
                     if verbose { print("Got class \(className) in target namespace \(namespaceName) - adding to wrapper list.") }
                     let wrapperClass = ManagedCPPWrapperClass(unmanagedClassName: className,
@@ -133,16 +140,20 @@ public struct UnmanagedToManagedOperation {
             if type.kind == CXType_FunctionProto && cursorKind == CXCursor_CXXMethod && parentKind == CXCursor_ClassDecl {
                 let className = clang_getCursorDisplayName(parent).consumeToString
                 if var wrapperClass = wrapperClasses[className], clang_getCXXAccessSpecifier(cursor) == CX_CXXPublic {
-                    if verbose { print("Got public method \(displayName) in class \(className) - adding to wrapper list.") }
-                    wrapperClass.generateWrappedMethodForUnmanagedMethod(at: cursor, internalTypeMappings: internalTypeMappings)
-                    wrapperClasses[className] = wrapperClass // CoW and all that
+                    let wasIngested = wrapperClass.generateWrappedMethodForUnmanagedMethod(at: cursor, internalTypeMappings: internalTypeMappings,
+                                                                                           wrappedNamespaces: wrappedNamespaces)
+                    if wasIngested {
+                        if verbose { print("Got public method \(displayName) in class \(className) - adding to wrapper list.") }
+                        wrapperClasses[className] = wrapperClass // CoW and all that
+                    }
                 }
             }
 
             if cursorKind == CXCursor_Constructor && parentKind == CXCursor_ClassDecl {
                 let className = clang_getCursorDisplayName(parent).consumeToString
                 if var wrapperClass = wrapperClasses[className], clang_getCXXAccessSpecifier(cursor) == CX_CXXPublic {
-                    let wasIngested = wrapperClass.generateWrappedConstructorForUnmanagedConstructor(at: cursor, internalTypeMappings: internalTypeMappings)
+                    let wasIngested = wrapperClass.generateWrappedConstructorForUnmanagedConstructor(at: cursor, internalTypeMappings: internalTypeMappings,
+                                                                                                     wrappedNamespaces: wrappedNamespaces)
                     if wasIngested {
                         if verbose { print("Got public constructor \(displayName) in class \(className) - adding to wrapper list.") }
                         wrapperClasses[className] = wrapperClass // CoW and all that
@@ -188,6 +199,9 @@ public struct UnmanagedToManagedOperation {
             "",
             "#include \"" + outputNamespace + ".hpp\"",
             "#include <msclr/marshal_cppstd.h>",
+            "#include <vcclr.h>",
+            "#include <cstring>",
+            "#include <utility>",
             "",
             "using namespace msclr::interop;",
             "using namespace System::Collections::Generic;",
@@ -249,8 +263,52 @@ struct UnmanagedToManagedTypeMappings {
         stdStringMapping.wrapperTypeName: stdStringMapping
     ]
 
-    static func managedMapping(from unmanagedTypeName: String) -> TypeMapping? {
-        return mappingsByUnManagedType[unmanagedTypeName]
+    static func managedMapping(from unmanagedTypeName: String, internalTypeMappings: [String: TypeMapping] = [:]) -> TypeMapping? {
+        return mappingsByUnManagedType[unmanagedTypeName] ?? callbackMapping(from: unmanagedTypeName, internalTypeMappings: internalTypeMappings)
+    }
+
+    /// Returns a mapping from a `std::function` returning `void` to the equivalent `System::Action` delegate.
+    ///
+    /// The delegate is held by a `gcroot` captured in the function, so it stays alive for as long as the unmanaged
+    /// side keeps the function around. Wrapper objects the function is given are moved into managed wrappers.
+    static func callbackMapping(from unmanagedTypeName: String, internalTypeMappings: [String: TypeMapping] = [:]) -> TypeMapping? {
+        guard let parameterTypeNames = callbackParameterTypeNames(from: unmanagedTypeName) else { return nil }
+        let parameterMappings: [TypeMapping] = callbackParameterMappings(from: parameterTypeNames, internalTypeMappings: internalTypeMappings)
+
+        let delegateTypeName: String = parameterMappings.isEmpty ? "System::Action^" :
+            "System::Action<" + parameterMappings.map({ $0.wrapperTypeName }).joined(separator: ", ") + ">^"
+        let lambdaParameters = parameterTypeNames.enumerated().map({ "\($1) value\($0)" }).joined(separator: ", ")
+        let invocationArguments = parameterTypeNames.enumerated().map({ index, typeName in
+            let valueName: String = (internalTypeMappings[typeName] != nil ? "std::move(value\(index))" : "value\(index)")
+            return parameterMappings[index].convertWrappedToWrapper(valueName, false)
+        }).joined(separator: ", ")
+
+        return TypeMapping(wrappedTypeName: unmanagedTypeName, wrapperTypeName: delegateTypeName, convertWrapperToWrapped: { name, _ in
+            let handlerName = name + "Handler"
+            return "(" + name + " == nullptr ? " + unmanagedTypeName + "() : " + unmanagedTypeName + "([" + handlerName +
+                " = gcroot<" + delegateTypeName + ">(" + name + ")](" + lambdaParameters + ") { " + handlerName +
+                "->Invoke(" + invocationArguments + "); }))"
+        }, convertWrappedToWrapper: { name, _ in
+            // Unmanaged methods only take callbacks, they don't return them.
+            return name
+        })
+    }
+
+    /// If the given type is a `std::function` returning `void`, returns the types of its parameters.
+    static func callbackParameterTypeNames(from unmanagedTypeName: String) -> [String]? {
+        let prefix: String = "std::function<void"
+        let suffix: String = ")>"
+        guard unmanagedTypeName.hasPrefix(prefix), unmanagedTypeName.hasSuffix(suffix) else { return nil }
+        let signature = unmanagedTypeName.dropFirst(prefix.count).dropLast(suffix.count).trimmingCharacters(in: .whitespaces)
+        guard signature.hasPrefix("(") else { return nil }
+
+        let parameterList = signature.dropFirst().trimmingCharacters(in: .whitespaces)
+        guard !parameterList.isEmpty, parameterList != "void" else { return [] }
+        return parameterList.components(separatedBy: ",").map({ $0.trimmingCharacters(in: .whitespaces) })
+    }
+
+    static func callbackParameterMappings(from parameterTypeNames: [String], internalTypeMappings: [String: TypeMapping] = [:]) -> [TypeMapping] {
+        return parameterTypeNames.map({ mappingsByUnManagedType[$0] ?? internalTypeMappings[$0] ?? .direct(for: $0) })
     }
 }
 
@@ -265,6 +323,9 @@ struct ManagedCPPWrapperClass {
 
     let useSharedPtrs: Bool
 
+    // True if the unmanaged class is a byte buffer, exposing its contents via a span.
+    var isByteBuffer: Bool = false
+
     var generatedMethodDefinitions: [String] // For the header file
     var generatedConstructorDefinitions: [String] // For the header file
     var generatedStaticMethodDefinitions: [String] // For the header file
@@ -285,14 +346,20 @@ struct ManagedCPPWrapperClass {
         self.generatedConstructorImplementations = []
     }
 
-    mutating func generateWrappedConstructorForUnmanagedConstructor(at cursor: CXCursor, internalTypeMappings: [String: TypeMapping]) -> Bool {
+    mutating func generateWrappedConstructorForUnmanagedConstructor(at cursor: CXCursor, internalTypeMappings: [String: TypeMapping],
+                                                                    wrappedNamespaces: Set<String>) -> Bool {
         let cursorType: CXType = clang_getCursorType(cursor)
         let cursorKind: CXCursorKind = clang_getCursorKind(cursor)
         assert(cursorType.kind == CXType_FunctionProto, "Passed wrong cursor type")
         assert(cursorKind == CXCursor_Constructor, "Passed wrong cursor kind")
 
+        // Unmanaged wrappers declare their copy and move constructors explicitly. We copy via our own wrapping
+        // constructor instead.
+        guard clang_CXXConstructor_isCopyConstructor(cursor) == 0,
+              clang_CXXConstructor_isMoveConstructor(cursor) == 0 else { return false }
+
         // We need to reject "wrapping" constructors and only take custom ones, since we generate our own wrapping
-        // constructor. These constructors take a std::shared_ptr<SwiftType>.
+        // constructor. These constructors take a std::shared_ptr<SwiftType>, or the Swift type itself for value types.
 
         let argumentCount = UInt32(clang_Cursor_getNumArguments(cursor)) // Can return -1 if the wrong cursor type. We checked that above.
         let unmanagedArguments: [MethodArgument] = (0..<argumentCount).map({ argumentIndex in
@@ -303,11 +370,14 @@ struct ManagedCPPWrapperClass {
         })
 
         guard !unmanagedArguments.contains(where: { $0.typeName.contains("std::shared_ptr") }) else { return false }
+        guard !unmanagedArguments.contains(where: { type($0.typeName, isIn: wrappedNamespaces) }) else { return false }
 
         // We have everything we need to wrap the constructor now!
 
         func wrapping(for unmanagedTypeName: String) -> TypeMapping {
-            if let stdMapping = UnmanagedToManagedTypeMappings.managedMapping(from: unmanagedTypeName) { return stdMapping }
+            if let stdMapping = UnmanagedToManagedTypeMappings.managedMapping(from: unmanagedTypeName, internalTypeMappings: internalTypeMappings) {
+                return stdMapping
+            }
             if let internalMapping = internalTypeMappings[unmanagedTypeName] { return internalMapping }
             return .direct(for: unmanagedTypeName)
         }
@@ -354,7 +424,8 @@ struct ManagedCPPWrapperClass {
         return true
     }
 
-    mutating func generateWrappedMethodForUnmanagedMethod(at cursor: CXCursor, internalTypeMappings: [String: TypeMapping]) {
+    mutating func generateWrappedMethodForUnmanagedMethod(at cursor: CXCursor, internalTypeMappings: [String: TypeMapping],
+                                                          wrappedNamespaces: Set<String>) -> Bool {
         let cursorType: CXType = clang_getCursorType(cursor)
         let cursorKind: CXCursorKind = clang_getCursorKind(cursor)
         assert(cursorType.kind == CXType_FunctionProto, "Passed wrong cursor type")
@@ -369,6 +440,14 @@ struct ManagedCPPWrapperClass {
 
         // And the method name.
         let unmanagedMethodName = clang_getCursorSpelling(cursor).consumeToString
+        let excludedMethods: [String] = ["operator="]
+        guard !excludedMethods.contains(unmanagedMethodName) else { return false }
+
+        // Spans can't cross into the CLR, so byte buffers get array-based accessors instead. See generateClassDefinition().
+        if unmanagedMethodName == "span" && unmanagedReturnArgument.typeName.hasSuffix("ByteSpan") {
+            isByteBuffer = true
+            return true
+        }
         let methodIsEqualityOperator: Bool = (unmanagedMethodName == "operator==") // I'm sure there's a better way than this.
         let methodIsStatic: Bool = (clang_CXXMethod_isStatic(cursor) > 0)
 
@@ -381,10 +460,16 @@ struct ManagedCPPWrapperClass {
             return MethodArgument(extractingOptionalOfType: "std::optional", arrayOfType: "std::vector", from: argumentType, argumentName: argumentName, isVoidType: false)
         })
 
+        // Accessors for the wrapped Swift values of unmanaged value type wrappers aren't part of the API.
+        guard !type(unmanagedReturnArgument.typeName, isIn: wrappedNamespaces),
+              !unmanagedArguments.contains(where: { type($0.typeName, isIn: wrappedNamespaces) }) else { return false }
+
         // We have everything we need to wrap the method now!
 
         func wrapping(for unmanagedTypeName: String) -> TypeMapping {
-            if let stdMapping = UnmanagedToManagedTypeMappings.managedMapping(from: unmanagedTypeName) { return stdMapping }
+            if let stdMapping = UnmanagedToManagedTypeMappings.managedMapping(from: unmanagedTypeName, internalTypeMappings: internalTypeMappings) {
+                return stdMapping
+            }
             if let internalMapping = internalTypeMappings[unmanagedTypeName] { return internalMapping }
             return .direct(for: unmanagedTypeName)
         }
@@ -436,7 +521,7 @@ struct ManagedCPPWrapperClass {
             methodLines.append("}")
 
             generatedMethodImplementations.append(methodLines)
-            return
+            return true
         }
 
         // Implementation
@@ -453,7 +538,7 @@ struct ManagedCPPWrapperClass {
             lines.append("std::vector<" + mapping.wrappedTypeName + "> \(destName);")
             lines.append(destName + ".reserve(" + sourceName + "->Count);")
             lines.append("for each(auto element in " + sourceName + ") {")
-            lines.append("    " + destName + ".push_back(" + mapping.convertWrapperToWrapped("element", false) + ");")
+            lines.append("    " + destName + ".emplace_back(" + mapping.convertWrapperToWrapped("element", false) + ");")
             lines.append("}")
             return lines
         }
@@ -473,7 +558,7 @@ struct ManagedCPPWrapperClass {
                     lines.append("} else {")
                     lines.append(contentsOf: adaptArray(fromListNamed: argument.argumentName, toStdVectorNamed: arrayName + "Unwrapped",
                                                 using: mapping).map({ "    " + $0 }))
-                    lines.append("    " + arrayName + " = std::optional<std::vector<" + mapping.wrappedTypeName + ">>(" + arrayName + "Unwrapped);")
+                    lines.append("    " + arrayName + " = std::optional<std::vector<" + mapping.wrappedTypeName + ">>(std::move(" + arrayName + "Unwrapped));")
                     lines.append("}")
                     methodLines.append(contentsOf: lines.map({ "    " + $0 }))
                 } else {
@@ -537,8 +622,9 @@ struct ManagedCPPWrapperClass {
             func adaptArray(fromStdVectorNamed sourceName: String, toListNamed destName: String, using mapping: TypeMapping) -> [String] {
                 var lines: [String] = []
                 lines.append("List<" + mapping.wrapperTypeName + ">^ " + destName + " = gcnew List<" + mapping.wrapperTypeName + ">();")
-                lines.append("for (auto element : " + sourceName + ") {")
-                lines.append("    auto managedElement = " + mapping.convertWrappedToWrapper("element", false) + ";")
+                // The source vector is ours to consume, so elements can be moved into their managed wrappers.
+                lines.append("for (auto &element : " + sourceName + ") {")
+                lines.append("    auto managedElement = " + mapping.convertWrappedToWrapper("std::move(element)", false) + ";")
                 lines.append("    " + destName + "->Add(managedElement);")
                 lines.append("}")
                 return lines
@@ -548,7 +634,7 @@ struct ManagedCPPWrapperClass {
             if unmanagedReturnArgument.isOptionalType {
                 if unmanagedReturnArgument.isArrayType {
                     methodLines.append("    if (unmanagedResult.has_value()) {")
-                    methodLines.append("        std::vector<" + returnTypeMapping.wrappedTypeName + "> unwrappedResult = unmanagedResult.value();")
+                    methodLines.append("        std::vector<" + returnTypeMapping.wrappedTypeName + "> unwrappedResult = std::move(unmanagedResult.value());")
                     let conversion = adaptArray(fromStdVectorNamed: "unwrappedResult", toListNamed: "managedResult", using: returnTypeMapping)
                     methodLines.append(contentsOf: conversion.map({ "        " + $0 }))
                     methodLines.append("        return managedResult;")
@@ -558,7 +644,7 @@ struct ManagedCPPWrapperClass {
 
                 } else {
                     let returnLine = "return (unmanagedResult.has_value() ? " +
-                        returnTypeMapping.convertWrappedToWrapper("unmanagedResult.value()", false) + " : nullptr);"
+                        returnTypeMapping.convertWrappedToWrapper("std::move(unmanagedResult.value())", false) + " : nullptr);"
                     methodLines.append("    " + returnLine)
                 }
             } else if unmanagedReturnArgument.isArrayType {
@@ -566,13 +652,68 @@ struct ManagedCPPWrapperClass {
                     using: returnTypeMapping).map{( "    " + $0 )})
                 methodLines.append("    return managedResult;")
             } else {
-                let returnLine = "return " + returnTypeMapping.convertWrappedToWrapper("unmanagedResult", false) + ";"
+                let returnLine = "return " + returnTypeMapping.convertWrappedToWrapper("std::move(unmanagedResult)", false) + ";"
                 methodLines.append("    " + returnLine)
             }
         }
 
         methodLines.append("}")
         generatedMethodImplementations.append(methodLines)
+
+        if !methodIsStatic, unmanagedReturnArgument.isVoidType {
+            generateTaskMethodForCompletionMethod(named: unmanagedMethodName, arguments: unmanagedArguments,
+                                                  managedArguments: managedMethodArguments)
+        }
+        return true
+    }
+
+    /// If the given method takes a completion called with at most one value, adds a version of it that returns a
+    /// `Task` instead, so C# callers can `await` the operation.
+    private mutating func generateTaskMethodForCompletionMethod(named methodName: String, arguments: [MethodArgument],
+                                                                managedArguments: [String]) {
+        guard let completionIndex = arguments.firstIndex(where: { $0.argumentName == "completion" }),
+              let parameterTypeNames = UnmanagedToManagedTypeMappings.callbackParameterTypeNames(from: arguments[completionIndex].typeName),
+              parameterTypeNames.count <= 1 else { return }
+
+        let resultTypeName: String? = UnmanagedToManagedTypeMappings.callbackParameterMappings(from: parameterTypeNames).first?.wrapperTypeName
+        let tasks: String = "System::Threading::Tasks::"
+        let taskTypeName: String = tasks + "Task" + (resultTypeName.map({ "<" + $0 + ">" }) ?? "") + "^"
+        let sourceTypeName: String = tasks + "TaskCompletionSource" + (resultTypeName.map({ "<" + $0 + ">" }) ?? "")
+        let delegateTypeName: String = "System::Action" + (resultTypeName.map({ "<" + $0 + ">" }) ?? "")
+
+        let taskMethodName: String = (methodName.hasSuffix("WithCompletion") ? String(methodName.dropLast("WithCompletion".count)) : methodName) + "Async"
+        let taskMethodArguments: [String] = managedArguments.enumerated().filter({ $0.offset != completionIndex }).map({ $0.element })
+        let callArguments: [String] = arguments.enumerated().map({ index, argument in
+            return index == completionIndex ? "gcnew " + delegateTypeName + "(source, &" + sourceTypeName + "::SetResult)" : argument.argumentName
+        })
+
+        generatedMethodDefinitions.append(taskTypeName + " " + taskMethodName + "(" + taskMethodArguments.joined(separator: ", ") + ");")
+
+        var methodLines: [String] = []
+        methodLines.append(taskTypeName + " " + managedNamespace + "::" + managedClassName + "::" + taskMethodName + "(" +
+                           taskMethodArguments.joined(separator: ", ") + ") {")
+        // Completions are called on Swift's threads, so continuations shouldn't run inline with them.
+        methodLines.append("    " + sourceTypeName + "^ source = gcnew " + sourceTypeName + "(" + tasks +
+                           "TaskCreationOptions::RunContinuationsAsynchronously);")
+        methodLines.append("    " + methodName + "(" + callArguments.joined(separator: ", ") + ");")
+        methodLines.append("    return source->Task;")
+        methodLines.append("}")
+        generatedMethodImplementations.append(methodLines)
+    }
+
+    private func type(_ typeName: String, isIn namespaces: Set<String>) -> Bool {
+        // The wrapped namespace is usually a suffix of the input namespace (CascableCore vs UnmanagedCascableCore),
+        // so make sure we're matching the whole name.
+        return namespaces.contains(where: { namespace in
+            var searchRange = typeName.startIndex..<typeName.endIndex
+            while let range = typeName.range(of: namespace + "::", range: searchRange) {
+                guard range.lowerBound > typeName.startIndex else { return true }
+                let precedingCharacter = typeName[typeName.index(before: range.lowerBound)]
+                if !precedingCharacter.isLetter && !precedingCharacter.isNumber && precedingCharacter != "_" { return true }
+                searchRange = range.upperBound..<typeName.endIndex
+            }
+            return false
+        })
     }
 
     func generateClassDefinition() -> [String] {
@@ -599,6 +740,14 @@ struct ManagedCPPWrapperClass {
         if !generatedStaticMethodDefinitions.isEmpty { lines.append("") }
         lines.append(contentsOf: generatedMethodDefinitions.map({ "    " + $0 }))
 
+        if isByteBuffer {
+            if !generatedMethodDefinitions.isEmpty { lines.append("") }
+            lines.append("    // Copies the buffer's contents into a new array.")
+            lines.append("    array<System::Byte>^ ToArray();")
+            lines.append("    // Copies the buffer's contents into the given array, which must be at least as long as the buffer.")
+            lines.append("    void CopyTo(array<System::Byte>^ destination);")
+        }
+
         lines.append("};")
         return lines
     }
@@ -636,6 +785,31 @@ struct ManagedCPPWrapperClass {
             lines.append(contentsOf: implementation)
             lines.append("")
         }
+
+        if isByteBuffer {
+            // The destination is pinned for the duration of the copy so the garbage collector can't move it.
+            let spanAccess: String = (useSharedPtrs ? unmanagedObjectName + "->get()->span()" : unmanagedObjectName + "->span()")
+            lines.append("array<System::Byte>^ " + scopedManagedTypeName + "::ToArray() {")
+            lines.append("    auto span = " + spanAccess + ";")
+            lines.append("    array<System::Byte>^ managedArray = gcnew array<System::Byte>((int)span.size);")
+            lines.append("    if (!span.empty()) {")
+            lines.append("        pin_ptr<System::Byte> pinnedArray = &managedArray[0];")
+            lines.append("        std::memcpy(pinnedArray, span.data, span.size);")
+            lines.append("    }")
+            lines.append("    return managedArray;")
+            lines.append("}")
+            lines.append("")
+            lines.append("void " + scopedManagedTypeName + "::CopyTo(array<System::Byte>^ destination) {")
+            lines.append("    auto span = " + spanAccess + ";")
+            lines.append("    if (destination == nullptr) { throw gcnew System::ArgumentNullException(\"destination\"); }")
+            lines.append("    if ((size_t)destination->Length < span.size) { throw gcnew System::ArgumentException(\"The destination is too small.\", \"destination\"); }")
+            lines.append("    if (!span.empty()) {")
+            lines.append("        pin_ptr<System::Byte> pinnedArray = &destination[0];")
+            lines.append("        std::memcpy(pinnedArray, span.data, span.size);")
+            lines.append("    }")
+            lines.append("}")
+            lines.append("")
+        }
         return lines
     }
 }
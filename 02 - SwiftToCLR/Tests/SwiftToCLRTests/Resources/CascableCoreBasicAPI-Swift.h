@@ -5138,6 +5138,9 @@ static SWIFT_C_INLINE_THUNK struct swift_interop_passStub_CascableCoreBasicAPI_u
 }
 
 SWIFT_EXTERN void $s20CascableCoreBasicAPI0C6CameraC17lastLiveViewFrameAA0cghI0CSgvs(struct swift_interop_passStub_CascableCoreBasicAPI_uint64_t_0_8 value, SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // _
+SWIFT_EXTERN void $s20CascableCoreBasicAPI0C6CameraC24setLiveViewFrameCallback7context8callback14releaseContextySvSg_ySvSg_SvtXCySvSgXCtF(void * _Nullable context, void (* _Nonnull callback)(void * _Nullable, void * _Nonnull), void (* _Nonnull releaseContext)(void * _Nullable), SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // setLiveViewFrameCallback(context:callback:releaseContext:)
+SWIFT_EXTERN void $s20CascableCoreBasicAPI0C6CameraC26clearLiveViewFrameCallbackyyF(SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // clearLiveViewFrameCallback()
+SWIFT_EXTERN void $s20CascableCoreBasicAPI0C6CameraC21connectWithCompletion7context10completion14releaseContextySvSg_ySvSg_SbtXCySvSgXCtF(void * _Nullable context, void (* _Nonnull completion)(void * _Nullable, bool), void (* _Nonnull releaseContext)(void * _Nullable), SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // connectWithCompletion(context:completion:releaseContext:)
 // Stub struct to be used to pass/return values to/from Swift functions.
 struct swift_interop_returnStub_CascableCoreBasicAPI_void_ptr_0_8 {
   void * _Nullable _1;
@@ -5216,6 +5219,8 @@ SWIFT_EXTERN struct swift_interop_returnStub_CascableCoreBasicAPI_uint64_t_0_8_u
 SWIFT_EXTERN double $s20CascableCoreBasicAPI0C13LiveViewFrameC12dateProducedSdvg(SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // _
 SWIFT_EXTERN ptrdiff_t $s20CascableCoreBasicAPI0C13LiveViewFrameC18rawPixelDataLengthSivg(SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // _
 SWIFT_EXTERN void $s20CascableCoreBasicAPI0C13LiveViewFrameC13copyPixelData4intoySpys5UInt8VG_tF(uint8_t * _Nonnull pointer, SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // copyPixelData(into:)
+SWIFT_EXTERN uint8_t const * _Nullable $s20CascableCoreBasicAPI0C10ByteBufferC5bytesSPys5UInt8VGSgvg(SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // _
+SWIFT_EXTERN ptrdiff_t $s20CascableCoreBasicAPI0C10ByteBufferC5countSivg(SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // _
 SWIFT_EXTERN void * _Nonnull $s20CascableCoreBasicAPI0C13LiveViewFrameC12rawPixelSizeAA0cJ0Cvg(SWIFT_CONTEXT void * _Nonnull _self) SWIFT_NOEXCEPT SWIFT_CALL; // _
 SWIFT_EXTERN struct swift_interop_returnStub_CascableCoreBasicAPI_uint8_t_0_1 $s20CascableCoreBasicAPI0C18PropertyIdentifierO8rawValueACSgSu_tcfC(size_t rawValue) SWIFT_NOEXCEPT SWIFT_CALL; // init(rawValue:)
 SWIFT_EXTERN size_t $s20CascableCoreBasicAPI0C18PropertyIdentifierO8rawValueSuvg(struct swift_interop_passStub_CascableCoreBasicAPI_uint8_t_0_1 _self) SWIFT_NOEXCEPT SWIFT_CALL; // _
@@ -5310,6 +5315,31 @@ public:
   SWIFT_INLINE_THUNK bool getLiveViewStreamActive() SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C6CameraC20liveViewStreamActiveSbvp");
   SWIFT_INLINE_THUNK swift::Optional<BasicLiveViewFrame> getLastLiveViewFrame() SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C6CameraC17lastLiveViewFrameAA0cghI0CSgvp");
   SWIFT_INLINE_THUNK void setLastLiveViewFrame(const swift::Optional<BasicLiveViewFrame>& value) SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C6CameraC17lastLiveViewFrameAA0cghI0CSgvp");
+/// Registers a function to be called each time a new live view frame arrives, replacing any previously-registered
+/// one. The function is called on the camera’s live view queue, immediately after <code>lastLiveViewFrame</code> is updated.
+/// <code>releaseContext</code> is called with <code>context</code> exactly once, when the registration is replaced or cleared or the
+/// camera is deallocated. The callback won’t be called with that context afterwards.
+/// \param context An opaque pointer that’s passed back to <code>callback</code> and <code>releaseContext</code>.
+///
+/// \param callback The function to call for each frame. It’s also given the frame, as a retained
+/// <code>BasicLiveViewFrame</code> that the callback is responsible for releasing. Later frames don’t
+/// affect it, so it can be read after <code>lastLiveViewFrame</code> has moved on.
+///
+/// \param releaseContext The function to call once the registration is no longer needed.
+///
+  SWIFT_INLINE_THUNK void setLiveViewFrameCallback(void * _Nullable context, void (* _Nonnull callback)(void * _Nullable, void * _Nonnull), void (* _Nonnull releaseContext)(void * _Nullable)) SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C6CameraC24setLiveViewFrameCallback7context8callback14releaseContextySvSg_ySvSg_SvtXCySvSgXCtF");
+/// Removes the function registered with <code>setLiveViewFrameCallback(context:callback:releaseContext:)</code>, if any.
+  SWIFT_INLINE_THUNK void clearLiveViewFrameCallback() SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C6CameraC26clearLiveViewFrameCallbackyyF");
+/// Attempt to connect to the device, calling a function once the attempt finishes.
+/// <code>completion</code> is called exactly once on an internal queue, with <code>context</code> and whether the camera connected,
+/// after which <code>releaseContext</code> is called with <code>context</code>.
+/// \param context An opaque pointer that’s passed back to <code>completion</code> and <code>releaseContext</code>.
+///
+/// \param completion The function to call once the attempt finishes.
+///
+/// \param releaseContext The function to call once <code>completion</code> has been called.
+///
+  SWIFT_INLINE_THUNK void connectWithCompletion(void * _Nullable context, void (* _Nonnull completion)(void * _Nullable, bool), void (* _Nonnull releaseContext)(void * _Nullable)) SWIFT_SYMBOL("s20CascableCoreBasicAPI0C6CameraC21connectWithCompletion7context10completion14releaseContextySvSg_ySvSg_SbtXCySvSgXCtF");
   SWIFT_INLINE_THUNK swift::Array<BasicPropertyIdentifier> getKnownPropertyIdentifiers() SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C6CameraC24knownPropertyIdentifiersSayAA0cG10IdentifierOGvp");
 /// Returns a property object for the given identifier. If the property is currently unknown, returns an object
 /// with <code>currentValue</code>, <code>validSettableValues</code>, etc set to <code>nil</code>.
@@ -5600,6 +5630,86 @@ struct implClassFor<CascableCoreBasicAPI::BasicDeviceInfo> { using type = Cascab
 namespace CascableCoreBasicAPI SWIFT_PRIVATE_ATTR SWIFT_SYMBOL_MODULE("CascableCoreBasicAPI") {
 
 
+/// A read-only block of bytes, such as image data.
+///
+/// The buffer's bytes stay at the same address for as long as the buffer exists, so callers on the other side of the
+/// C++ interop can read them in place rather than copying them out first.
+///
+/// Buffers are built once by their owners and handed out as-is, so reading a buffer never copies its bytes.
+class SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C10ByteBufferC") BasicByteBuffer;
+} // end namespace 
+
+namespace swift SWIFT_PRIVATE_ATTR {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<>
+static inline const constexpr bool isUsableInGenericContext<CascableCoreBasicAPI::BasicByteBuffer> = true;
+#pragma clang diagnostic pop
+} // namespace swift
+
+namespace CascableCoreBasicAPI SWIFT_PRIVATE_ATTR SWIFT_SYMBOL_MODULE("CascableCoreBasicAPI") {
+namespace _impl {
+
+class _impl_BasicByteBuffer;
+// Type metadata accessor for BasicByteBuffer
+SWIFT_EXTERN swift::_impl::MetadataResponseTy $s20CascableCoreBasicAPI0C10ByteBufferCMa(swift::_impl::MetadataRequestTy) SWIFT_NOEXCEPT SWIFT_CALL;
+
+
+} // namespace _impl
+
+class SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C10ByteBufferC") BasicByteBuffer : public swift::_impl::RefCountedClass {
+public:
+  using RefCountedClass::RefCountedClass;
+  using RefCountedClass::operator=;
+  /// Returns a pointer to the buffer's bytes, or <code>nil</code> if the buffer is empty. The pointer is valid for as long as
+  /// the buffer exists.
+  SWIFT_INLINE_THUNK uint8_t const * _Nullable getBytes() SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C10ByteBufferC5bytesSPys5UInt8VGSgvp");
+  /// The number of bytes in the buffer.
+  SWIFT_INLINE_THUNK swift::Int getCount() SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C10ByteBufferC5countSivp");
+protected:
+  SWIFT_INLINE_THUNK BasicByteBuffer(void * _Nonnull ptr) noexcept : RefCountedClass(ptr) {}
+private:
+  friend class _impl::_impl_BasicByteBuffer;
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wreserved-identifier"
+  typedef char $s20CascableCoreBasicAPI0C10ByteBufferCD;
+  static inline constexpr $s20CascableCoreBasicAPI0C10ByteBufferCD __swift_mangled_name = 0;
+#pragma clang diagnostic pop
+#pragma clang diagnostic pop
+};
+
+namespace _impl {
+
+class _impl_BasicByteBuffer {
+public:
+static SWIFT_INLINE_THUNK BasicByteBuffer makeRetained(void * _Nonnull ptr) noexcept { return BasicByteBuffer(ptr); }
+};
+
+} // namespace _impl
+
+} // end namespace 
+
+namespace swift SWIFT_PRIVATE_ATTR {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<>
+struct TypeMetadataTrait<CascableCoreBasicAPI::BasicByteBuffer> {
+  static SWIFT_INLINE_PRIVATE_HELPER void * _Nonnull getTypeMetadata() {
+    return CascableCoreBasicAPI::_impl::$s20CascableCoreBasicAPI0C10ByteBufferCMa(0)._0;
+  }
+};
+namespace _impl{
+template<>
+struct implClassFor<CascableCoreBasicAPI::BasicByteBuffer> { using type = CascableCoreBasicAPI::_impl::_impl_BasicByteBuffer; };
+} // namespace
+#pragma clang diagnostic pop
+} // namespace swift
+
+namespace CascableCoreBasicAPI SWIFT_PRIVATE_ATTR SWIFT_SYMBOL_MODULE("CascableCoreBasicAPI") {
+
+
 /// Represents a single frame of a streaming live view image, along with any associated metadata.
 class SWIFT_SYMBOL("s:20CascableCoreBasicAPI0C13LiveViewFrameC") BasicLiveViewFrame;
 } // end namespace 
@@ -6584,6 +6694,45 @@ FTypeAddress *fptrptr_ = reinterpret_cast<FTypeAddress *>(vtable_ + 176 / sizeof
   swift::_impl::ConsumedValueStorageDestroyer<swift::Optional<BasicLiveViewFrame>> storageGuard_consumedParamCopy_value(consumedParamCopy_value);
   return (* fptrptr_->func)(_impl::swift_interop_passDirect_CascableCoreBasicAPI_uint64_t_0_8(swift::_impl::_impl_Optional<BasicLiveViewFrame>::getOpaquePointer(consumedParamCopy_value)), ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
   }
+  SWIFT_INLINE_THUNK void BasicCamera::setLiveViewFrameCallback(void * _Nullable context, void (* _Nonnull callback)(void * _Nullable, void * _Nonnull), void (* _Nonnull releaseContext)(void * _Nullable)) {
+void ***selfPtr_ = reinterpret_cast<void ***>( ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+#ifdef __arm64e__
+void **vtable_ = ptrauth_auth_data(*selfPtr_, ptrauth_key_process_independent_data, ptrauth_blend_discriminator(selfPtr_,27361));
+#else
+void **vtable_ = *selfPtr_;
+#endif
+struct FTypeAddress {
+decltype(_impl::$s20CascableCoreBasicAPI0C6CameraC24setLiveViewFrameCallback7context8callback14releaseContextySvSg_ySvSg_SvtXCySvSgXCtF) * func;
+};
+FTypeAddress *fptrptr_ = reinterpret_cast<FTypeAddress *>(vtable_ + 208 / sizeof(void *));
+  return (* fptrptr_->func)(context, callback, releaseContext, ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+  }
+  SWIFT_INLINE_THUNK void BasicCamera::clearLiveViewFrameCallback() {
+void ***selfPtr_ = reinterpret_cast<void ***>( ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+#ifdef __arm64e__
+void **vtable_ = ptrauth_auth_data(*selfPtr_, ptrauth_key_process_independent_data, ptrauth_blend_discriminator(selfPtr_,27361));
+#else
+void **vtable_ = *selfPtr_;
+#endif
+struct FTypeAddress {
+decltype(_impl::$s20CascableCoreBasicAPI0C6CameraC26clearLiveViewFrameCallbackyyF) * func;
+};
+FTypeAddress *fptrptr_ = reinterpret_cast<FTypeAddress *>(vtable_ + 216 / sizeof(void *));
+  return (* fptrptr_->func)(::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+  }
+  SWIFT_INLINE_THUNK void BasicCamera::connectWithCompletion(void * _Nullable context, void (* _Nonnull completion)(void * _Nullable, bool), void (* _Nonnull releaseContext)(void * _Nullable)) {
+void ***selfPtr_ = reinterpret_cast<void ***>( ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+#ifdef __arm64e__
+void **vtable_ = ptrauth_auth_data(*selfPtr_, ptrauth_key_process_independent_data, ptrauth_blend_discriminator(selfPtr_,27361));
+#else
+void **vtable_ = *selfPtr_;
+#endif
+struct FTypeAddress {
+decltype(_impl::$s20CascableCoreBasicAPI0C6CameraC21connectWithCompletion7context10completion14releaseContextySvSg_ySvSg_SbtXCySvSgXCtF) * func;
+};
+FTypeAddress *fptrptr_ = reinterpret_cast<FTypeAddress *>(vtable_ + 224 / sizeof(void *));
+  return (* fptrptr_->func)(context, completion, releaseContext, ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+  }
   SWIFT_INLINE_THUNK swift::Array<BasicPropertyIdentifier> BasicCamera::getKnownPropertyIdentifiers() {
 void ***selfPtr_ = reinterpret_cast<void ***>( ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
 #ifdef __arm64e__
@@ -6893,6 +7042,32 @@ FTypeAddress *fptrptr_ = reinterpret_cast<FTypeAddress *>(vtable_ + 96 / sizeof(
     _impl::swift_interop_returnDirect_CascableCoreBasicAPI_uint64_t_0_8_uint64_t_8_16(result, (* fptrptr_->func)(::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this)));
   });
   }
+  SWIFT_INLINE_THUNK uint8_t const * _Nullable BasicByteBuffer::getBytes() {
+void ***selfPtr_ = reinterpret_cast<void ***>( ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+#ifdef __arm64e__
+void **vtable_ = ptrauth_auth_data(*selfPtr_, ptrauth_key_process_independent_data, ptrauth_blend_discriminator(selfPtr_,27361));
+#else
+void **vtable_ = *selfPtr_;
+#endif
+struct FTypeAddress {
+decltype(_impl::$s20CascableCoreBasicAPI0C10ByteBufferC5bytesSPys5UInt8VGSgvg) * func;
+};
+FTypeAddress *fptrptr_ = reinterpret_cast<FTypeAddress *>(vtable_ + 72 / sizeof(void *));
+  return (* fptrptr_->func)(::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+  }
+  SWIFT_INLINE_THUNK swift::Int BasicByteBuffer::getCount() {
+void ***selfPtr_ = reinterpret_cast<void ***>( ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+#ifdef __arm64e__
+void **vtable_ = ptrauth_auth_data(*selfPtr_, ptrauth_key_process_independent_data, ptrauth_blend_discriminator(selfPtr_,27361));
+#else
+void **vtable_ = *selfPtr_;
+#endif
+struct FTypeAddress {
+decltype(_impl::$s20CascableCoreBasicAPI0C10ByteBufferC5countSivg) * func;
+};
+FTypeAddress *fptrptr_ = reinterpret_cast<FTypeAddress *>(vtable_ + 80 / sizeof(void *));
+  return (* fptrptr_->func)(::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
+  }
   SWIFT_INLINE_THUNK double BasicLiveViewFrame::getDateProduced() {
 void ***selfPtr_ = reinterpret_cast<void ***>( ::swift::_impl::_impl_RefCountedClass::getOpaquePointer(*this));
 #ifdef __arm64e__
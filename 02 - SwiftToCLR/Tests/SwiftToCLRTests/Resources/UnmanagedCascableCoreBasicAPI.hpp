@@ -2,12 +2,16 @@
 
 #ifndef UnmanagedCascableCoreBasicAPI_hpp
 #define UnmanagedCascableCoreBasicAPI_hpp
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <optional>
 #include <vector>
 
 namespace CascableCoreBasicAPI {
+    class BasicByteBuffer;
     class BasicPropertyIdentifier;
     class BasicCamera;
     class BasicCameraDiscovery;
@@ -21,6 +25,7 @@ namespace CascableCoreBasicAPI {
 
 namespace UnmanagedCascableCoreBasicAPI {
 
+    class BasicByteBuffer;
     class BasicPropertyIdentifier;
     class BasicCamera;
     class BasicCameraDiscovery;
@@ -31,6 +36,29 @@ namespace UnmanagedCascableCoreBasicAPI {
     class BasicSimulatedCameraConfiguration;
     class BasicSize;
 
+    struct ByteSpan {
+        const uint8_t *data;
+        size_t size;
+
+        const uint8_t *begin() const { return data; }
+        const uint8_t *end() const { return data + size; }
+        bool empty() const { return size == 0; }
+    };
+
+    class BasicByteBuffer {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicByteBuffer> swiftObj;
+        BasicByteBuffer(std::shared_ptr<CascableCoreBasicAPI::BasicByteBuffer> swiftObj);
+        ~BasicByteBuffer();
+
+        // The span is valid for as long as this object, or any copy of it, exists.
+        UnmanagedCascableCoreBasicAPI::ByteSpan span() const;
+
+        const uint8_t * getBytes();
+        int getCount();
+    };
+
     class BasicPropertyIdentifier {
     private:
     public:
@@ -123,6 +151,9 @@ namespace UnmanagedCascableCoreBasicAPI {
         void disconnect();
         void beginLiveViewStream();
         void endLiveViewStream();
+        void setLiveViewFrameCallback(std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> callback);
+        void clearLiveViewFrameCallback();
+        void connectWithCompletion(std::function<void(bool)> completion);
         bool getLiveViewStreamActive();
         std::optional<UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame> getLastLiveViewFrame();
         void setLastLiveViewFrame(const std::optional<UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame>& value);
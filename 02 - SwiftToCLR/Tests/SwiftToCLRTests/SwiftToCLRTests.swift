@@ -20,6 +20,60 @@ class CodeGenerationTests: XCTestCase {
             print("-----", file.name, "-----")
             print(String(decoding: file.contents, as: UTF8.self))
         }
+
+        // Swift classes should be wrapped via shared pointers, and Swift enums and structs held inline.
+        let header = String(decoding: try XCTUnwrap(resultFiles.first(where: { $0.kind == .header })).contents, as: UTF8.self)
+        let implementation = String(decoding: try XCTUnwrap(resultFiles.first(where: { $0.kind == .implementation })).contents, as: UTF8.self)
+        XCTAssert(header.contains("std::shared_ptr<CascableCoreBasicAPI::BasicCamera> swiftObj;"))
+        XCTAssert(header.contains("const CascableCoreBasicAPI::BasicPropertyIdentifier &swiftObj() const;"))
+        XCTAssertFalse(implementation.contains("std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>"))
+
+        // Bridged arrays shouldn't copy their elements on the way through.
+        XCTAssertFalse(implementation.contains("for (auto element"))
+        XCTAssertFalse(implementation.contains("push_back("))
+
+        // Byte buffers should get a span that reads the Swift buffer's bytes in place.
+        XCTAssert(header.contains("struct ByteSpan {"))
+        XCTAssert(header.contains("UnmanagedCascableCoreBasicAPI::ByteSpan span() const;"))
+        XCTAssert(implementation.contains("UnmanagedCascableCoreBasicAPI::ByteSpan UnmanagedCascableCoreBasicAPI::BasicByteBuffer::span() const {"))
+        XCTAssert(implementation.contains("{ swiftObj->getBytes(), (size_t)swiftObj->getCount() }"))
+
+        // Callbacks should be registered through capture-less trampolines that call and release a boxed std::function.
+        // The frames they're given are retained handles, which should be adopted rather than retained again.
+        let callbackType = "std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)>"
+        XCTAssert(header.contains("void setLiveViewFrameCallback(" + callbackType + " callback);"))
+        XCTAssert(header.contains("void clearLiveViewFrameCallback();"))
+        XCTAssert(implementation.contains(callbackType + " *arg0 = new " + callbackType + "(std::move(callback));"))
+        XCTAssert(implementation.contains("void (*arg1)(void *, void *) = [](void *context, void * value0) {"))
+        XCTAssert(implementation.contains("UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame object0 = UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame(" +
+                                          "std::make_shared<CascableCoreBasicAPI::BasicLiveViewFrame>(" +
+                                          "CascableCoreBasicAPI::_impl::_impl_BasicLiveViewFrame::makeRetained(value0)));"))
+        XCTAssert(implementation.contains("if (function) { function(std::move(object0)); }"))
+        XCTAssert(implementation.contains("void (*arg2)(void *) = [](void *context) {"))
+        XCTAssert(implementation.contains("delete static_cast<" + callbackType + " *>(context);"))
+        XCTAssert(implementation.contains("swiftObj->setLiveViewFrameCallback(arg0, arg1, arg2);"))
+
+        // Completion methods should get awaitable versions, which need C++20 and so should be behind a feature check.
+        let awaitableType = "UnmanagedCascableCoreBasicAPI::CompletionAwaitable<bool>"
+        XCTAssert(header.contains("void connectWithCompletion(std::function<void(bool)> completion);"))
+        XCTAssert(implementation.contains("void (*arg1)(void *, bool) = [](void *context, bool value0) {"))
+        XCTAssert(implementation.contains("swiftObj->connectWithCompletion(arg0, arg1, arg2);"))
+        let awaitableBlock = try XCTUnwrap(header.range(of: "#if UnmanagedCascableCoreBasicAPI_HAS_COROUTINES\n" +
+                                                        "        // Awaitable versions of the methods taking a completion."))
+        let awaitableBlockEnd = try XCTUnwrap(header.range(of: "#endif", range: awaitableBlock.upperBound..<header.endIndex))
+        let awaitableMethods = header[awaitableBlock.upperBound..<awaitableBlockEnd.lowerBound]
+        XCTAssert(awaitableMethods.contains(awaitableType + " connectAsync() {"))
+        XCTAssert(awaitableMethods.contains("return " + awaitableType + "([self = *this](std::function<void(bool)> completion) mutable {"))
+        XCTAssert(awaitableMethods.contains("self.connectWithCompletion(std::move(completion));"))
+
+        // Awaiting coroutines are resumed inline unless the caller gives the awaitable an executor. They're never
+        // given a thread of their own.
+        XCTAssert(header.contains("using CompletionExecutor = std::function<void(std::coroutine_handle<>)>;"))
+        XCTAssert(header.contains("class CompletionAwaitable {"))
+        XCTAssert(header.contains("CompletionAwaitable resumingOn(CompletionExecutor executor) && {"))
+        XCTAssert(header.contains("if (executor) { executor(handle); } else { handle.resume(); }"))
+        XCTAssertFalse(header.contains("std::thread"))
+        XCTAssertFalse(header.contains("#include <thread>"))
     }
 
     func testUnmanagedToManaged() throws {
@@ -40,6 +94,128 @@ class CodeGenerationTests: XCTestCase {
             print("-----", file.name, "-----")
             print(String(decoding: file.contents, as: UTF8.self))
         }
+
+        // Unmanaged results are ours to consume, so they should be moved into their managed wrappers.
+        let implementation = String(decoding: try XCTUnwrap(resultFiles.first(where: { $0.kind == .implementation })).contents, as: UTF8.self)
+        XCTAssertFalse(implementation.contains("for (auto element :"))
+        XCTAssert(implementation.contains("(std::move(unmanagedResult))"))
+
+        // Spans can't cross into the CLR, so byte buffers should be copied out through a pinned array instead.
+        let header = String(decoding: try XCTUnwrap(resultFiles.first(where: { $0.kind == .header })).contents, as: UTF8.self)
+        XCTAssert(header.contains("array<System::Byte>^ ToArray();"))
+        XCTAssert(header.contains("void CopyTo(array<System::Byte>^ destination);"))
+        XCTAssertFalse(header.contains("ByteSpan"))
+        XCTAssert(implementation.contains("auto span = wrappedObj->span();"))
+        XCTAssert(implementation.contains("pin_ptr<System::Byte> pinnedArray = &managedArray[0];"))
+
+        // Wrapper objects given to callbacks should be handed to the delegate as managed wrappers.
+        XCTAssert(header.contains("void setLiveViewFrameCallback(System::Action<ManagedCascableCoreBasicAPI::BasicLiveViewFrame^>^ callback);"))
+        XCTAssert(implementation.contains("callbackHandler->Invoke(gcnew ManagedCascableCoreBasicAPI::BasicLiveViewFrame(" +
+                                          "new UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame(std::move(value0))))"))
+
+        // Completion methods should get Task-returning versions, whose continuations don't run on Swift's queues.
+        let sourceType = "System::Threading::Tasks::TaskCompletionSource<bool>"
+        XCTAssert(header.contains("void connectWithCompletion(System::Action<bool>^ completion);"))
+        XCTAssert(header.contains("System::Threading::Tasks::Task<bool>^ connectAsync();"))
+        XCTAssert(implementation.contains("System::Threading::Tasks::Task<bool>^ ManagedCascableCoreBasicAPI::BasicCamera::connectAsync() {"))
+        XCTAssert(implementation.contains(sourceType + "^ source = gcnew " + sourceType +
+                                          "(System::Threading::Tasks::TaskCreationOptions::RunContinuationsAsynchronously);"))
+        XCTAssert(implementation.contains("connectWithCompletion(gcnew System::Action<bool>(source, &" + sourceType + "::SetResult));"))
+        XCTAssert(implementation.contains("return source->Task;"))
+    }
+
+    func testCallbackMapping() throws {
+        // Callbacks taken by unmanaged methods should become delegates, kept alive by the std::function they're bridged to.
+        let mapping = try XCTUnwrap(UnmanagedToManagedTypeMappings.callbackMapping(from: "std::function<void (int, bool)>"))
+        XCTAssertEqual(mapping.wrapperTypeName, "System::Action<int, bool>^")
+        let conversion = mapping.convertWrapperToWrapped("callback", false)
+        XCTAssert(conversion.contains("gcroot<System::Action<int, bool>^>(callback)"))
+        XCTAssert(conversion.contains("(int value0, bool value1)"))
+        XCTAssert(conversion.contains("->Invoke(value0, value1)"))
+
+        XCTAssertEqual(UnmanagedToManagedTypeMappings.callbackMapping(from: "std::function<void ()>")?.wrapperTypeName, "System::Action^")
+        XCTAssertNil(UnmanagedToManagedTypeMappings.callbackMapping(from: "std::function<int (int)>"))
+        XCTAssertNil(UnmanagedToManagedTypeMappings.callbackMapping(from: "std::string"))
+
+        // Callbacks given Swift object handles can only be wrapped if the handles can be adopted.
+        func argument(_ typeName: String, _ name: String, callbackParameterTypeNames: [String]? = nil) -> MethodArgument {
+            var argument = MethodArgument(typeName: typeName, argumentName: name, isOptionalType: false, isArrayType: false, isVoidType: false)
+            argument.callbackParameterTypeNames = callbackParameterTypeNames
+            return argument
+        }
+        let arguments = [argument("void *", "context"),
+                         argument("void (*)(void *, void *)", "callback", callbackParameterTypeNames: ["void *"]),
+                         argument("void (*)(void *)", "releaseContext", callbackParameterTypeNames: [])]
+        XCTAssertNil(CallbackRegistration(arguments: arguments))
+        let handleMapping = try XCTUnwrap(UnmanagedManagedCPPWrapperClass.callbackHandleMapping(
+            forRegistrationMethodNamed: "setFrameCallback",
+            in: ["BasicFrame": .direct(for: "Module::BasicFrame"), "const BasicFrame &": .direct(for: "const Module::BasicFrame &")]))
+        XCTAssertEqual(handleMapping.convertWrappedToWrapper("value0", false), "Module::_impl::_impl_BasicFrame::makeRetained(value0)")
+        XCTAssertNil(UnmanagedManagedCPPWrapperClass.callbackHandleMapping(forRegistrationMethodNamed: "setFrameCallback", in: [:]))
+        let registration = try XCTUnwrap(CallbackRegistration(arguments: arguments, handleMapping: handleMapping))
+        XCTAssertEqual(registration.handleParameterIndexes, [0])
+        let adaptation = registration.generateArgumentAdaptation(from: "callback", parameterName: "arg").joined(separator: "\n")
+        XCTAssert(adaptation.contains("Module::BasicFrame object0 = Module::_impl::_impl_BasicFrame::makeRetained(value0);"))
+        XCTAssert(adaptation.contains("if (function) { function(std::move(object0)); }"))
+    }
+
+    func testSHA256() throws {
+        // Test vectors from FIPS 180-4's examples, plus one spanning several blocks.
+        func digest(_ string: String) -> String {
+            var hasher = SHA256()
+            hasher.update(with: string)
+            return hasher.finalize()
+        }
+        XCTAssertEqual(digest(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855")
+        XCTAssertEqual(digest("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad")
+        XCTAssertEqual(digest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+                       "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1")
+        XCTAssertEqual(digest(String(repeating: "a", count: 1000)),
+                       "41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3")
+
+        // Splitting the message between updates shouldn't change its digest.
+        var hasher = SHA256()
+        hasher.update(with: "abcdbcdecdefdefgefghfghighijhijk")
+        hasher.update(with: "ijkljklmklmnlmnomnopnopq")
+        XCTAssertEqual(hasher.finalize(), "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1")
+    }
+
+    func testGenerationCacheAndUnchangedOutput() throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directory) }
+        let cache = try GenerationCache(directory: directory.appendingPathComponent("Cache"))
+        let inputHeader = directory.appendingPathComponent("Input.h")
+        try Data("class A {};".utf8).write(to: inputHeader)
+        let sdkDirectory = directory.appendingPathComponent("SDK")
+        let interopDirectory = directory.appendingPathComponent("Interop")
+        try FileManager.default.createDirectory(at: sdkDirectory, withIntermediateDirectories: true, attributes: nil)
+        try FileManager.default.createDirectory(at: interopDirectory, withIntermediateDirectories: true, attributes: nil)
+        try Data("#define A 1".utf8).write(to: interopDirectory.appendingPathComponent("Interop.h"))
+
+        func key(parameters: [String] = ["option"]) throws -> GenerationCache.Key {
+            return try GenerationCache.Key(name: "Output", inputHeaderPath: inputHeader.path, platformRoot: sdkDirectory.path,
+                                           includeDirectories: [interopDirectory.path], parameters: parameters)
+        }
+
+        // Output should come from the cache until the input, the headers it includes or the options change.
+        let files = [GeneratedFile(kind: .header, name: "Output.hpp", contents: Data("// A".utf8))]
+        XCTAssertNil(cache.cachedFiles(for: try key()))
+        try cache.store(files, for: try key())
+        XCTAssertEqual(cache.cachedFiles(for: try key())?.first?.contents, files[0].contents)
+        XCTAssertNil(cache.cachedFiles(for: try key(parameters: ["other"])))
+        try Data("#define A 22".utf8).write(to: interopDirectory.appendingPathComponent("Interop.h"))
+        XCTAssertNil(cache.cachedFiles(for: try key()))
+        try cache.store(files, for: try key())
+        try Data("#define SDK 1".utf8).write(to: sdkDirectory.appendingPathComponent("SDK.h"))
+        XCTAssertNil(cache.cachedFiles(for: try key()))
+        try cache.store(files, for: try key())
+        try Data("class B {};".utf8).write(to: inputHeader)
+        XCTAssertNil(cache.cachedFiles(for: try key()))
+
+        // Writing identical output shouldn't touch the existing file.
+        XCTAssertTrue(try files[0].write(toDirectory: directory))
+        XCTAssertFalse(try files[0].write(toDirectory: directory))
+        XCTAssertTrue(try GeneratedFile(kind: .header, name: "Output.hpp", contents: Data("// B".utf8)).write(toDirectory: directory))
     }
 }
 
@@ -15,6 +15,7 @@ using System.Runtime.InteropServices.WindowsRuntime;
 using Windows.Foundation;
 using Windows.Foundation.Collections;
 using System.Diagnostics;
+using System.Threading.Tasks;
 using Windows.UI.Popups;
 
 namespace CascableCoreDemo.Views
@@ -66,6 +67,9 @@ namespace CascableCoreDemo.Views
             config.setManufacturer("Canon");
             config.setModel("EOS R5");
             config.apply();
+
+            // Throw away any events left over from a previous search before starting a new one.
+            while (discovery.dequeueEvent() != null) { }
             discovery.startDiscovery("CascableCore Demo");
 
             viewModel.ButtonTitle = "Stop Searching";
@@ -74,10 +78,16 @@ namespace CascableCoreDemo.Views
             BasicCamera camera = null;
             try
             {
-                camera = await PollingAwaiter<BasicCameraDiscovery, BasicCamera>.AwaitForNonNil(discovery, TimeSpan.FromSeconds(1.0), TimeSpan.FromSeconds(4.0), delegate (BasicCameraDiscovery d)
+                // Wait for discovery events off the UI thread, rather than polling the list of visible cameras.
+                camera = await Task.Run(() =>
                 {
-                    ICollection<BasicCamera> cameras = d.getVisibleCameras();
-                    return (cameras.Count == 0 ? null : cameras.First());
+                    DateTime deadline = DateTime.Now + TimeSpan.FromSeconds(4.0);
+                    while (DateTime.Now < deadline)
+                    {
+                        BasicCameraDiscoveryEvent discoveryEvent = discovery.waitForEvent((deadline - DateTime.Now).TotalSeconds);
+                        if (discoveryEvent != null && discoveryEvent.getType().isAppeared()) { return discoveryEvent.getCamera(); }
+                    }
+                    throw new TimeoutException();
                 });
             }
             catch
@@ -15,7 +15,9 @@ using System.IO;
 using System.Linq;
 using System.Runtime.InteropServices;
 using System.Runtime.InteropServices.WindowsRuntime;
+using System.Threading;
 using System.Threading.Channels;
+using System.Threading.Tasks;
 using Windows.Foundation;
 using Windows.Foundation.Collections;
 using Microsoft.UI.Dispatching;
@@ -81,6 +83,7 @@ namespace CascableCoreDemo.Views
         private async void disconnectButton_Click(object sender, RoutedEventArgs e)
         {
             viewModel.DisconnectButtonEnabled = false;
+            stopCameraInitiatedTransfers();
             camera.disconnect();
 
             try
@@ -103,22 +106,31 @@ namespace CascableCoreDemo.Views
 
         #region Camera-Initiated Transfers
 
-        PollingObserver<BasicCamera, BasicCameraInitiatedTransferResult, double> cameraPreviewObserver;
+        CancellationTokenSource transferCancellation;
 
         private void setupCameraInitiatedTransfers()
         {
             camera.setHandleCameraInitiatedPreviews(true);
-            cameraPreviewObserver = new PollingObserver<BasicCamera, BasicCameraInitiatedTransferResult, double>(camera, TimeSpan.FromSeconds(0.5),
-                delegate (BasicCamera c) { return c.getLastReceivedPreview(); },
-                delegate (BasicCameraInitiatedTransferResult r) { return r?.getDateProduced(); });
-            cameraPreviewObserver.ValueChanged += CameraPreviewObserver_ValueChanged;
-            cameraPreviewObserver.Start();
+            transferCancellation = new CancellationTokenSource();
+            CancellationToken token = transferCancellation.Token;
+
+            // The camera queues every transfer it receives, so we drain the queue on a background thread rather than
+            // polling for the latest one. Waiting blocks, so this mustn't happen on the main thread.
+            Task.Run(() =>
+            {
+                while (!token.IsCancellationRequested)
+                {
+                    BasicCameraInitiatedTransferResult result = camera.waitForTransfer(0.5);
+                    if (result == null) { continue; }
+                    mainQueue.TryEnqueue(() => { handleCameraInitiatedPreview(result); });
+                }
+            }, token);
         }
 
-        private void CameraPreviewObserver_ValueChanged(object sender, BasicCameraInitiatedTransferResult e)
+        private void stopCameraInitiatedTransfers()
         {
-            if (e == null) { return; }
-            mainQueue.TryEnqueue(() => { handleCameraInitiatedPreview(e); });
+            transferCancellation?.Cancel();
+            camera.setHandleCameraInitiatedPreviews(false);
         }
 
         private void handleCameraInitiatedPreview(BasicCameraInitiatedTransferResult preview)
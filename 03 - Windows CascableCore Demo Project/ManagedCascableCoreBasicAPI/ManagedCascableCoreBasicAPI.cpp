@@ -2,6 +2,9 @@
 
 #include "ManagedCascableCoreBasicAPI.hpp"
 #include <msclr/marshal_cppstd.h>
+#include <vcclr.h>
+#include <cstring>
+#include <utility>
 
 using namespace msclr::interop;
 using namespace System::Collections::Generic;
@@ -19,162 +22,162 @@ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::~BasicPropertyIdentifier()
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::initWithRawValue(unsigned int rawValue) {
     unsigned int arg0 = rawValue;
     std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier> unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::initWithRawValue(arg0);
-    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult.value())) : nullptr);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult.value()))) : nullptr);
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isoSpeed() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isoSpeed();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::shutterSpeed() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::shutterSpeed();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::aperture() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::aperture();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::exposureCompensation() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::exposureCompensation();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::batteryLevel() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::batteryLevel();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::powerSource() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::powerSource();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::afSystem() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::afSystem();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::focusMode() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::focusMode();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::driveMode() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::driveMode();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::autoExposureMode() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::autoExposureMode();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::inCameraBracketingEnabled() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::inCameraBracketingEnabled();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupEnabled() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupEnabled();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupStage() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupStage();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::dofPreviewEnabled() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::dofPreviewEnabled();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::shotsAvailable() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::shotsAvailable();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::lensStatus() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::lensStatus();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::colorTone() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::colorTone();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::artFilter() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::artFilter();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::digitalZoom() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::digitalZoom();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::whiteBalance() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::whiteBalance();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::noiseReduction() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::noiseReduction();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::imageQuality() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::imageQuality();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterStatus() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterStatus();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterReading() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterReading();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::exposureMeteringMode() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::exposureMeteringMode();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::readyForCapture() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::readyForCapture();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::imageDestination() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::imageDestination();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::videoRecordingFormat() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::videoRecordingFormat();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::liveViewZoomLevel() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::liveViewZoomLevel();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::maxValue() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::maxValue();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::unknown() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::unknown();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::operator==(ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ lhs, ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ rhs) {
@@ -185,162 +188,450 @@ bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::operator==(ManagedCas
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isIsoSpeed() {
     bool unmanagedResult = wrappedObj->isIsoSpeed();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isShutterSpeed() {
     bool unmanagedResult = wrappedObj->isShutterSpeed();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isAperture() {
     bool unmanagedResult = wrappedObj->isAperture();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isExposureCompensation() {
     bool unmanagedResult = wrappedObj->isExposureCompensation();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isBatteryLevel() {
     bool unmanagedResult = wrappedObj->isBatteryLevel();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isPowerSource() {
     bool unmanagedResult = wrappedObj->isPowerSource();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isAfSystem() {
     bool unmanagedResult = wrappedObj->isAfSystem();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isFocusMode() {
     bool unmanagedResult = wrappedObj->isFocusMode();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isDriveMode() {
     bool unmanagedResult = wrappedObj->isDriveMode();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isAutoExposureMode() {
     bool unmanagedResult = wrappedObj->isAutoExposureMode();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isInCameraBracketingEnabled() {
     bool unmanagedResult = wrappedObj->isInCameraBracketingEnabled();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isMirrorLockupEnabled() {
     bool unmanagedResult = wrappedObj->isMirrorLockupEnabled();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isMirrorLockupStage() {
     bool unmanagedResult = wrappedObj->isMirrorLockupStage();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isDofPreviewEnabled() {
     bool unmanagedResult = wrappedObj->isDofPreviewEnabled();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isShotsAvailable() {
     bool unmanagedResult = wrappedObj->isShotsAvailable();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLensStatus() {
     bool unmanagedResult = wrappedObj->isLensStatus();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isColorTone() {
     bool unmanagedResult = wrappedObj->isColorTone();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isArtFilter() {
     bool unmanagedResult = wrappedObj->isArtFilter();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isDigitalZoom() {
     bool unmanagedResult = wrappedObj->isDigitalZoom();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isWhiteBalance() {
     bool unmanagedResult = wrappedObj->isWhiteBalance();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isNoiseReduction() {
     bool unmanagedResult = wrappedObj->isNoiseReduction();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isImageQuality() {
     bool unmanagedResult = wrappedObj->isImageQuality();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLightMeterStatus() {
     bool unmanagedResult = wrappedObj->isLightMeterStatus();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLightMeterReading() {
     bool unmanagedResult = wrappedObj->isLightMeterReading();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isExposureMeteringMode() {
     bool unmanagedResult = wrappedObj->isExposureMeteringMode();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isReadyForCapture() {
     bool unmanagedResult = wrappedObj->isReadyForCapture();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isImageDestination() {
     bool unmanagedResult = wrappedObj->isImageDestination();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isVideoRecordingFormat() {
     bool unmanagedResult = wrappedObj->isVideoRecordingFormat();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLiveViewZoomLevel() {
     bool unmanagedResult = wrappedObj->isLiveViewZoomLevel();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isMaxValue() {
     bool unmanagedResult = wrappedObj->isMaxValue();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::isUnknown() {
     bool unmanagedResult = wrappedObj->isUnknown();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 unsigned int ManagedCascableCoreBasicAPI::BasicPropertyIdentifier::getRawValue() {
     unsigned int unmanagedResult = wrappedObj->getRawValue();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicFileTransferState
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState::BasicFileTransferState(UnmanagedCascableCoreBasicAPI::BasicFileTransferState *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState::~BasicFileTransferState() {
+    delete wrappedObj;
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState^ ManagedCascableCoreBasicAPI::BasicFileTransferState::initWithRawValue(unsigned int rawValue) {
+    unsigned int arg0 = rawValue;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicFileTransferState> unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFileTransferState::initWithRawValue(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicFileTransferState(new UnmanagedCascableCoreBasicAPI::BasicFileTransferState(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState^ ManagedCascableCoreBasicAPI::BasicFileTransferState::inProgress() {
+    UnmanagedCascableCoreBasicAPI::BasicFileTransferState unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFileTransferState::inProgress();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFileTransferState(new UnmanagedCascableCoreBasicAPI::BasicFileTransferState(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState^ ManagedCascableCoreBasicAPI::BasicFileTransferState::completed() {
+    UnmanagedCascableCoreBasicAPI::BasicFileTransferState unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFileTransferState::completed();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFileTransferState(new UnmanagedCascableCoreBasicAPI::BasicFileTransferState(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState^ ManagedCascableCoreBasicAPI::BasicFileTransferState::failed() {
+    UnmanagedCascableCoreBasicAPI::BasicFileTransferState unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFileTransferState::failed();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFileTransferState(new UnmanagedCascableCoreBasicAPI::BasicFileTransferState(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState^ ManagedCascableCoreBasicAPI::BasicFileTransferState::cancelled() {
+    UnmanagedCascableCoreBasicAPI::BasicFileTransferState unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFileTransferState::cancelled();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFileTransferState(new UnmanagedCascableCoreBasicAPI::BasicFileTransferState(std::move(unmanagedResult)));
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFileTransferState::operator==(ManagedCascableCoreBasicAPI::BasicFileTransferState^ lhs, ManagedCascableCoreBasicAPI::BasicFileTransferState^ rhs) {
+    if (Object::ReferenceEquals(lhs, nullptr) && Object::ReferenceEquals(rhs, nullptr)) { return true; }
+    if (Object::ReferenceEquals(lhs, nullptr) || Object::ReferenceEquals(rhs, nullptr)) { return false; }
+    return (*lhs->wrappedObj == *rhs->wrappedObj);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFileTransferState::isInProgress() {
+    bool unmanagedResult = wrappedObj->isInProgress();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFileTransferState::isCompleted() {
+    bool unmanagedResult = wrappedObj->isCompleted();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFileTransferState::isFailed() {
+    bool unmanagedResult = wrappedObj->isFailed();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFileTransferState::isCancelled() {
+    bool unmanagedResult = wrappedObj->isCancelled();
+    return std::move(unmanagedResult);
+}
+
+unsigned int ManagedCascableCoreBasicAPI::BasicFileTransferState::getRawValue() {
+    unsigned int unmanagedResult = wrappedObj->getRawValue();
+    return std::move(unmanagedResult);
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicFolderListingFlags
+
+ManagedCascableCoreBasicAPI::BasicFolderListingFlags::BasicFolderListingFlags(UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicFolderListingFlags::~BasicFolderListingFlags() {
+    delete wrappedObj;
+}
+
+ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ ManagedCascableCoreBasicAPI::BasicFolderListingFlags::initWithRawValue(unsigned int rawValue) {
+    unsigned int arg0 = rawValue;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags> unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::initWithRawValue(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicFolderListingFlags(new UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ ManagedCascableCoreBasicAPI::BasicFolderListingFlags::folder() {
+    UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::folder();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFolderListingFlags(new UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ ManagedCascableCoreBasicAPI::BasicFolderListingFlags::image() {
+    UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::image();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFolderListingFlags(new UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ ManagedCascableCoreBasicAPI::BasicFolderListingFlags::video() {
+    UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::video();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFolderListingFlags(new UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(std::move(unmanagedResult)));
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFolderListingFlags::operator==(ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ lhs, ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ rhs) {
+    if (Object::ReferenceEquals(lhs, nullptr) && Object::ReferenceEquals(rhs, nullptr)) { return true; }
+    if (Object::ReferenceEquals(lhs, nullptr) || Object::ReferenceEquals(rhs, nullptr)) { return false; }
+    return (*lhs->wrappedObj == *rhs->wrappedObj);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFolderListingFlags::isFolder() {
+    bool unmanagedResult = wrappedObj->isFolder();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFolderListingFlags::isImage() {
+    bool unmanagedResult = wrappedObj->isImage();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFolderListingFlags::isVideo() {
+    bool unmanagedResult = wrappedObj->isVideo();
+    return std::move(unmanagedResult);
+}
+
+unsigned int ManagedCascableCoreBasicAPI::BasicFolderListingFlags::getRawValue() {
+    unsigned int unmanagedResult = wrappedObj->getRawValue();
+    return std::move(unmanagedResult);
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::BasicCameraDiscoveryEventType(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::~BasicCameraDiscoveryEventType() {
+    delete wrappedObj;
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::initWithRawValue(unsigned int rawValue) {
+    unsigned int arg0 = rawValue;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType> unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::initWithRawValue(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::appeared() {
+    UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::appeared();
+    return gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::lost() {
+    UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::lost();
+    return gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::metadataResolved() {
+    UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::metadataResolved();
+    return gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(std::move(unmanagedResult)));
+}
+
+bool ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::operator==(ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ lhs, ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ rhs) {
+    if (Object::ReferenceEquals(lhs, nullptr) && Object::ReferenceEquals(rhs, nullptr)) { return true; }
+    if (Object::ReferenceEquals(lhs, nullptr) || Object::ReferenceEquals(rhs, nullptr)) { return false; }
+    return (*lhs->wrappedObj == *rhs->wrappedObj);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::isAppeared() {
+    bool unmanagedResult = wrappedObj->isAppeared();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::isLost() {
+    bool unmanagedResult = wrappedObj->isLost();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::isMetadataResolved() {
+    bool unmanagedResult = wrappedObj->isMetadataResolved();
+    return std::move(unmanagedResult);
+}
+
+unsigned int ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::getRawValue() {
+    unsigned int unmanagedResult = wrappedObj->getRawValue();
+    return std::move(unmanagedResult);
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicPropertySetStatus
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus::BasicPropertySetStatus(UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus::~BasicPropertySetStatus() {
+    delete wrappedObj;
+}
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ ManagedCascableCoreBasicAPI::BasicPropertySetStatus::initWithRawValue(unsigned int rawValue) {
+    unsigned int arg0 = rawValue;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus> unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::initWithRawValue(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicPropertySetStatus(new UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ ManagedCascableCoreBasicAPI::BasicPropertySetStatus::idle() {
+    UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::idle();
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertySetStatus(new UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ ManagedCascableCoreBasicAPI::BasicPropertySetStatus::inProgress() {
+    UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::inProgress();
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertySetStatus(new UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ ManagedCascableCoreBasicAPI::BasicPropertySetStatus::succeeded() {
+    UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::succeeded();
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertySetStatus(new UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ ManagedCascableCoreBasicAPI::BasicPropertySetStatus::failed() {
+    UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::failed();
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertySetStatus(new UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(std::move(unmanagedResult)));
+}
+
+bool ManagedCascableCoreBasicAPI::BasicPropertySetStatus::operator==(ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ lhs, ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ rhs) {
+    if (Object::ReferenceEquals(lhs, nullptr) && Object::ReferenceEquals(rhs, nullptr)) { return true; }
+    if (Object::ReferenceEquals(lhs, nullptr) || Object::ReferenceEquals(rhs, nullptr)) { return false; }
+    return (*lhs->wrappedObj == *rhs->wrappedObj);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicPropertySetStatus::isIdle() {
+    bool unmanagedResult = wrappedObj->isIdle();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicPropertySetStatus::isInProgress() {
+    bool unmanagedResult = wrappedObj->isInProgress();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicPropertySetStatus::isSucceeded() {
+    bool unmanagedResult = wrappedObj->isSucceeded();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicPropertySetStatus::isFailed() {
+    bool unmanagedResult = wrappedObj->isFailed();
+    return std::move(unmanagedResult);
+}
+
+unsigned int ManagedCascableCoreBasicAPI::BasicPropertySetStatus::getRawValue() {
+    unsigned int unmanagedResult = wrappedObj->getRawValue();
+    return std::move(unmanagedResult);
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicByteBuffer
+
+ManagedCascableCoreBasicAPI::BasicByteBuffer::BasicByteBuffer(UnmanagedCascableCoreBasicAPI::BasicByteBuffer *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicByteBuffer::~BasicByteBuffer() {
+    delete wrappedObj;
+}
+
+const uint8_t * ManagedCascableCoreBasicAPI::BasicByteBuffer::getBytes() {
+    const uint8_t * unmanagedResult = wrappedObj->getBytes();
+    return std::move(unmanagedResult);
+}
+
+int ManagedCascableCoreBasicAPI::BasicByteBuffer::getCount() {
+    int unmanagedResult = wrappedObj->getCount();
+    return std::move(unmanagedResult);
+}
+
+array<System::Byte>^ ManagedCascableCoreBasicAPI::BasicByteBuffer::ToArray() {
+    auto span = wrappedObj->span();
+    array<System::Byte>^ managedArray = gcnew array<System::Byte>((int)span.size);
+    if (!span.empty()) {
+        pin_ptr<System::Byte> pinnedArray = &managedArray[0];
+        std::memcpy(pinnedArray, span.data, span.size);
+    }
+    return managedArray;
+}
+
+void ManagedCascableCoreBasicAPI::BasicByteBuffer::CopyTo(array<System::Byte>^ destination) {
+    auto span = wrappedObj->span();
+    if (destination == nullptr) { throw gcnew System::ArgumentNullException("destination"); }
+    if ((size_t)destination->Length < span.size) { throw gcnew System::ArgumentException("The destination is too small.", "destination"); }
+    if (!span.empty()) {
+        pin_ptr<System::Byte> pinnedArray = &destination[0];
+        std::memcpy(pinnedArray, span.data, span.size);
+    }
 }
 
 // Implementation of ManagedCascableCoreBasicAPI::BasicCamera
@@ -353,37 +644,80 @@ ManagedCascableCoreBasicAPI::BasicCamera::~BasicCamera() {
     delete wrappedObj;
 }
 
+int ManagedCascableCoreBasicAPI::BasicCamera::getHandle() {
+    int unmanagedResult = wrappedObj->getHandle();
+    return std::move(unmanagedResult);
+}
+
 System::String^ ManagedCascableCoreBasicAPI::BasicCamera::getFriendlyIdentifier() {
     std::optional<std::string> unmanagedResult = wrappedObj->getFriendlyIdentifier();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicCamera::getConnected() {
     bool unmanagedResult = wrappedObj->getConnected();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 ManagedCascableCoreBasicAPI::BasicDeviceInfo^ ManagedCascableCoreBasicAPI::BasicCamera::getDeviceInfo() {
     std::optional<UnmanagedCascableCoreBasicAPI::BasicDeviceInfo> unmanagedResult = wrappedObj->getDeviceInfo();
-    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicDeviceInfo(new UnmanagedCascableCoreBasicAPI::BasicDeviceInfo(unmanagedResult.value())) : nullptr);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicDeviceInfo(new UnmanagedCascableCoreBasicAPI::BasicDeviceInfo(std::move(unmanagedResult.value()))) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicCamera::getFriendlyDisplayName() {
     std::optional<std::string> unmanagedResult = wrappedObj->getFriendlyDisplayName();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCamera::connect() {
     wrappedObj->connect();
 }
 
+void ManagedCascableCoreBasicAPI::BasicCamera::connectWithCompletion(System::Action<bool>^ completion) {
+    std::function<void (bool)> arg0 = (completion == nullptr ? std::function<void (bool)>() : std::function<void (bool)>([completionHandler = gcroot<System::Action<bool>^>(completion)](bool value0) { completionHandler->Invoke(value0); }));
+    wrappedObj->connectWithCompletion(arg0);
+}
+
+System::Threading::Tasks::Task<bool>^ ManagedCascableCoreBasicAPI::BasicCamera::connectAsync() {
+    System::Threading::Tasks::TaskCompletionSource<bool>^ source = gcnew System::Threading::Tasks::TaskCompletionSource<bool>(System::Threading::Tasks::TaskCreationOptions::RunContinuationsAsynchronously);
+    connectWithCompletion(gcnew System::Action<bool>(source, &System::Threading::Tasks::TaskCompletionSource<bool>::SetResult));
+    return source->Task;
+}
+
 void ManagedCascableCoreBasicAPI::BasicCamera::disconnect() {
     wrappedObj->disconnect();
 }
 
+void ManagedCascableCoreBasicAPI::BasicCamera::disconnectWithCompletion(System::Action<bool>^ completion) {
+    std::function<void (bool)> arg0 = (completion == nullptr ? std::function<void (bool)>() : std::function<void (bool)>([completionHandler = gcroot<System::Action<bool>^>(completion)](bool value0) { completionHandler->Invoke(value0); }));
+    wrappedObj->disconnectWithCompletion(arg0);
+}
+
+System::Threading::Tasks::Task<bool>^ ManagedCascableCoreBasicAPI::BasicCamera::disconnectAsync() {
+    System::Threading::Tasks::TaskCompletionSource<bool>^ source = gcnew System::Threading::Tasks::TaskCompletionSource<bool>(System::Threading::Tasks::TaskCreationOptions::RunContinuationsAsynchronously);
+    disconnectWithCompletion(gcnew System::Action<bool>(source, &System::Threading::Tasks::TaskCompletionSource<bool>::SetResult));
+    return source->Task;
+}
+
+List<ManagedCascableCoreBasicAPI::BasicFileStorage^>^ ManagedCascableCoreBasicAPI::BasicCamera::getStorageDevices() {
+    std::vector<UnmanagedCascableCoreBasicAPI::BasicFileStorage> unmanagedResult = wrappedObj->getStorageDevices();
+    List<ManagedCascableCoreBasicAPI::BasicFileStorage^>^ managedResult = gcnew List<ManagedCascableCoreBasicAPI::BasicFileStorage^>();
+    for (auto &element : unmanagedResult) {
+        auto managedElement = gcnew ManagedCascableCoreBasicAPI::BasicFileStorage(new UnmanagedCascableCoreBasicAPI::BasicFileStorage(std::move(element)));
+        managedResult->Add(managedElement);
+    }
+    return managedResult;
+}
+
+ManagedCascableCoreBasicAPI::BasicFileSystemItem^ ManagedCascableCoreBasicAPI::BasicCamera::fileSystemItem(System::String^ path) {
+    const std::string & arg0 = marshal_as<std::string>(path);
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem> unmanagedResult = wrappedObj->fileSystemItem(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicFileSystemItem(new UnmanagedCascableCoreBasicAPI::BasicFileSystemItem(std::move(unmanagedResult.value()))) : nullptr);
+}
+
 bool ManagedCascableCoreBasicAPI::BasicCamera::getAutoFocusEngaged() {
     bool unmanagedResult = wrappedObj->getAutoFocusEngaged();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCamera::engageAutoFocus() {
@@ -396,7 +730,7 @@ void ManagedCascableCoreBasicAPI::BasicCamera::disengageAutoFocus() {
 
 bool ManagedCascableCoreBasicAPI::BasicCamera::getShutterEngaged() {
     bool unmanagedResult = wrappedObj->getShutterEngaged();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCamera::engageShutter() {
@@ -412,19 +746,60 @@ void ManagedCascableCoreBasicAPI::BasicCamera::invokeOneShotShutterExplicitlyEng
     wrappedObj->invokeOneShotShutterExplicitlyEngagingAutoFocus(arg0);
 }
 
-ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ ManagedCascableCoreBasicAPI::BasicCamera::getLastReceivedPreview() {
-    std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> unmanagedResult = wrappedObj->getLastReceivedPreview();
-    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(new UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(unmanagedResult.value())) : nullptr);
+int ManagedCascableCoreBasicAPI::BasicCamera::getReceivedTransferCapacity() {
+    int unmanagedResult = wrappedObj->getReceivedTransferCapacity();
+    return std::move(unmanagedResult);
 }
 
-void ManagedCascableCoreBasicAPI::BasicCamera::setLastReceivedPreview(ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ value) {
-    std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> arg0 = (value == nullptr ? std::nullopt : std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult>(*value->wrappedObj));
-    wrappedObj->setLastReceivedPreview(arg0);
+void ManagedCascableCoreBasicAPI::BasicCamera::setReceivedTransferCapacity(int newValue) {
+    int arg0 = newValue;
+    wrappedObj->setReceivedTransferCapacity(arg0);
+}
+
+int ManagedCascableCoreBasicAPI::BasicCamera::getPendingTransferCount() {
+    int unmanagedResult = wrappedObj->getPendingTransferCount();
+    return std::move(unmanagedResult);
+}
+
+int ManagedCascableCoreBasicAPI::BasicCamera::getReceivedTransferCount() {
+    int unmanagedResult = wrappedObj->getReceivedTransferCount();
+    return std::move(unmanagedResult);
+}
+
+int ManagedCascableCoreBasicAPI::BasicCamera::getDroppedTransferCount() {
+    int unmanagedResult = wrappedObj->getDroppedTransferCount();
+    return std::move(unmanagedResult);
+}
+
+int ManagedCascableCoreBasicAPI::BasicCamera::getFailedTransferCount() {
+    int unmanagedResult = wrappedObj->getFailedTransferCount();
+    return std::move(unmanagedResult);
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ ManagedCascableCoreBasicAPI::BasicCamera::dequeueTransfer() {
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> unmanagedResult = wrappedObj->dequeueTransfer();
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(new UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ ManagedCascableCoreBasicAPI::BasicCamera::waitForTransfer(double timeout) {
+    double arg0 = timeout;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> unmanagedResult = wrappedObj->waitForTransfer(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(new UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicCamera::getCameraInitiatedTransferDirectory() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getCameraInitiatedTransferDirectory();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+void ManagedCascableCoreBasicAPI::BasicCamera::setCameraInitiatedTransferDirectory(System::String^ newValue) {
+    std::optional<std::string> arg0 = (newValue == nullptr ? std::nullopt : std::optional<std::string>(marshal_as<std::string>(newValue)));
+    wrappedObj->setCameraInitiatedTransferDirectory(arg0);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicCamera::getHandleCameraInitiatedPreviews() {
     bool unmanagedResult = wrappedObj->getHandleCameraInitiatedPreviews();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCamera::setHandleCameraInitiatedPreviews(bool newValue) {
@@ -442,12 +817,12 @@ void ManagedCascableCoreBasicAPI::BasicCamera::endLiveViewStream() {
 
 bool ManagedCascableCoreBasicAPI::BasicCamera::getLiveViewStreamActive() {
     bool unmanagedResult = wrappedObj->getLiveViewStreamActive();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 ManagedCascableCoreBasicAPI::BasicLiveViewFrame^ ManagedCascableCoreBasicAPI::BasicCamera::getLastLiveViewFrame() {
     std::optional<UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame> unmanagedResult = wrappedObj->getLastLiveViewFrame();
-    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicLiveViewFrame(new UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame(unmanagedResult.value())) : nullptr);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicLiveViewFrame(new UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame(std::move(unmanagedResult.value()))) : nullptr);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCamera::setLastLiveViewFrame(ManagedCascableCoreBasicAPI::BasicLiveViewFrame^ value) {
@@ -455,11 +830,20 @@ void ManagedCascableCoreBasicAPI::BasicCamera::setLastLiveViewFrame(ManagedCasca
     wrappedObj->setLastLiveViewFrame(arg0);
 }
 
+void ManagedCascableCoreBasicAPI::BasicCamera::setLiveViewFrameCallback(System::Action<ManagedCascableCoreBasicAPI::BasicLiveViewFrame^>^ callback) {
+    std::function<void (UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> arg0 = (callback == nullptr ? std::function<void (UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)>() : std::function<void (UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)>([callbackHandler = gcroot<System::Action<ManagedCascableCoreBasicAPI::BasicLiveViewFrame^>^>(callback)](UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame value0) { callbackHandler->Invoke(gcnew ManagedCascableCoreBasicAPI::BasicLiveViewFrame(new UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame(std::move(value0)))); }));
+    wrappedObj->setLiveViewFrameCallback(arg0);
+}
+
+void ManagedCascableCoreBasicAPI::BasicCamera::clearLiveViewFrameCallback() {
+    wrappedObj->clearLiveViewFrameCallback();
+}
+
 List<ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^>^ ManagedCascableCoreBasicAPI::BasicCamera::getKnownPropertyIdentifiers() {
     std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier> unmanagedResult = wrappedObj->getKnownPropertyIdentifiers();
     List<ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^>^ managedResult = gcnew List<ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^>();
-    for (auto element : unmanagedResult) {
-        auto managedElement = gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(element));
+    for (auto &element : unmanagedResult) {
+        auto managedElement = gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(element)));
         managedResult->Add(managedElement);
     }
     return managedResult;
@@ -468,7 +852,7 @@ List<ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^>^ ManagedCascableCore
 ManagedCascableCoreBasicAPI::BasicCameraProperty^ ManagedCascableCoreBasicAPI::BasicCamera::property(ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ identifier) {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier arg0 = *identifier->wrappedObj;
     UnmanagedCascableCoreBasicAPI::BasicCameraProperty unmanagedResult = wrappedObj->property(arg0);
-    return gcnew ManagedCascableCoreBasicAPI::BasicCameraProperty(new UnmanagedCascableCoreBasicAPI::BasicCameraProperty(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicCameraProperty(new UnmanagedCascableCoreBasicAPI::BasicCameraProperty(std::move(unmanagedResult)));
 }
 
 // Implementation of ManagedCascableCoreBasicAPI::BasicCameraDiscovery
@@ -483,12 +867,12 @@ ManagedCascableCoreBasicAPI::BasicCameraDiscovery::~BasicCameraDiscovery() {
 
 ManagedCascableCoreBasicAPI::BasicCameraDiscovery^ ManagedCascableCoreBasicAPI::BasicCameraDiscovery::sharedInstance() {
     UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::sharedInstance();
-    return gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscovery(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscovery(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery(std::move(unmanagedResult)));
 }
 
 bool ManagedCascableCoreBasicAPI::BasicCameraDiscovery::getDiscoveryRunning() {
     bool unmanagedResult = wrappedObj->getDiscoveryRunning();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCameraDiscovery::setDiscoveryRunning(bool value) {
@@ -499,13 +883,40 @@ void ManagedCascableCoreBasicAPI::BasicCameraDiscovery::setDiscoveryRunning(bool
 List<ManagedCascableCoreBasicAPI::BasicCamera^>^ ManagedCascableCoreBasicAPI::BasicCameraDiscovery::getVisibleCameras() {
     std::vector<UnmanagedCascableCoreBasicAPI::BasicCamera> unmanagedResult = wrappedObj->getVisibleCameras();
     List<ManagedCascableCoreBasicAPI::BasicCamera^>^ managedResult = gcnew List<ManagedCascableCoreBasicAPI::BasicCamera^>();
-    for (auto element : unmanagedResult) {
-        auto managedElement = gcnew ManagedCascableCoreBasicAPI::BasicCamera(new UnmanagedCascableCoreBasicAPI::BasicCamera(element));
+    for (auto &element : unmanagedResult) {
+        auto managedElement = gcnew ManagedCascableCoreBasicAPI::BasicCamera(new UnmanagedCascableCoreBasicAPI::BasicCamera(std::move(element)));
         managedResult->Add(managedElement);
     }
     return managedResult;
 }
 
+ManagedCascableCoreBasicAPI::BasicCamera^ ManagedCascableCoreBasicAPI::BasicCameraDiscovery::camera(int handle) {
+    int arg0 = handle;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicCamera> unmanagedResult = wrappedObj->camera(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCamera(new UnmanagedCascableCoreBasicAPI::BasicCamera(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+int ManagedCascableCoreBasicAPI::BasicCameraDiscovery::getPendingEventCount() {
+    int unmanagedResult = wrappedObj->getPendingEventCount();
+    return std::move(unmanagedResult);
+}
+
+int ManagedCascableCoreBasicAPI::BasicCameraDiscovery::getDroppedEventCount() {
+    int unmanagedResult = wrappedObj->getDroppedEventCount();
+    return std::move(unmanagedResult);
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent^ ManagedCascableCoreBasicAPI::BasicCameraDiscovery::dequeueEvent() {
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent> unmanagedResult = wrappedObj->dequeueEvent();
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent^ ManagedCascableCoreBasicAPI::BasicCameraDiscovery::waitForEvent(double timeout) {
+    double arg0 = timeout;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent> unmanagedResult = wrappedObj->waitForEvent(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent(std::move(unmanagedResult.value()))) : nullptr);
+}
+
 void ManagedCascableCoreBasicAPI::BasicCameraDiscovery::startDiscovery(System::String^ clientName) {
     const std::string & arg0 = marshal_as<std::string>(clientName);
     wrappedObj->startDiscovery(arg0);
@@ -515,6 +926,31 @@ void ManagedCascableCoreBasicAPI::BasicCameraDiscovery::stopDiscovery() {
     wrappedObj->stopDiscovery();
 }
 
+// Implementation of ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::BasicCameraDiscoveryEvent(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::~BasicCameraDiscoveryEvent() {
+    delete wrappedObj;
+}
+
+ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::getType() {
+    UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType unmanagedResult = wrappedObj->getType();
+    return gcnew ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(new UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(std::move(unmanagedResult)));
+}
+
+ManagedCascableCoreBasicAPI::BasicCamera^ ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::getCamera() {
+    UnmanagedCascableCoreBasicAPI::BasicCamera unmanagedResult = wrappedObj->getCamera();
+    return gcnew ManagedCascableCoreBasicAPI::BasicCamera(new UnmanagedCascableCoreBasicAPI::BasicCamera(std::move(unmanagedResult)));
+}
+
+int ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::getCameraHandle() {
+    int unmanagedResult = wrappedObj->getCameraHandle();
+    return std::move(unmanagedResult);
+}
+
 // Implementation of ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult
 
 ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::BasicCameraInitiatedTransferResult(UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult *objectToTakeOwnershipOf) {
@@ -525,34 +961,49 @@ ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::~BasicCameraIni
     delete wrappedObj;
 }
 
+int ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getSequenceNumber() {
+    int unmanagedResult = wrappedObj->getSequenceNumber();
+    return std::move(unmanagedResult);
+}
+
 double ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getDateProduced() {
     double unmanagedResult = wrappedObj->getDateProduced();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 bool ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::isOnlyDestinationForImage() {
     bool unmanagedResult = wrappedObj->isOnlyDestinationForImage();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getFileNameHint() {
     std::optional<std::string> unmanagedResult = wrappedObj->getFileNameHint();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getSuggestedFileNameExtensionForRepresentation() {
     std::optional<std::string> unmanagedResult = wrappedObj->getSuggestedFileNameExtensionForRepresentation();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getUtiForRepresentation() {
     std::optional<std::string> unmanagedResult = wrappedObj->getUtiForRepresentation();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getLocalPath() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getLocalPath();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 int ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getRawImageDataLength() {
     int unmanagedResult = wrappedObj->getRawImageDataLength();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
+}
+
+ManagedCascableCoreBasicAPI::BasicByteBuffer^ ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getImageBuffer() {
+    UnmanagedCascableCoreBasicAPI::BasicByteBuffer unmanagedResult = wrappedObj->getImageBuffer();
+    return gcnew ManagedCascableCoreBasicAPI::BasicByteBuffer(new UnmanagedCascableCoreBasicAPI::BasicByteBuffer(std::move(unmanagedResult)));
 }
 
 void ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::copyPixelData(uint8_t * pointer) {
@@ -572,22 +1023,22 @@ ManagedCascableCoreBasicAPI::BasicCameraProperty::~BasicCameraProperty() {
 
 ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getIdentifier() {
     UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier unmanagedResult = wrappedObj->getIdentifier();
-    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertyIdentifier(new UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::move(unmanagedResult)));
 }
 
 ManagedCascableCoreBasicAPI::BasicCamera^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getCamera() {
     std::optional<UnmanagedCascableCoreBasicAPI::BasicCamera> unmanagedResult = wrappedObj->getCamera();
-    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCamera(new UnmanagedCascableCoreBasicAPI::BasicCamera(unmanagedResult.value())) : nullptr);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicCamera(new UnmanagedCascableCoreBasicAPI::BasicCamera(std::move(unmanagedResult.value()))) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getLocalizedDisplayName() {
     std::optional<std::string> unmanagedResult = wrappedObj->getLocalizedDisplayName();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 ManagedCascableCoreBasicAPI::BasicPropertyValue^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getCurrentValue() {
     std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> unmanagedResult = wrappedObj->getCurrentValue();
-    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicPropertyValue(new UnmanagedCascableCoreBasicAPI::BasicPropertyValue(unmanagedResult.value())) : nullptr);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicPropertyValue(new UnmanagedCascableCoreBasicAPI::BasicPropertyValue(std::move(unmanagedResult.value()))) : nullptr);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCameraProperty::setCurrentValue(ManagedCascableCoreBasicAPI::BasicPropertyValue^ value) {
@@ -597,7 +1048,7 @@ void ManagedCascableCoreBasicAPI::BasicCameraProperty::setCurrentValue(ManagedCa
 
 ManagedCascableCoreBasicAPI::BasicPropertyValue^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getPendingValue() {
     std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> unmanagedResult = wrappedObj->getPendingValue();
-    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicPropertyValue(new UnmanagedCascableCoreBasicAPI::BasicPropertyValue(unmanagedResult.value())) : nullptr);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicPropertyValue(new UnmanagedCascableCoreBasicAPI::BasicPropertyValue(std::move(unmanagedResult.value()))) : nullptr);
 }
 
 void ManagedCascableCoreBasicAPI::BasicCameraProperty::setPendingValue(ManagedCascableCoreBasicAPI::BasicPropertyValue^ value) {
@@ -608,8 +1059,8 @@ void ManagedCascableCoreBasicAPI::BasicCameraProperty::setPendingValue(ManagedCa
 List<ManagedCascableCoreBasicAPI::BasicPropertyValue^>^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getValidSettableValues() {
     std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> unmanagedResult = wrappedObj->getValidSettableValues();
     List<ManagedCascableCoreBasicAPI::BasicPropertyValue^>^ managedResult = gcnew List<ManagedCascableCoreBasicAPI::BasicPropertyValue^>();
-    for (auto element : unmanagedResult) {
-        auto managedElement = gcnew ManagedCascableCoreBasicAPI::BasicPropertyValue(new UnmanagedCascableCoreBasicAPI::BasicPropertyValue(element));
+    for (auto &element : unmanagedResult) {
+        auto managedElement = gcnew ManagedCascableCoreBasicAPI::BasicPropertyValue(new UnmanagedCascableCoreBasicAPI::BasicPropertyValue(std::move(element)));
         managedResult->Add(managedElement);
     }
     return managedResult;
@@ -619,7 +1070,7 @@ void ManagedCascableCoreBasicAPI::BasicCameraProperty::setValidSettableValues(Li
     std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> arg0Array;
     arg0Array.reserve(value->Count);
     for each(auto element in value) {
-        arg0Array.push_back(*element->wrappedObj);
+        arg0Array.emplace_back(*element->wrappedObj);
     }
     wrappedObj->setValidSettableValues(arg0Array);
 }
@@ -629,6 +1080,33 @@ void ManagedCascableCoreBasicAPI::BasicCameraProperty::setValue(ManagedCascableC
     wrappedObj->setValue(arg0);
 }
 
+void ManagedCascableCoreBasicAPI::BasicCameraProperty::setValueWithCompletion(ManagedCascableCoreBasicAPI::BasicPropertyValue^ newValue, System::Action<bool>^ completion) {
+    UnmanagedCascableCoreBasicAPI::BasicPropertyValue arg0 = *newValue->wrappedObj;
+    std::function<void (bool)> arg1 = (completion == nullptr ? std::function<void (bool)>() : std::function<void (bool)>([completionHandler = gcroot<System::Action<bool>^>(completion)](bool value0) { completionHandler->Invoke(value0); }));
+    wrappedObj->setValueWithCompletion(arg0, arg1);
+}
+
+System::Threading::Tasks::Task<bool>^ ManagedCascableCoreBasicAPI::BasicCameraProperty::setValueAsync(ManagedCascableCoreBasicAPI::BasicPropertyValue^ newValue) {
+    System::Threading::Tasks::TaskCompletionSource<bool>^ source = gcnew System::Threading::Tasks::TaskCompletionSource<bool>(System::Threading::Tasks::TaskCreationOptions::RunContinuationsAsynchronously);
+    setValueWithCompletion(newValue, gcnew System::Action<bool>(source, &System::Threading::Tasks::TaskCompletionSource<bool>::SetResult));
+    return source->Task;
+}
+
+ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getSetStatus() {
+    UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus unmanagedResult = wrappedObj->getSetStatus();
+    return gcnew ManagedCascableCoreBasicAPI::BasicPropertySetStatus(new UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(std::move(unmanagedResult)));
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicCameraProperty::getLastSetErrorDescription() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getLastSetErrorDescription();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+int ManagedCascableCoreBasicAPI::BasicCameraProperty::getCoalescedSetCount() {
+    int unmanagedResult = wrappedObj->getCoalescedSetCount();
+    return std::move(unmanagedResult);
+}
+
 // Implementation of ManagedCascableCoreBasicAPI::BasicDeviceInfo
 
 ManagedCascableCoreBasicAPI::BasicDeviceInfo::BasicDeviceInfo(UnmanagedCascableCoreBasicAPI::BasicDeviceInfo *objectToTakeOwnershipOf) {
@@ -641,22 +1119,225 @@ ManagedCascableCoreBasicAPI::BasicDeviceInfo::~BasicDeviceInfo() {
 
 System::String^ ManagedCascableCoreBasicAPI::BasicDeviceInfo::getManufacturer() {
     std::optional<std::string> unmanagedResult = wrappedObj->getManufacturer();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicDeviceInfo::getModel() {
     std::optional<std::string> unmanagedResult = wrappedObj->getModel();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicDeviceInfo::getVersion() {
     std::optional<std::string> unmanagedResult = wrappedObj->getVersion();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicDeviceInfo::getSerialNumber() {
     std::optional<std::string> unmanagedResult = wrappedObj->getSerialNumber();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicFileStorage
+
+ManagedCascableCoreBasicAPI::BasicFileStorage::BasicFileStorage(UnmanagedCascableCoreBasicAPI::BasicFileStorage *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicFileStorage::~BasicFileStorage() {
+    delete wrappedObj;
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicFileStorage::getDisplayName() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getDisplayName();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+int64_t ManagedCascableCoreBasicAPI::BasicFileStorage::getAvailableSpace() {
+    int64_t unmanagedResult = wrappedObj->getAvailableSpace();
+    return std::move(unmanagedResult);
+}
+
+int64_t ManagedCascableCoreBasicAPI::BasicFileStorage::getCapacity() {
+    int64_t unmanagedResult = wrappedObj->getCapacity();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFileStorage::getAllowsWrite() {
+    bool unmanagedResult = wrappedObj->getAllowsWrite();
+    return std::move(unmanagedResult);
+}
+
+ManagedCascableCoreBasicAPI::BasicFolder^ ManagedCascableCoreBasicAPI::BasicFileStorage::getRootFolder() {
+    UnmanagedCascableCoreBasicAPI::BasicFolder unmanagedResult = wrappedObj->getRootFolder();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFolder(new UnmanagedCascableCoreBasicAPI::BasicFolder(std::move(unmanagedResult)));
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicFileSystemItem
+
+ManagedCascableCoreBasicAPI::BasicFileSystemItem::BasicFileSystemItem(UnmanagedCascableCoreBasicAPI::BasicFileSystemItem *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicFileSystemItem::~BasicFileSystemItem() {
+    delete wrappedObj;
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicFileSystemItem::getName() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getName();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+int64_t ManagedCascableCoreBasicAPI::BasicFileSystemItem::getSize() {
+    int64_t unmanagedResult = wrappedObj->getSize();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFileSystemItem::isFolder() {
+    bool unmanagedResult = wrappedObj->isFolder();
+    return std::move(unmanagedResult);
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransfer^ ManagedCascableCoreBasicAPI::BasicFileSystemItem::beginTransfer(System::String^ localPath, int64_t offset, int64_t length) {
+    const std::string & arg0 = marshal_as<std::string>(localPath);
+    int64_t arg1 = offset;
+    int64_t arg2 = length;
+    UnmanagedCascableCoreBasicAPI::BasicFileTransfer unmanagedResult = wrappedObj->beginTransfer(arg0, arg1, arg2);
+    return gcnew ManagedCascableCoreBasicAPI::BasicFileTransfer(new UnmanagedCascableCoreBasicAPI::BasicFileTransfer(std::move(unmanagedResult)));
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicFileTransfer
+
+ManagedCascableCoreBasicAPI::BasicFileTransfer::BasicFileTransfer(UnmanagedCascableCoreBasicAPI::BasicFileTransfer *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransfer::~BasicFileTransfer() {
+    delete wrappedObj;
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicFileTransfer::getLocalPath() {
+    std::string unmanagedResult = wrappedObj->getLocalPath();
+    return marshal_as<System::String^>(std::move(unmanagedResult));
+}
+
+ManagedCascableCoreBasicAPI::BasicFileTransferState^ ManagedCascableCoreBasicAPI::BasicFileTransfer::getState() {
+    UnmanagedCascableCoreBasicAPI::BasicFileTransferState unmanagedResult = wrappedObj->getState();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFileTransferState(new UnmanagedCascableCoreBasicAPI::BasicFileTransferState(std::move(unmanagedResult)));
+}
+
+int64_t ManagedCascableCoreBasicAPI::BasicFileTransfer::getTotalFileSize() {
+    int64_t unmanagedResult = wrappedObj->getTotalFileSize();
+    return std::move(unmanagedResult);
+}
+
+int64_t ManagedCascableCoreBasicAPI::BasicFileTransfer::getRangeStart() {
+    int64_t unmanagedResult = wrappedObj->getRangeStart();
+    return std::move(unmanagedResult);
+}
+
+int64_t ManagedCascableCoreBasicAPI::BasicFileTransfer::getRangeLength() {
+    int64_t unmanagedResult = wrappedObj->getRangeLength();
+    return std::move(unmanagedResult);
+}
+
+int64_t ManagedCascableCoreBasicAPI::BasicFileTransfer::getBytesTransferred() {
+    int64_t unmanagedResult = wrappedObj->getBytesTransferred();
+    return std::move(unmanagedResult);
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicFileTransfer::getErrorDescription() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getErrorDescription();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+void ManagedCascableCoreBasicAPI::BasicFileTransfer::cancel() {
+    wrappedObj->cancel();
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicFolder
+
+ManagedCascableCoreBasicAPI::BasicFolder::BasicFolder(UnmanagedCascableCoreBasicAPI::BasicFolder *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicFolder::~BasicFolder() {
+    delete wrappedObj;
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicFolder::getName() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getName();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFolder::getChildrenLoaded() {
+    bool unmanagedResult = wrappedObj->getChildrenLoaded();
+    return std::move(unmanagedResult);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicFolder::getChildrenLoading() {
+    bool unmanagedResult = wrappedObj->getChildrenLoading();
+    return std::move(unmanagedResult);
+}
+
+System::String^ ManagedCascableCoreBasicAPI::BasicFolder::getLoadChildrenErrorDescription() {
+    std::optional<std::string> unmanagedResult = wrappedObj->getLoadChildrenErrorDescription();
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
+}
+
+void ManagedCascableCoreBasicAPI::BasicFolder::loadChildren() {
+    wrappedObj->loadChildren();
+}
+
+ManagedCascableCoreBasicAPI::BasicFolderListing^ ManagedCascableCoreBasicAPI::BasicFolder::listing() {
+    UnmanagedCascableCoreBasicAPI::BasicFolderListing unmanagedResult = wrappedObj->listing();
+    return gcnew ManagedCascableCoreBasicAPI::BasicFolderListing(new UnmanagedCascableCoreBasicAPI::BasicFolderListing(std::move(unmanagedResult)));
+}
+
+// Implementation of ManagedCascableCoreBasicAPI::BasicFolderListing
+
+ManagedCascableCoreBasicAPI::BasicFolderListing::BasicFolderListing(UnmanagedCascableCoreBasicAPI::BasicFolderListing *objectToTakeOwnershipOf) {
+    wrappedObj = objectToTakeOwnershipOf;
+}
+
+ManagedCascableCoreBasicAPI::BasicFolderListing::~BasicFolderListing() {
+    delete wrappedObj;
+}
+
+int ManagedCascableCoreBasicAPI::BasicFolderListing::getRecordStride() {
+    int unmanagedResult = wrappedObj->getRecordStride();
+    return std::move(unmanagedResult);
+}
+
+int ManagedCascableCoreBasicAPI::BasicFolderListing::getCount() {
+    int unmanagedResult = wrappedObj->getCount();
+    return std::move(unmanagedResult);
+}
+
+int ManagedCascableCoreBasicAPI::BasicFolderListing::getRecordBufferLength() {
+    int unmanagedResult = wrappedObj->getRecordBufferLength();
+    return std::move(unmanagedResult);
+}
+
+ManagedCascableCoreBasicAPI::BasicByteBuffer^ ManagedCascableCoreBasicAPI::BasicFolderListing::getRecordBuffer() {
+    UnmanagedCascableCoreBasicAPI::BasicByteBuffer unmanagedResult = wrappedObj->getRecordBuffer();
+    return gcnew ManagedCascableCoreBasicAPI::BasicByteBuffer(new UnmanagedCascableCoreBasicAPI::BasicByteBuffer(std::move(unmanagedResult)));
+}
+
+void ManagedCascableCoreBasicAPI::BasicFolderListing::copyRecords(uint8_t * pointer) {
+    uint8_t * arg0 = pointer;
+    wrappedObj->copyRecords(arg0);
+}
+
+ManagedCascableCoreBasicAPI::BasicFileSystemItem^ ManagedCascableCoreBasicAPI::BasicFolderListing::item(int handle) {
+    int arg0 = handle;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem> unmanagedResult = wrappedObj->item(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicFileSystemItem(new UnmanagedCascableCoreBasicAPI::BasicFileSystemItem(std::move(unmanagedResult.value()))) : nullptr);
+}
+
+ManagedCascableCoreBasicAPI::BasicFolder^ ManagedCascableCoreBasicAPI::BasicFolderListing::folder(int handle) {
+    int arg0 = handle;
+    std::optional<UnmanagedCascableCoreBasicAPI::BasicFolder> unmanagedResult = wrappedObj->folder(arg0);
+    return (unmanagedResult.has_value() ? gcnew ManagedCascableCoreBasicAPI::BasicFolder(new UnmanagedCascableCoreBasicAPI::BasicFolder(std::move(unmanagedResult.value()))) : nullptr);
 }
 
 // Implementation of ManagedCascableCoreBasicAPI::BasicLiveViewFrame
@@ -671,12 +1352,12 @@ ManagedCascableCoreBasicAPI::BasicLiveViewFrame::~BasicLiveViewFrame() {
 
 double ManagedCascableCoreBasicAPI::BasicLiveViewFrame::getDateProduced() {
     double unmanagedResult = wrappedObj->getDateProduced();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 int ManagedCascableCoreBasicAPI::BasicLiveViewFrame::getRawPixelDataLength() {
     int unmanagedResult = wrappedObj->getRawPixelDataLength();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 void ManagedCascableCoreBasicAPI::BasicLiveViewFrame::copyPixelData(uint8_t * pointer) {
@@ -684,9 +1365,14 @@ void ManagedCascableCoreBasicAPI::BasicLiveViewFrame::copyPixelData(uint8_t * po
     wrappedObj->copyPixelData(arg0);
 }
 
+ManagedCascableCoreBasicAPI::BasicByteBuffer^ ManagedCascableCoreBasicAPI::BasicLiveViewFrame::getRawPixelBuffer() {
+    UnmanagedCascableCoreBasicAPI::BasicByteBuffer unmanagedResult = wrappedObj->getRawPixelBuffer();
+    return gcnew ManagedCascableCoreBasicAPI::BasicByteBuffer(new UnmanagedCascableCoreBasicAPI::BasicByteBuffer(std::move(unmanagedResult)));
+}
+
 ManagedCascableCoreBasicAPI::BasicSize^ ManagedCascableCoreBasicAPI::BasicLiveViewFrame::getRawPixelSize() {
     UnmanagedCascableCoreBasicAPI::BasicSize unmanagedResult = wrappedObj->getRawPixelSize();
-    return gcnew ManagedCascableCoreBasicAPI::BasicSize(new UnmanagedCascableCoreBasicAPI::BasicSize(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicSize(new UnmanagedCascableCoreBasicAPI::BasicSize(std::move(unmanagedResult)));
 }
 
 // Implementation of ManagedCascableCoreBasicAPI::BasicPropertyValue
@@ -701,12 +1387,12 @@ ManagedCascableCoreBasicAPI::BasicPropertyValue::~BasicPropertyValue() {
 
 System::String^ ManagedCascableCoreBasicAPI::BasicPropertyValue::getLocalizedDisplayValue() {
     std::optional<std::string> unmanagedResult = wrappedObj->getLocalizedDisplayValue();
-    return (unmanagedResult.has_value() ? marshal_as<System::String^>(unmanagedResult.value()) : nullptr);
+    return (unmanagedResult.has_value() ? marshal_as<System::String^>(std::move(unmanagedResult.value())) : nullptr);
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicPropertyValue::getStringValue() {
     std::string unmanagedResult = wrappedObj->getStringValue();
-    return marshal_as<System::String^>(unmanagedResult);
+    return marshal_as<System::String^>(std::move(unmanagedResult));
 }
 
 // Implementation of ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration
@@ -721,12 +1407,12 @@ ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::~BasicSimulatedC
 
 ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration^ ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::defaultConfiguration() {
     UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration unmanagedResult = UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::defaultConfiguration();
-    return gcnew ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration(new UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration(unmanagedResult));
+    return gcnew ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration(new UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration(std::move(unmanagedResult)));
 }
 
 System::String^ ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getManufacturer() {
     std::string unmanagedResult = wrappedObj->getManufacturer();
-    return marshal_as<System::String^>(unmanagedResult);
+    return marshal_as<System::String^>(std::move(unmanagedResult));
 }
 
 void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setManufacturer(System::String^ value) {
@@ -736,7 +1422,7 @@ void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setManufact
 
 System::String^ ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getModel() {
     std::string unmanagedResult = wrappedObj->getModel();
-    return marshal_as<System::String^>(unmanagedResult);
+    return marshal_as<System::String^>(std::move(unmanagedResult));
 }
 
 void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setModel(System::String^ value) {
@@ -746,7 +1432,7 @@ void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setModel(Sy
 
 System::String^ ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getIdentifier() {
     std::string unmanagedResult = wrappedObj->getIdentifier();
-    return marshal_as<System::String^>(unmanagedResult);
+    return marshal_as<System::String^>(std::move(unmanagedResult));
 }
 
 void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setIdentifier(System::String^ value) {
@@ -754,9 +1440,19 @@ void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setIdentifi
     wrappedObj->setIdentifier(arg0);
 }
 
+int ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getCameraCount() {
+    int unmanagedResult = wrappedObj->getCameraCount();
+    return std::move(unmanagedResult);
+}
+
+void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setCameraCount(int value) {
+    int arg0 = value;
+    wrappedObj->setCameraCount(arg0);
+}
+
 System::String^ ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getLiveViewImageContainerPath() {
     std::string unmanagedResult = wrappedObj->getLiveViewImageContainerPath();
-    return marshal_as<System::String^>(unmanagedResult);
+    return marshal_as<System::String^>(std::move(unmanagedResult));
 }
 
 void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setLiveViewImageContainerPath(System::String^ value) {
@@ -764,6 +1460,56 @@ void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setLiveView
     wrappedObj->setLiveViewImageContainerPath(arg0);
 }
 
+double ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getBurstFramesPerSecond() {
+    double unmanagedResult = wrappedObj->getBurstFramesPerSecond();
+    return std::move(unmanagedResult);
+}
+
+void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setBurstFramesPerSecond(double value) {
+    double arg0 = value;
+    wrappedObj->setBurstFramesPerSecond(arg0);
+}
+
+int ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getBurstLength() {
+    int unmanagedResult = wrappedObj->getBurstLength();
+    return std::move(unmanagedResult);
+}
+
+void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setBurstLength(int value) {
+    int arg0 = value;
+    wrappedObj->setBurstLength(arg0);
+}
+
+int ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getSyntheticOriginalByteCount() {
+    int unmanagedResult = wrappedObj->getSyntheticOriginalByteCount();
+    return std::move(unmanagedResult);
+}
+
+void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setSyntheticOriginalByteCount(int value) {
+    int arg0 = value;
+    wrappedObj->setSyntheticOriginalByteCount(arg0);
+}
+
+bool ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getDeliversLiveViewOnSeparateLane() {
+    bool unmanagedResult = wrappedObj->getDeliversLiveViewOnSeparateLane();
+    return std::move(unmanagedResult);
+}
+
+void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setDeliversLiveViewOnSeparateLane(bool value) {
+    bool arg0 = value;
+    wrappedObj->setDeliversLiveViewOnSeparateLane(arg0);
+}
+
+int ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getWorkerQueueCount() {
+    int unmanagedResult = wrappedObj->getWorkerQueueCount();
+    return std::move(unmanagedResult);
+}
+
+void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setWorkerQueueCount(int value) {
+    int arg0 = value;
+    wrappedObj->setWorkerQueueCount(arg0);
+}
+
 void ManagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::apply() {
     wrappedObj->apply();
 }
@@ -780,11 +1526,11 @@ ManagedCascableCoreBasicAPI::BasicSize::~BasicSize() {
 
 double ManagedCascableCoreBasicAPI::BasicSize::getWidth() {
     double unmanagedResult = wrappedObj->getWidth();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
 double ManagedCascableCoreBasicAPI::BasicSize::getHeight() {
     double unmanagedResult = wrappedObj->getHeight();
-    return unmanagedResult;
+    return std::move(unmanagedResult);
 }
 
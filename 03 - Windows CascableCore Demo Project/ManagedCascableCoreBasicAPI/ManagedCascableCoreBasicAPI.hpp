@@ -10,11 +10,22 @@ using namespace System::Collections::Generic;
 namespace ManagedCascableCoreBasicAPI {
 
     ref class BasicPropertyIdentifier;
+    ref class BasicFileTransferState;
+    ref class BasicFolderListingFlags;
+    ref class BasicCameraDiscoveryEventType;
+    ref class BasicPropertySetStatus;
+    ref class BasicByteBuffer;
     ref class BasicCamera;
     ref class BasicCameraDiscovery;
+    ref class BasicCameraDiscoveryEvent;
     ref class BasicCameraInitiatedTransferResult;
     ref class BasicCameraProperty;
     ref class BasicDeviceInfo;
+    ref class BasicFileStorage;
+    ref class BasicFileSystemItem;
+    ref class BasicFileTransfer;
+    ref class BasicFolder;
+    ref class BasicFolderListing;
     ref class BasicLiveViewFrame;
     ref class BasicPropertyValue;
     ref class BasicSimulatedCameraConfiguration;
@@ -96,6 +107,107 @@ namespace ManagedCascableCoreBasicAPI {
         unsigned int getRawValue();
     };
 
+    public ref class BasicFileTransferState {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicFileTransferState *wrappedObj;
+        BasicFileTransferState(UnmanagedCascableCoreBasicAPI::BasicFileTransferState *objectToTakeOwnershipOf);
+    public:
+        ~BasicFileTransferState();
+    
+        static ManagedCascableCoreBasicAPI::BasicFileTransferState^ initWithRawValue(unsigned int rawValue);
+        static ManagedCascableCoreBasicAPI::BasicFileTransferState^ inProgress();
+        static ManagedCascableCoreBasicAPI::BasicFileTransferState^ completed();
+        static ManagedCascableCoreBasicAPI::BasicFileTransferState^ failed();
+        static ManagedCascableCoreBasicAPI::BasicFileTransferState^ cancelled();
+        static bool operator==(ManagedCascableCoreBasicAPI::BasicFileTransferState^ lhs, ManagedCascableCoreBasicAPI::BasicFileTransferState^ rhs);
+    
+        bool isInProgress();
+        bool isCompleted();
+        bool isFailed();
+        bool isCancelled();
+        unsigned int getRawValue();
+    };
+
+    public ref class BasicFolderListingFlags {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags *wrappedObj;
+        BasicFolderListingFlags(UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags *objectToTakeOwnershipOf);
+    public:
+        ~BasicFolderListingFlags();
+    
+        static ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ initWithRawValue(unsigned int rawValue);
+        static ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ folder();
+        static ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ image();
+        static ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ video();
+        static bool operator==(ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ lhs, ManagedCascableCoreBasicAPI::BasicFolderListingFlags^ rhs);
+    
+        bool isFolder();
+        bool isImage();
+        bool isVideo();
+        unsigned int getRawValue();
+    };
+
+    public ref class BasicCameraDiscoveryEventType {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType *wrappedObj;
+        BasicCameraDiscoveryEventType(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType *objectToTakeOwnershipOf);
+    public:
+        ~BasicCameraDiscoveryEventType();
+    
+        static ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ initWithRawValue(unsigned int rawValue);
+        static ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ appeared();
+        static ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ lost();
+        static ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ metadataResolved();
+        static bool operator==(ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ lhs, ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ rhs);
+    
+        bool isAppeared();
+        bool isLost();
+        bool isMetadataResolved();
+        unsigned int getRawValue();
+    };
+
+    public ref class BasicPropertySetStatus {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus *wrappedObj;
+        BasicPropertySetStatus(UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus *objectToTakeOwnershipOf);
+    public:
+        ~BasicPropertySetStatus();
+    
+        static ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ initWithRawValue(unsigned int rawValue);
+        static ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ idle();
+        static ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ inProgress();
+        static ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ succeeded();
+        static ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ failed();
+        static bool operator==(ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ lhs, ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ rhs);
+    
+        bool isIdle();
+        bool isInProgress();
+        bool isSucceeded();
+        bool isFailed();
+        unsigned int getRawValue();
+    };
+
+    public ref class BasicByteBuffer {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicByteBuffer *wrappedObj;
+        BasicByteBuffer(UnmanagedCascableCoreBasicAPI::BasicByteBuffer *objectToTakeOwnershipOf);
+    public:
+        ~BasicByteBuffer();
+    
+        const uint8_t * getBytes();
+        int getCount();
+    
+        // Copies the buffer's contents into a new array.
+        array<System::Byte>^ ToArray();
+        // Copies the buffer's contents into the given array, which must be at least as long as the buffer.
+        void CopyTo(array<System::Byte>^ destination);
+    };
+
     public ref class BasicCamera {
     private:
     internal:
@@ -104,12 +216,19 @@ namespace ManagedCascableCoreBasicAPI {
     public:
         ~BasicCamera();
     
+        int getHandle();
         System::String^ getFriendlyIdentifier();
         bool getConnected();
         ManagedCascableCoreBasicAPI::BasicDeviceInfo^ getDeviceInfo();
         System::String^ getFriendlyDisplayName();
         void connect();
+        void connectWithCompletion(System::Action<bool>^ completion);
+        System::Threading::Tasks::Task<bool>^ connectAsync();
         void disconnect();
+        void disconnectWithCompletion(System::Action<bool>^ completion);
+        System::Threading::Tasks::Task<bool>^ disconnectAsync();
+        List<ManagedCascableCoreBasicAPI::BasicFileStorage^>^ getStorageDevices();
+        ManagedCascableCoreBasicAPI::BasicFileSystemItem^ fileSystemItem(System::String^ path);
         bool getAutoFocusEngaged();
         void engageAutoFocus();
         void disengageAutoFocus();
@@ -117,8 +236,16 @@ namespace ManagedCascableCoreBasicAPI {
         void engageShutter();
         void disengageShutter();
         void invokeOneShotShutterExplicitlyEngagingAutoFocus(bool triggerAutoFocus);
-        ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ getLastReceivedPreview();
-        void setLastReceivedPreview(ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ value);
+        int getReceivedTransferCapacity();
+        void setReceivedTransferCapacity(int newValue);
+        int getPendingTransferCount();
+        int getReceivedTransferCount();
+        int getDroppedTransferCount();
+        int getFailedTransferCount();
+        ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ dequeueTransfer();
+        ManagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult^ waitForTransfer(double timeout);
+        System::String^ getCameraInitiatedTransferDirectory();
+        void setCameraInitiatedTransferDirectory(System::String^ newValue);
         bool getHandleCameraInitiatedPreviews();
         void setHandleCameraInitiatedPreviews(bool newValue);
         void beginLiveViewStream();
@@ -126,6 +253,8 @@ namespace ManagedCascableCoreBasicAPI {
         bool getLiveViewStreamActive();
         ManagedCascableCoreBasicAPI::BasicLiveViewFrame^ getLastLiveViewFrame();
         void setLastLiveViewFrame(ManagedCascableCoreBasicAPI::BasicLiveViewFrame^ value);
+        void setLiveViewFrameCallback(System::Action<ManagedCascableCoreBasicAPI::BasicLiveViewFrame^>^ callback);
+        void clearLiveViewFrameCallback();
         List<ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^>^ getKnownPropertyIdentifiers();
         ManagedCascableCoreBasicAPI::BasicCameraProperty^ property(ManagedCascableCoreBasicAPI::BasicPropertyIdentifier^ identifier);
     };
@@ -143,10 +272,28 @@ namespace ManagedCascableCoreBasicAPI {
         bool getDiscoveryRunning();
         void setDiscoveryRunning(bool value);
         List<ManagedCascableCoreBasicAPI::BasicCamera^>^ getVisibleCameras();
+        ManagedCascableCoreBasicAPI::BasicCamera^ camera(int handle);
+        int getPendingEventCount();
+        int getDroppedEventCount();
+        ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent^ dequeueEvent();
+        ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent^ waitForEvent(double timeout);
         void startDiscovery(System::String^ clientName);
         void stopDiscovery();
     };
 
+    public ref class BasicCameraDiscoveryEvent {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent *wrappedObj;
+        BasicCameraDiscoveryEvent(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent *objectToTakeOwnershipOf);
+    public:
+        ~BasicCameraDiscoveryEvent();
+    
+        ManagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType^ getType();
+        ManagedCascableCoreBasicAPI::BasicCamera^ getCamera();
+        int getCameraHandle();
+    };
+
     public ref class BasicCameraInitiatedTransferResult {
     private:
     internal:
@@ -155,12 +302,15 @@ namespace ManagedCascableCoreBasicAPI {
     public:
         ~BasicCameraInitiatedTransferResult();
     
+        int getSequenceNumber();
         double getDateProduced();
         bool isOnlyDestinationForImage();
         System::String^ getFileNameHint();
         System::String^ getSuggestedFileNameExtensionForRepresentation();
         System::String^ getUtiForRepresentation();
+        System::String^ getLocalPath();
         int getRawImageDataLength();
+        ManagedCascableCoreBasicAPI::BasicByteBuffer^ getImageBuffer();
         void copyPixelData(uint8_t * pointer);
     };
 
@@ -182,6 +332,11 @@ namespace ManagedCascableCoreBasicAPI {
         List<ManagedCascableCoreBasicAPI::BasicPropertyValue^>^ getValidSettableValues();
         void setValidSettableValues(List<ManagedCascableCoreBasicAPI::BasicPropertyValue^>^ value);
         void setValue(ManagedCascableCoreBasicAPI::BasicPropertyValue^ newValue);
+        void setValueWithCompletion(ManagedCascableCoreBasicAPI::BasicPropertyValue^ newValue, System::Action<bool>^ completion);
+        System::Threading::Tasks::Task<bool>^ setValueAsync(ManagedCascableCoreBasicAPI::BasicPropertyValue^ newValue);
+        ManagedCascableCoreBasicAPI::BasicPropertySetStatus^ getSetStatus();
+        System::String^ getLastSetErrorDescription();
+        int getCoalescedSetCount();
     };
 
     public ref class BasicDeviceInfo {
@@ -198,6 +353,86 @@ namespace ManagedCascableCoreBasicAPI {
         System::String^ getSerialNumber();
     };
 
+    public ref class BasicFileStorage {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicFileStorage *wrappedObj;
+        BasicFileStorage(UnmanagedCascableCoreBasicAPI::BasicFileStorage *objectToTakeOwnershipOf);
+    public:
+        ~BasicFileStorage();
+    
+        System::String^ getDisplayName();
+        int64_t getAvailableSpace();
+        int64_t getCapacity();
+        bool getAllowsWrite();
+        ManagedCascableCoreBasicAPI::BasicFolder^ getRootFolder();
+    };
+
+    public ref class BasicFileSystemItem {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicFileSystemItem *wrappedObj;
+        BasicFileSystemItem(UnmanagedCascableCoreBasicAPI::BasicFileSystemItem *objectToTakeOwnershipOf);
+    public:
+        ~BasicFileSystemItem();
+    
+        System::String^ getName();
+        int64_t getSize();
+        bool isFolder();
+        ManagedCascableCoreBasicAPI::BasicFileTransfer^ beginTransfer(System::String^ localPath, int64_t offset, int64_t length);
+    };
+
+    public ref class BasicFileTransfer {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicFileTransfer *wrappedObj;
+        BasicFileTransfer(UnmanagedCascableCoreBasicAPI::BasicFileTransfer *objectToTakeOwnershipOf);
+    public:
+        ~BasicFileTransfer();
+    
+        System::String^ getLocalPath();
+        ManagedCascableCoreBasicAPI::BasicFileTransferState^ getState();
+        int64_t getTotalFileSize();
+        int64_t getRangeStart();
+        int64_t getRangeLength();
+        int64_t getBytesTransferred();
+        System::String^ getErrorDescription();
+        void cancel();
+    };
+
+    public ref class BasicFolder {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicFolder *wrappedObj;
+        BasicFolder(UnmanagedCascableCoreBasicAPI::BasicFolder *objectToTakeOwnershipOf);
+    public:
+        ~BasicFolder();
+    
+        System::String^ getName();
+        bool getChildrenLoaded();
+        bool getChildrenLoading();
+        System::String^ getLoadChildrenErrorDescription();
+        void loadChildren();
+        ManagedCascableCoreBasicAPI::BasicFolderListing^ listing();
+    };
+
+    public ref class BasicFolderListing {
+    private:
+    internal:
+        UnmanagedCascableCoreBasicAPI::BasicFolderListing *wrappedObj;
+        BasicFolderListing(UnmanagedCascableCoreBasicAPI::BasicFolderListing *objectToTakeOwnershipOf);
+    public:
+        ~BasicFolderListing();
+    
+        int getRecordStride();
+        int getCount();
+        int getRecordBufferLength();
+        ManagedCascableCoreBasicAPI::BasicByteBuffer^ getRecordBuffer();
+        void copyRecords(uint8_t * pointer);
+        ManagedCascableCoreBasicAPI::BasicFileSystemItem^ item(int handle);
+        ManagedCascableCoreBasicAPI::BasicFolder^ folder(int handle);
+    };
+
     public ref class BasicLiveViewFrame {
     private:
     internal:
@@ -209,6 +444,7 @@ namespace ManagedCascableCoreBasicAPI {
         double getDateProduced();
         int getRawPixelDataLength();
         void copyPixelData(uint8_t * pointer);
+        ManagedCascableCoreBasicAPI::BasicByteBuffer^ getRawPixelBuffer();
         ManagedCascableCoreBasicAPI::BasicSize^ getRawPixelSize();
     };
 
@@ -240,8 +476,20 @@ namespace ManagedCascableCoreBasicAPI {
         void setModel(System::String^ value);
         System::String^ getIdentifier();
         void setIdentifier(System::String^ value);
+        int getCameraCount();
+        void setCameraCount(int value);
         System::String^ getLiveViewImageContainerPath();
         void setLiveViewImageContainerPath(System::String^ value);
+        double getBurstFramesPerSecond();
+        void setBurstFramesPerSecond(double value);
+        int getBurstLength();
+        void setBurstLength(int value);
+        int getSyntheticOriginalByteCount();
+        void setSyntheticOriginalByteCount(int value);
+        bool getDeliversLiveViewOnSeparateLane();
+        void setDeliversLiveViewOnSeparateLane(bool value);
+        int getWorkerQueueCount();
+        void setWorkerQueueCount(int value);
         void apply();
     };
 
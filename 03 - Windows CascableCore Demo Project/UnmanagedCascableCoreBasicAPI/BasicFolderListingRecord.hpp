@@ -0,0 +1,46 @@
+// BasicFolderListingRecord.hpp
+//
+// The layout of the records filled in by BasicFolderListing::copyRecords(). This file is maintained by hand, and must
+// be kept in sync with the record layout documented on BasicFolderListing in CascableCoreBasicAPI.swift.
+
+#ifndef BasicFolderListingRecord_hpp
+#define BasicFolderListingRecord_hpp
+#include <cstdint>
+#include <string_view>
+
+namespace UnmanagedCascableCoreBasicAPI {
+
+    /// A single entry in a folder listing buffer. The buffer holds `BasicFolderListing::getCount()` records followed by
+    /// the entries' null-terminated UTF-8 names, so a whole listing can be read with one allocation and one copy:
+    ///
+    ///     std::vector<uint8_t> buffer(listing.getRecordBufferLength());
+    ///     listing.copyRecords(buffer.data());
+    ///     auto records = reinterpret_cast<const BasicFolderListingRecord *>(buffer.data());
+    struct BasicFolderListingRecord {
+        /// The entry's size, in bytes (zero for folders).
+        uint64_t size;
+        /// The entry's creation date, in seconds since 1970, or NaN if unknown.
+        double dateCreated;
+        /// The offset of the entry's name from the start of the buffer.
+        uint32_t nameOffset;
+        /// The length of the entry's name in bytes, excluding its null terminator.
+        uint32_t nameLength;
+        /// The entry's flags, a combination of BasicFolderListingFlags raw values.
+        uint32_t flags;
+        /// The entry's handle, for use with BasicFolderListing::item() and BasicFolderListing::folder().
+        uint32_t handle;
+
+        /// Returns the entry's name from the buffer the record was copied into.
+        std::string_view name(const uint8_t *buffer) const {
+            return std::string_view(reinterpret_cast<const char *>(buffer + nameOffset), nameLength);
+        }
+
+        bool isFolder() const { return (flags & 1) != 0; }
+        bool isImage() const { return (flags & 2) != 0; }
+        bool isVideo() const { return (flags & 4) != 0; }
+    };
+
+    static_assert(sizeof(BasicFolderListingRecord) == 32, "BasicFolderListingRecord must match the Swift record stride.");
+}
+
+#endif /* BasicFolderListingRecord_hpp */
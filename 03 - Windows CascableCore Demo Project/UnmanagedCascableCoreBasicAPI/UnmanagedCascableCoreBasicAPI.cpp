@@ -2,326 +2,348 @@
 
 #include "UnmanagedCascableCoreBasicAPI.hpp"
 #include <CascableCoreBasicAPI-Swift.h>
+#include <new>
+#include <utility>
 
 // Implementation of UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier
 
-UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::BasicPropertyIdentifier(std::shared_ptr<CascableCoreBasicAPI::BasicPropertyIdentifier> swiftObj) {
-    this->swiftObj = swiftObj;
+UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::BasicPropertyIdentifier(const CascableCoreBasicAPI::BasicPropertyIdentifier &value) {
+    static_assert(sizeof(CascableCoreBasicAPI::BasicPropertyIdentifier) <= 1 && alignof(CascableCoreBasicAPI::BasicPropertyIdentifier) <= 1, "Inline storage for BasicPropertyIdentifier is too small. Regenerate the wrapper.");
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
-UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::~BasicPropertyIdentifier() {}
+UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::BasicPropertyIdentifier(const UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier &other) {
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicPropertyIdentifier(other.swiftObj());
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier &UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::operator=(const UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier &other) {
+    swiftObj() = other.swiftObj();
+    return *this;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::~BasicPropertyIdentifier() {
+    swiftObj().~BasicPropertyIdentifier();
+}
+
+const CascableCoreBasicAPI::BasicPropertyIdentifier &UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::swiftObj() const {
+    return *reinterpret_cast<const CascableCoreBasicAPI::BasicPropertyIdentifier *>(swiftObjStorage);
+}
+
+CascableCoreBasicAPI::BasicPropertyIdentifier &UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::swiftObj() {
+    return *reinterpret_cast<CascableCoreBasicAPI::BasicPropertyIdentifier *>(swiftObjStorage);
+}
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isoSpeed() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::isoSpeed();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::shutterSpeed() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::shutterSpeed();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::aperture() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::aperture();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::exposureCompensation() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::exposureCompensation();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::batteryLevel() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::batteryLevel();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::powerSource() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::powerSource();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::afSystem() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::afSystem();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::focusMode() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::focusMode();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::driveMode() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::driveMode();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::autoExposureMode() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::autoExposureMode();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::inCameraBracketingEnabled() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::inCameraBracketingEnabled();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupEnabled() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupEnabled();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupStage() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::mirrorLockupStage();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::dofPreviewEnabled() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::dofPreviewEnabled();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::shotsAvailable() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::shotsAvailable();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::lensStatus() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::lensStatus();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::colorTone() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::colorTone();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::artFilter() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::artFilter();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::digitalZoom() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::digitalZoom();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::whiteBalance() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::whiteBalance();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::noiseReduction() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::noiseReduction();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::imageQuality() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::imageQuality();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterStatus() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterStatus();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterReading() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::lightMeterReading();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::exposureMeteringMode() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::exposureMeteringMode();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::readyForCapture() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::readyForCapture();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::imageDestination() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::imageDestination();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::videoRecordingFormat() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::videoRecordingFormat();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::liveViewZoomLevel() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::liveViewZoomLevel();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::maxValue() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::maxValue();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::unknown() {
     CascableCoreBasicAPI::BasicPropertyIdentifier value = CascableCoreBasicAPI::BasicPropertyIdentifier::unknown();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(value));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(value);
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::operator==(const UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier &other) const {
-    return (*swiftObj.get() == *other.swiftObj.get());
+    return (swiftObj() == other.swiftObj());
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isIsoSpeed() {
-    bool swiftResult = swiftObj->isIsoSpeed();
+    bool swiftResult = swiftObj().isIsoSpeed();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isShutterSpeed() {
-    bool swiftResult = swiftObj->isShutterSpeed();
+    bool swiftResult = swiftObj().isShutterSpeed();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isAperture() {
-    bool swiftResult = swiftObj->isAperture();
+    bool swiftResult = swiftObj().isAperture();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isExposureCompensation() {
-    bool swiftResult = swiftObj->isExposureCompensation();
+    bool swiftResult = swiftObj().isExposureCompensation();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isBatteryLevel() {
-    bool swiftResult = swiftObj->isBatteryLevel();
+    bool swiftResult = swiftObj().isBatteryLevel();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isPowerSource() {
-    bool swiftResult = swiftObj->isPowerSource();
+    bool swiftResult = swiftObj().isPowerSource();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isAfSystem() {
-    bool swiftResult = swiftObj->isAfSystem();
+    bool swiftResult = swiftObj().isAfSystem();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isFocusMode() {
-    bool swiftResult = swiftObj->isFocusMode();
+    bool swiftResult = swiftObj().isFocusMode();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isDriveMode() {
-    bool swiftResult = swiftObj->isDriveMode();
+    bool swiftResult = swiftObj().isDriveMode();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isAutoExposureMode() {
-    bool swiftResult = swiftObj->isAutoExposureMode();
+    bool swiftResult = swiftObj().isAutoExposureMode();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isInCameraBracketingEnabled() {
-    bool swiftResult = swiftObj->isInCameraBracketingEnabled();
+    bool swiftResult = swiftObj().isInCameraBracketingEnabled();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isMirrorLockupEnabled() {
-    bool swiftResult = swiftObj->isMirrorLockupEnabled();
+    bool swiftResult = swiftObj().isMirrorLockupEnabled();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isMirrorLockupStage() {
-    bool swiftResult = swiftObj->isMirrorLockupStage();
+    bool swiftResult = swiftObj().isMirrorLockupStage();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isDofPreviewEnabled() {
-    bool swiftResult = swiftObj->isDofPreviewEnabled();
+    bool swiftResult = swiftObj().isDofPreviewEnabled();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isShotsAvailable() {
-    bool swiftResult = swiftObj->isShotsAvailable();
+    bool swiftResult = swiftObj().isShotsAvailable();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLensStatus() {
-    bool swiftResult = swiftObj->isLensStatus();
+    bool swiftResult = swiftObj().isLensStatus();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isColorTone() {
-    bool swiftResult = swiftObj->isColorTone();
+    bool swiftResult = swiftObj().isColorTone();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isArtFilter() {
-    bool swiftResult = swiftObj->isArtFilter();
+    bool swiftResult = swiftObj().isArtFilter();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isDigitalZoom() {
-    bool swiftResult = swiftObj->isDigitalZoom();
+    bool swiftResult = swiftObj().isDigitalZoom();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isWhiteBalance() {
-    bool swiftResult = swiftObj->isWhiteBalance();
+    bool swiftResult = swiftObj().isWhiteBalance();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isNoiseReduction() {
-    bool swiftResult = swiftObj->isNoiseReduction();
+    bool swiftResult = swiftObj().isNoiseReduction();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isImageQuality() {
-    bool swiftResult = swiftObj->isImageQuality();
+    bool swiftResult = swiftObj().isImageQuality();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLightMeterStatus() {
-    bool swiftResult = swiftObj->isLightMeterStatus();
+    bool swiftResult = swiftObj().isLightMeterStatus();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLightMeterReading() {
-    bool swiftResult = swiftObj->isLightMeterReading();
+    bool swiftResult = swiftObj().isLightMeterReading();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isExposureMeteringMode() {
-    bool swiftResult = swiftObj->isExposureMeteringMode();
+    bool swiftResult = swiftObj().isExposureMeteringMode();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isReadyForCapture() {
-    bool swiftResult = swiftObj->isReadyForCapture();
+    bool swiftResult = swiftObj().isReadyForCapture();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isImageDestination() {
-    bool swiftResult = swiftObj->isImageDestination();
+    bool swiftResult = swiftObj().isImageDestination();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isVideoRecordingFormat() {
-    bool swiftResult = swiftObj->isVideoRecordingFormat();
+    bool swiftResult = swiftObj().isVideoRecordingFormat();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isLiveViewZoomLevel() {
-    bool swiftResult = swiftObj->isLiveViewZoomLevel();
+    bool swiftResult = swiftObj().isLiveViewZoomLevel();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isMaxValue() {
-    bool swiftResult = swiftObj->isMaxValue();
+    bool swiftResult = swiftObj().isMaxValue();
     return swiftResult;
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::isUnknown() {
-    bool swiftResult = swiftObj->isUnknown();
+    bool swiftResult = swiftObj().isUnknown();
     return swiftResult;
 }
 
@@ -330,25 +352,382 @@ std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier> UnmanagedC
     swift::Optional<CascableCoreBasicAPI::BasicPropertyIdentifier> swiftResult = CascableCoreBasicAPI::BasicPropertyIdentifier::init(arg0);
     if (swiftResult) {
         CascableCoreBasicAPI::BasicPropertyIdentifier unwrapped = swiftResult.get();
-        return std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier>(UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(unwrapped)));
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier>(UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(unwrapped));
     } else {
         return std::nullopt;
     }
 }
 
 unsigned int UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier::getRawValue() {
-    swift::UInt swiftResult = swiftObj->getRawValue();
+    swift::UInt swiftResult = swiftObj().getRawValue();
     return (unsigned int)swiftResult;
 }
 
-// Implementation of UnmanagedCascableCoreBasicAPI::BasicCamera
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicFileTransferState
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState::BasicFileTransferState(const CascableCoreBasicAPI::BasicFileTransferState &value) {
+    static_assert(sizeof(CascableCoreBasicAPI::BasicFileTransferState) <= 1 && alignof(CascableCoreBasicAPI::BasicFileTransferState) <= 1, "Inline storage for BasicFileTransferState is too small. Regenerate the wrapper.");
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicFileTransferState(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState::BasicFileTransferState(const UnmanagedCascableCoreBasicAPI::BasicFileTransferState &other) {
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicFileTransferState(other.swiftObj());
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState &UnmanagedCascableCoreBasicAPI::BasicFileTransferState::operator=(const UnmanagedCascableCoreBasicAPI::BasicFileTransferState &other) {
+    swiftObj() = other.swiftObj();
+    return *this;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState::~BasicFileTransferState() {
+    swiftObj().~BasicFileTransferState();
+}
+
+const CascableCoreBasicAPI::BasicFileTransferState &UnmanagedCascableCoreBasicAPI::BasicFileTransferState::swiftObj() const {
+    return *reinterpret_cast<const CascableCoreBasicAPI::BasicFileTransferState *>(swiftObjStorage);
+}
+
+CascableCoreBasicAPI::BasicFileTransferState &UnmanagedCascableCoreBasicAPI::BasicFileTransferState::swiftObj() {
+    return *reinterpret_cast<CascableCoreBasicAPI::BasicFileTransferState *>(swiftObjStorage);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState UnmanagedCascableCoreBasicAPI::BasicFileTransferState::inProgress() {
+    CascableCoreBasicAPI::BasicFileTransferState value = CascableCoreBasicAPI::BasicFileTransferState::inProgress();
+    return UnmanagedCascableCoreBasicAPI::BasicFileTransferState(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState UnmanagedCascableCoreBasicAPI::BasicFileTransferState::completed() {
+    CascableCoreBasicAPI::BasicFileTransferState value = CascableCoreBasicAPI::BasicFileTransferState::completed();
+    return UnmanagedCascableCoreBasicAPI::BasicFileTransferState(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState UnmanagedCascableCoreBasicAPI::BasicFileTransferState::failed() {
+    CascableCoreBasicAPI::BasicFileTransferState value = CascableCoreBasicAPI::BasicFileTransferState::failed();
+    return UnmanagedCascableCoreBasicAPI::BasicFileTransferState(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState UnmanagedCascableCoreBasicAPI::BasicFileTransferState::cancelled() {
+    CascableCoreBasicAPI::BasicFileTransferState value = CascableCoreBasicAPI::BasicFileTransferState::cancelled();
+    return UnmanagedCascableCoreBasicAPI::BasicFileTransferState(value);
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFileTransferState::operator==(const UnmanagedCascableCoreBasicAPI::BasicFileTransferState &other) const {
+    return (swiftObj() == other.swiftObj());
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFileTransferState::isInProgress() {
+    bool swiftResult = swiftObj().isInProgress();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFileTransferState::isCompleted() {
+    bool swiftResult = swiftObj().isCompleted();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFileTransferState::isFailed() {
+    bool swiftResult = swiftObj().isFailed();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFileTransferState::isCancelled() {
+    bool swiftResult = swiftObj().isCancelled();
+    return swiftResult;
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicFileTransferState> UnmanagedCascableCoreBasicAPI::BasicFileTransferState::initWithRawValue(unsigned int rawValue) {
+    swift::UInt arg0 = (swift::UInt)rawValue;
+    swift::Optional<CascableCoreBasicAPI::BasicFileTransferState> swiftResult = CascableCoreBasicAPI::BasicFileTransferState::init(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicFileTransferState unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicFileTransferState>(UnmanagedCascableCoreBasicAPI::BasicFileTransferState(unwrapped));
+    } else {
+        return std::nullopt;
+    }
+}
+
+unsigned int UnmanagedCascableCoreBasicAPI::BasicFileTransferState::getRawValue() {
+    swift::UInt swiftResult = swiftObj().getRawValue();
+    return (unsigned int)swiftResult;
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::BasicFolderListingFlags(const CascableCoreBasicAPI::BasicFolderListingFlags &value) {
+    static_assert(sizeof(CascableCoreBasicAPI::BasicFolderListingFlags) <= 1 && alignof(CascableCoreBasicAPI::BasicFolderListingFlags) <= 1, "Inline storage for BasicFolderListingFlags is too small. Regenerate the wrapper.");
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicFolderListingFlags(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::BasicFolderListingFlags(const UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &other) {
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicFolderListingFlags(other.swiftObj());
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::operator=(const UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &other) {
+    swiftObj() = other.swiftObj();
+    return *this;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::~BasicFolderListingFlags() {
+    swiftObj().~BasicFolderListingFlags();
+}
+
+const CascableCoreBasicAPI::BasicFolderListingFlags &UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::swiftObj() const {
+    return *reinterpret_cast<const CascableCoreBasicAPI::BasicFolderListingFlags *>(swiftObjStorage);
+}
+
+CascableCoreBasicAPI::BasicFolderListingFlags &UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::swiftObj() {
+    return *reinterpret_cast<CascableCoreBasicAPI::BasicFolderListingFlags *>(swiftObjStorage);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::folder() {
+    CascableCoreBasicAPI::BasicFolderListingFlags value = CascableCoreBasicAPI::BasicFolderListingFlags::folder();
+    return UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::image() {
+    CascableCoreBasicAPI::BasicFolderListingFlags value = CascableCoreBasicAPI::BasicFolderListingFlags::image();
+    return UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::video() {
+    CascableCoreBasicAPI::BasicFolderListingFlags value = CascableCoreBasicAPI::BasicFolderListingFlags::video();
+    return UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(value);
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::operator==(const UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &other) const {
+    return (swiftObj() == other.swiftObj());
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::isFolder() {
+    bool swiftResult = swiftObj().isFolder();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::isImage() {
+    bool swiftResult = swiftObj().isImage();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::isVideo() {
+    bool swiftResult = swiftObj().isVideo();
+    return swiftResult;
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags> UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::initWithRawValue(unsigned int rawValue) {
+    swift::UInt arg0 = (swift::UInt)rawValue;
+    swift::Optional<CascableCoreBasicAPI::BasicFolderListingFlags> swiftResult = CascableCoreBasicAPI::BasicFolderListingFlags::init(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicFolderListingFlags unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags>(UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags(unwrapped));
+    } else {
+        return std::nullopt;
+    }
+}
+
+unsigned int UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags::getRawValue() {
+    swift::UInt swiftResult = swiftObj().getRawValue();
+    return (unsigned int)swiftResult;
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::BasicCameraDiscoveryEventType(const CascableCoreBasicAPI::BasicCameraDiscoveryEventType &value) {
+    static_assert(sizeof(CascableCoreBasicAPI::BasicCameraDiscoveryEventType) <= 1 && alignof(CascableCoreBasicAPI::BasicCameraDiscoveryEventType) <= 1, "Inline storage for BasicCameraDiscoveryEventType is too small. Regenerate the wrapper.");
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicCameraDiscoveryEventType(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::BasicCameraDiscoveryEventType(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &other) {
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicCameraDiscoveryEventType(other.swiftObj());
+}
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::operator=(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &other) {
+    swiftObj() = other.swiftObj();
+    return *this;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::~BasicCameraDiscoveryEventType() {
+    swiftObj().~BasicCameraDiscoveryEventType();
+}
+
+const CascableCoreBasicAPI::BasicCameraDiscoveryEventType &UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::swiftObj() const {
+    return *reinterpret_cast<const CascableCoreBasicAPI::BasicCameraDiscoveryEventType *>(swiftObjStorage);
+}
+
+CascableCoreBasicAPI::BasicCameraDiscoveryEventType &UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::swiftObj() {
+    return *reinterpret_cast<CascableCoreBasicAPI::BasicCameraDiscoveryEventType *>(swiftObjStorage);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::appeared() {
+    CascableCoreBasicAPI::BasicCameraDiscoveryEventType value = CascableCoreBasicAPI::BasicCameraDiscoveryEventType::appeared();
+    return UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(value);
+}
 
-UnmanagedCascableCoreBasicAPI::BasicCamera::BasicCamera(std::shared_ptr<CascableCoreBasicAPI::BasicCamera> swiftObj) {
-    this->swiftObj = swiftObj;
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::lost() {
+    CascableCoreBasicAPI::BasicCameraDiscoveryEventType value = CascableCoreBasicAPI::BasicCameraDiscoveryEventType::lost();
+    return UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(value);
 }
 
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::metadataResolved() {
+    CascableCoreBasicAPI::BasicCameraDiscoveryEventType value = CascableCoreBasicAPI::BasicCameraDiscoveryEventType::metadataResolved();
+    return UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(value);
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::operator==(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &other) const {
+    return (swiftObj() == other.swiftObj());
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::isAppeared() {
+    bool swiftResult = swiftObj().isAppeared();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::isLost() {
+    bool swiftResult = swiftObj().isLost();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::isMetadataResolved() {
+    bool swiftResult = swiftObj().isMetadataResolved();
+    return swiftResult;
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType> UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::initWithRawValue(unsigned int rawValue) {
+    swift::UInt arg0 = (swift::UInt)rawValue;
+    swift::Optional<CascableCoreBasicAPI::BasicCameraDiscoveryEventType> swiftResult = CascableCoreBasicAPI::BasicCameraDiscoveryEventType::init(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicCameraDiscoveryEventType unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType>(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(unwrapped));
+    } else {
+        return std::nullopt;
+    }
+}
+
+unsigned int UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType::getRawValue() {
+    swift::UInt swiftResult = swiftObj().getRawValue();
+    return (unsigned int)swiftResult;
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::BasicPropertySetStatus(const CascableCoreBasicAPI::BasicPropertySetStatus &value) {
+    static_assert(sizeof(CascableCoreBasicAPI::BasicPropertySetStatus) <= 1 && alignof(CascableCoreBasicAPI::BasicPropertySetStatus) <= 1, "Inline storage for BasicPropertySetStatus is too small. Regenerate the wrapper.");
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicPropertySetStatus(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::BasicPropertySetStatus(const UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &other) {
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicPropertySetStatus(other.swiftObj());
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::operator=(const UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &other) {
+    swiftObj() = other.swiftObj();
+    return *this;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::~BasicPropertySetStatus() {
+    swiftObj().~BasicPropertySetStatus();
+}
+
+const CascableCoreBasicAPI::BasicPropertySetStatus &UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::swiftObj() const {
+    return *reinterpret_cast<const CascableCoreBasicAPI::BasicPropertySetStatus *>(swiftObjStorage);
+}
+
+CascableCoreBasicAPI::BasicPropertySetStatus &UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::swiftObj() {
+    return *reinterpret_cast<CascableCoreBasicAPI::BasicPropertySetStatus *>(swiftObjStorage);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::idle() {
+    CascableCoreBasicAPI::BasicPropertySetStatus value = CascableCoreBasicAPI::BasicPropertySetStatus::idle();
+    return UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::inProgress() {
+    CascableCoreBasicAPI::BasicPropertySetStatus value = CascableCoreBasicAPI::BasicPropertySetStatus::inProgress();
+    return UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::succeeded() {
+    CascableCoreBasicAPI::BasicPropertySetStatus value = CascableCoreBasicAPI::BasicPropertySetStatus::succeeded();
+    return UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::failed() {
+    CascableCoreBasicAPI::BasicPropertySetStatus value = CascableCoreBasicAPI::BasicPropertySetStatus::failed();
+    return UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(value);
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::operator==(const UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &other) const {
+    return (swiftObj() == other.swiftObj());
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::isIdle() {
+    bool swiftResult = swiftObj().isIdle();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::isInProgress() {
+    bool swiftResult = swiftObj().isInProgress();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::isSucceeded() {
+    bool swiftResult = swiftObj().isSucceeded();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::isFailed() {
+    bool swiftResult = swiftObj().isFailed();
+    return swiftResult;
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus> UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::initWithRawValue(unsigned int rawValue) {
+    swift::UInt arg0 = (swift::UInt)rawValue;
+    swift::Optional<CascableCoreBasicAPI::BasicPropertySetStatus> swiftResult = CascableCoreBasicAPI::BasicPropertySetStatus::init(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicPropertySetStatus unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus>(UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(unwrapped));
+    } else {
+        return std::nullopt;
+    }
+}
+
+unsigned int UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus::getRawValue() {
+    swift::UInt swiftResult = swiftObj().getRawValue();
+    return (unsigned int)swiftResult;
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicByteBuffer
+
+UnmanagedCascableCoreBasicAPI::BasicByteBuffer::BasicByteBuffer(std::shared_ptr<CascableCoreBasicAPI::BasicByteBuffer> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
+UnmanagedCascableCoreBasicAPI::BasicByteBuffer::~BasicByteBuffer() {}
+
+UnmanagedCascableCoreBasicAPI::ByteSpan UnmanagedCascableCoreBasicAPI::BasicByteBuffer::span() const {
+    return UnmanagedCascableCoreBasicAPI::ByteSpan { swiftObj->getBytes(), (size_t)swiftObj->getCount() };
+}
+
+const uint8_t * UnmanagedCascableCoreBasicAPI::BasicByteBuffer::getBytes() {
+    const uint8_t * swiftResult = swiftObj->getBytes();
+    return swiftResult;
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicByteBuffer::getCount() {
+    swift::Int swiftResult = swiftObj->getCount();
+    return (int)swiftResult;
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicCamera
+
+UnmanagedCascableCoreBasicAPI::BasicCamera::BasicCamera(std::shared_ptr<CascableCoreBasicAPI::BasicCamera> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
 UnmanagedCascableCoreBasicAPI::BasicCamera::~BasicCamera() {}
 
+int UnmanagedCascableCoreBasicAPI::BasicCamera::getHandle() {
+    swift::Int swiftResult = swiftObj->getHandle();
+    return (int)swiftResult;
+}
+
 std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicCamera::getFriendlyIdentifier() {
     swift::Optional<swift::String> swiftResult = swiftObj->getFriendlyIdentifier();
     if (swiftResult) {
@@ -388,10 +767,61 @@ void UnmanagedCascableCoreBasicAPI::BasicCamera::connect() {
     swiftObj->connect();
 }
 
+void UnmanagedCascableCoreBasicAPI::BasicCamera::connectWithCompletion(std::function<void(bool)> completion) {
+    std::function<void(bool)> *arg0 = new std::function<void(bool)>(std::move(completion));
+    void (*arg1)(void *, bool) = [](void *context, bool value0) {
+        const std::function<void(bool)> &function = *static_cast<std::function<void(bool)> *>(context);
+        // Exceptions can't unwind through Swift, so they have to stop here.
+        try {
+            if (function) { function(value0); }
+        } catch (...) {}
+    };
+    void (*arg2)(void *) = [](void *context) {
+        delete static_cast<std::function<void(bool)> *>(context);
+    };
+    swiftObj->connectWithCompletion(arg0, arg1, arg2);
+}
+
 void UnmanagedCascableCoreBasicAPI::BasicCamera::disconnect() {
     swiftObj->disconnect();
 }
 
+void UnmanagedCascableCoreBasicAPI::BasicCamera::disconnectWithCompletion(std::function<void(bool)> completion) {
+    std::function<void(bool)> *arg0 = new std::function<void(bool)>(std::move(completion));
+    void (*arg1)(void *, bool) = [](void *context, bool value0) {
+        const std::function<void(bool)> &function = *static_cast<std::function<void(bool)> *>(context);
+        // Exceptions can't unwind through Swift, so they have to stop here.
+        try {
+            if (function) { function(value0); }
+        } catch (...) {}
+    };
+    void (*arg2)(void *) = [](void *context) {
+        delete static_cast<std::function<void(bool)> *>(context);
+    };
+    swiftObj->disconnectWithCompletion(arg0, arg1, arg2);
+}
+
+std::vector<UnmanagedCascableCoreBasicAPI::BasicFileStorage> UnmanagedCascableCoreBasicAPI::BasicCamera::getStorageDevices() {
+    swift::Array<CascableCoreBasicAPI::BasicFileStorage> swiftResult = swiftObj->getStorageDevices();
+    std::vector<UnmanagedCascableCoreBasicAPI::BasicFileStorage> resultArray;
+    resultArray.reserve(swiftResult.getCount());
+    for (const auto &element : swiftResult) {
+        resultArray.emplace_back(UnmanagedCascableCoreBasicAPI::BasicFileStorage(std::make_shared<CascableCoreBasicAPI::BasicFileStorage>(element)));
+    }
+    return resultArray;
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem> UnmanagedCascableCoreBasicAPI::BasicCamera::fileSystemItem(const std::string & path) {
+    const swift::String & arg0 = (swift::String)path;
+    swift::Optional<CascableCoreBasicAPI::BasicFileSystemItem> swiftResult = swiftObj->fileSystemItem(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicFileSystemItem unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem>(UnmanagedCascableCoreBasicAPI::BasicFileSystemItem(std::make_shared<CascableCoreBasicAPI::BasicFileSystemItem>(unwrapped)));
+    } else {
+        return std::nullopt;
+    }
+}
+
 bool UnmanagedCascableCoreBasicAPI::BasicCamera::getAutoFocusEngaged() {
     bool swiftResult = swiftObj->getAutoFocusEngaged();
     return swiftResult;
@@ -423,8 +853,49 @@ void UnmanagedCascableCoreBasicAPI::BasicCamera::invokeOneShotShutterExplicitlyE
     swiftObj->invokeOneShotShutterExplicitlyEngagingAutoFocus(arg0);
 }
 
-std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> UnmanagedCascableCoreBasicAPI::BasicCamera::getLastReceivedPreview() {
-    swift::Optional<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> swiftResult = swiftObj->getLastReceivedPreview();
+int UnmanagedCascableCoreBasicAPI::BasicCamera::getReceivedTransferCapacity() {
+    swift::Int swiftResult = swiftObj->getReceivedTransferCapacity();
+    return (int)swiftResult;
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicCamera::setReceivedTransferCapacity(int newValue) {
+    swift::Int arg0 = (swift::Int)newValue;
+    swiftObj->setReceivedTransferCapacity(arg0);
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicCamera::getPendingTransferCount() {
+    swift::Int swiftResult = swiftObj->getPendingTransferCount();
+    return (int)swiftResult;
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicCamera::getReceivedTransferCount() {
+    swift::Int swiftResult = swiftObj->getReceivedTransferCount();
+    return (int)swiftResult;
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicCamera::getDroppedTransferCount() {
+    swift::Int swiftResult = swiftObj->getDroppedTransferCount();
+    return (int)swiftResult;
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicCamera::getFailedTransferCount() {
+    swift::Int swiftResult = swiftObj->getFailedTransferCount();
+    return (int)swiftResult;
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> UnmanagedCascableCoreBasicAPI::BasicCamera::dequeueTransfer() {
+    swift::Optional<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> swiftResult = swiftObj->dequeueTransfer();
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicCameraInitiatedTransferResult unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult>(UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(std::make_shared<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult>(unwrapped)));
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> UnmanagedCascableCoreBasicAPI::BasicCamera::waitForTransfer(double timeout) {
+    double arg0 = timeout;
+    swift::Optional<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> swiftResult = swiftObj->waitForTransfer(arg0);
     if (swiftResult) {
         CascableCoreBasicAPI::BasicCameraInitiatedTransferResult unwrapped = swiftResult.get();
         return std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult>(UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult(std::make_shared<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult>(unwrapped)));
@@ -433,9 +904,19 @@ std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult>
     }
 }
 
-void UnmanagedCascableCoreBasicAPI::BasicCamera::setLastReceivedPreview(const std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> & value) {
-    swift::Optional<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> arg0 = (value.has_value() ? swift::Optional<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult>::init(*value->swiftObj.get()) : swift::Optional<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult>::none());
-    swiftObj->setLastReceivedPreview(arg0);
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicCamera::getCameraInitiatedTransferDirectory() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getCameraInitiatedTransferDirectory();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicCamera::setCameraInitiatedTransferDirectory(const std::optional<std::string> & newValue) {
+    swift::Optional<swift::String> arg0 = (newValue.has_value() ? swift::Optional<swift::String>::init((swift::String)newValue.value()) : swift::Optional<swift::String>::none());
+    swiftObj->setCameraInitiatedTransferDirectory(arg0);
 }
 
 bool UnmanagedCascableCoreBasicAPI::BasicCamera::getHandleCameraInitiatedPreviews() {
@@ -472,31 +953,51 @@ std::optional<UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame> UnmanagedCascab
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicCamera::setLastLiveViewFrame(const std::optional<UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame> & value) {
-    swift::Optional<CascableCoreBasicAPI::BasicLiveViewFrame> arg0 = (value.has_value() ? swift::Optional<CascableCoreBasicAPI::BasicLiveViewFrame>::init(*value->swiftObj.get()) : swift::Optional<CascableCoreBasicAPI::BasicLiveViewFrame>::none());
+    swift::Optional<CascableCoreBasicAPI::BasicLiveViewFrame> arg0 = (value.has_value() ? swift::Optional<CascableCoreBasicAPI::BasicLiveViewFrame>::init(*value.value().swiftObj.get()) : swift::Optional<CascableCoreBasicAPI::BasicLiveViewFrame>::none());
     swiftObj->setLastLiveViewFrame(arg0);
 }
 
+void UnmanagedCascableCoreBasicAPI::BasicCamera::setLiveViewFrameCallback(std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> callback) {
+    std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> *arg0 = new std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)>(std::move(callback));
+    void (*arg1)(void *, void *) = [](void *context, void * value0) {
+        const std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> &function = *static_cast<std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> *>(context);
+        // Exceptions can't unwind through Swift, so they have to stop here.
+        try {
+            // Handles are adopted even if there's no function to pass them to, so their references are always released.
+            UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame object0 = UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame(std::make_shared<CascableCoreBasicAPI::BasicLiveViewFrame>(CascableCoreBasicAPI::_impl::_impl_BasicLiveViewFrame::makeRetained(value0)));
+            if (function) { function(std::move(object0)); }
+        } catch (...) {}
+    };
+    void (*arg2)(void *) = [](void *context) {
+        delete static_cast<std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> *>(context);
+    };
+    swiftObj->setLiveViewFrameCallback(arg0, arg1, arg2);
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicCamera::clearLiveViewFrameCallback() {
+    swiftObj->clearLiveViewFrameCallback();
+}
+
 std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier> UnmanagedCascableCoreBasicAPI::BasicCamera::getKnownPropertyIdentifiers() {
     swift::Array<CascableCoreBasicAPI::BasicPropertyIdentifier> swiftResult = swiftObj->getKnownPropertyIdentifiers();
     std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier> resultArray;
     resultArray.reserve(swiftResult.getCount());
-    for (auto element : swiftResult) {
-        resultArray.push_back(UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(element)));
+    for (const auto &element : swiftResult) {
+        resultArray.emplace_back(UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(element));
     }
     return resultArray;
 }
 
 UnmanagedCascableCoreBasicAPI::BasicCameraProperty UnmanagedCascableCoreBasicAPI::BasicCamera::property(const UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier & identifier) {
-    const CascableCoreBasicAPI::BasicPropertyIdentifier & arg0 = *identifier.swiftObj.get();
+    const CascableCoreBasicAPI::BasicPropertyIdentifier & arg0 = identifier.swiftObj();
     CascableCoreBasicAPI::BasicCameraProperty swiftResult = swiftObj->property(arg0);
     return UnmanagedCascableCoreBasicAPI::BasicCameraProperty(std::make_shared<CascableCoreBasicAPI::BasicCameraProperty>(swiftResult));
 }
 
 // Implementation of UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery
 
-UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::BasicCameraDiscovery(std::shared_ptr<CascableCoreBasicAPI::BasicCameraDiscovery> swiftObj) {
-    this->swiftObj = swiftObj;
-}
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::BasicCameraDiscovery(std::shared_ptr<CascableCoreBasicAPI::BasicCameraDiscovery> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
 
 UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::~BasicCameraDiscovery() {}
 
@@ -519,12 +1020,54 @@ std::vector<UnmanagedCascableCoreBasicAPI::BasicCamera> UnmanagedCascableCoreBas
     swift::Array<CascableCoreBasicAPI::BasicCamera> swiftResult = swiftObj->getVisibleCameras();
     std::vector<UnmanagedCascableCoreBasicAPI::BasicCamera> resultArray;
     resultArray.reserve(swiftResult.getCount());
-    for (auto element : swiftResult) {
-        resultArray.push_back(UnmanagedCascableCoreBasicAPI::BasicCamera(std::make_shared<CascableCoreBasicAPI::BasicCamera>(element)));
+    for (const auto &element : swiftResult) {
+        resultArray.emplace_back(UnmanagedCascableCoreBasicAPI::BasicCamera(std::make_shared<CascableCoreBasicAPI::BasicCamera>(element)));
     }
     return resultArray;
 }
 
+std::optional<UnmanagedCascableCoreBasicAPI::BasicCamera> UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::camera(int handle) {
+    swift::Int arg0 = (swift::Int)handle;
+    swift::Optional<CascableCoreBasicAPI::BasicCamera> swiftResult = swiftObj->camera(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicCamera unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicCamera>(UnmanagedCascableCoreBasicAPI::BasicCamera(std::make_shared<CascableCoreBasicAPI::BasicCamera>(unwrapped)));
+    } else {
+        return std::nullopt;
+    }
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::getPendingEventCount() {
+    swift::Int swiftResult = swiftObj->getPendingEventCount();
+    return (int)swiftResult;
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::getDroppedEventCount() {
+    swift::Int swiftResult = swiftObj->getDroppedEventCount();
+    return (int)swiftResult;
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent> UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::dequeueEvent() {
+    swift::Optional<CascableCoreBasicAPI::BasicCameraDiscoveryEvent> swiftResult = swiftObj->dequeueEvent();
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicCameraDiscoveryEvent unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent>(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent(std::make_shared<CascableCoreBasicAPI::BasicCameraDiscoveryEvent>(unwrapped)));
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent> UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::waitForEvent(double timeout) {
+    double arg0 = timeout;
+    swift::Optional<CascableCoreBasicAPI::BasicCameraDiscoveryEvent> swiftResult = swiftObj->waitForEvent(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicCameraDiscoveryEvent unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent>(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent(std::make_shared<CascableCoreBasicAPI::BasicCameraDiscoveryEvent>(unwrapped)));
+    } else {
+        return std::nullopt;
+    }
+}
+
 void UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::startDiscovery(const std::string & clientName) {
     const swift::String & arg0 = (swift::String)clientName;
     swiftObj->startDiscovery(arg0);
@@ -534,14 +1077,40 @@ void UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery::stopDiscovery() {
     swiftObj->stopDiscovery();
 }
 
-// Implementation of UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::BasicCameraDiscoveryEvent(std::shared_ptr<CascableCoreBasicAPI::BasicCameraDiscoveryEvent> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::~BasicCameraDiscoveryEvent() {}
+
+UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::getType() {
+    CascableCoreBasicAPI::BasicCameraDiscoveryEventType swiftResult = swiftObj->getType();
+    return UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType(swiftResult);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicCamera UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::getCamera() {
+    CascableCoreBasicAPI::BasicCamera swiftResult = swiftObj->getCamera();
+    return UnmanagedCascableCoreBasicAPI::BasicCamera(std::make_shared<CascableCoreBasicAPI::BasicCamera>(swiftResult));
+}
 
-UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::BasicCameraInitiatedTransferResult(std::shared_ptr<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> swiftObj) {
-    this->swiftObj = swiftObj;
+int UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent::getCameraHandle() {
+    swift::Int swiftResult = swiftObj->getCameraHandle();
+    return (int)swiftResult;
 }
 
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult
+
+UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::BasicCameraInitiatedTransferResult(std::shared_ptr<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
 UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::~BasicCameraInitiatedTransferResult() {}
 
+int UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getSequenceNumber() {
+    swift::Int swiftResult = swiftObj->getSequenceNumber();
+    return (int)swiftResult;
+}
+
 double UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getDateProduced() {
     double swiftResult = swiftObj->getDateProduced();
     return swiftResult;
@@ -582,27 +1151,41 @@ std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTr
     }
 }
 
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getLocalPath() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getLocalPath();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
+
 int UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getRawImageDataLength() {
     swift::Int swiftResult = swiftObj->getRawImageDataLength();
     return (int)swiftResult;
 }
 
-void UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::copyPixelData(uint8_t* pointer) {
-    uint8_t* arg0 = pointer;
+UnmanagedCascableCoreBasicAPI::BasicByteBuffer UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::getImageBuffer() {
+    CascableCoreBasicAPI::BasicByteBuffer swiftResult = swiftObj->getImageBuffer();
+    return UnmanagedCascableCoreBasicAPI::BasicByteBuffer(std::make_shared<CascableCoreBasicAPI::BasicByteBuffer>(swiftResult));
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult::copyPixelData(uint8_t * pointer) {
+    uint8_t * arg0 = pointer;
     swiftObj->copyPixelData(arg0);
 }
 
 // Implementation of UnmanagedCascableCoreBasicAPI::BasicCameraProperty
 
-UnmanagedCascableCoreBasicAPI::BasicCameraProperty::BasicCameraProperty(std::shared_ptr<CascableCoreBasicAPI::BasicCameraProperty> swiftObj) {
-    this->swiftObj = swiftObj;
-}
+UnmanagedCascableCoreBasicAPI::BasicCameraProperty::BasicCameraProperty(std::shared_ptr<CascableCoreBasicAPI::BasicCameraProperty> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
 
 UnmanagedCascableCoreBasicAPI::BasicCameraProperty::~BasicCameraProperty() {}
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier UnmanagedCascableCoreBasicAPI::BasicCameraProperty::getIdentifier() {
     CascableCoreBasicAPI::BasicPropertyIdentifier swiftResult = swiftObj->getIdentifier();
-    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(std::make_shared<CascableCoreBasicAPI::BasicPropertyIdentifier>(swiftResult));
+    return UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier(swiftResult);
 }
 
 std::optional<UnmanagedCascableCoreBasicAPI::BasicCamera> UnmanagedCascableCoreBasicAPI::BasicCameraProperty::getCamera() {
@@ -636,7 +1219,7 @@ std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> UnmanagedCascab
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicCameraProperty::setCurrentValue(const std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> & value) {
-    swift::Optional<CascableCoreBasicAPI::BasicPropertyValue> arg0 = (value.has_value() ? swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::init(*value->swiftObj.get()) : swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::none());
+    swift::Optional<CascableCoreBasicAPI::BasicPropertyValue> arg0 = (value.has_value() ? swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::init(*value.value().swiftObj.get()) : swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::none());
     swiftObj->setCurrentValue(arg0);
 }
 
@@ -651,7 +1234,7 @@ std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> UnmanagedCascab
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicCameraProperty::setPendingValue(const std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> & value) {
-    swift::Optional<CascableCoreBasicAPI::BasicPropertyValue> arg0 = (value.has_value() ? swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::init(*value->swiftObj.get()) : swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::none());
+    swift::Optional<CascableCoreBasicAPI::BasicPropertyValue> arg0 = (value.has_value() ? swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::init(*value.value().swiftObj.get()) : swift::Optional<CascableCoreBasicAPI::BasicPropertyValue>::none());
     swiftObj->setPendingValue(arg0);
 }
 
@@ -659,15 +1242,15 @@ std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> UnmanagedCascable
     swift::Array<CascableCoreBasicAPI::BasicPropertyValue> swiftResult = swiftObj->getValidSettableValues();
     std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> resultArray;
     resultArray.reserve(swiftResult.getCount());
-    for (auto element : swiftResult) {
-        resultArray.push_back(UnmanagedCascableCoreBasicAPI::BasicPropertyValue(std::make_shared<CascableCoreBasicAPI::BasicPropertyValue>(element)));
+    for (const auto &element : swiftResult) {
+        resultArray.emplace_back(UnmanagedCascableCoreBasicAPI::BasicPropertyValue(std::make_shared<CascableCoreBasicAPI::BasicPropertyValue>(element)));
     }
     return resultArray;
 }
 
-void UnmanagedCascableCoreBasicAPI::BasicCameraProperty::setValidSettableValues(std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> value) {
+void UnmanagedCascableCoreBasicAPI::BasicCameraProperty::setValidSettableValues(const std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> & value) {
     swift::Array<CascableCoreBasicAPI::BasicPropertyValue> arg0Array = swift::Array<CascableCoreBasicAPI::BasicPropertyValue>::init();
-    for (auto element: value) {
+    for (const auto &element : value) {
         arg0Array.append(*element.swiftObj.get());
     }
     swiftObj->setValidSettableValues(arg0Array);
@@ -678,12 +1261,47 @@ void UnmanagedCascableCoreBasicAPI::BasicCameraProperty::setValue(const Unmanage
     swiftObj->setValue(arg0);
 }
 
-// Implementation of UnmanagedCascableCoreBasicAPI::BasicDeviceInfo
+void UnmanagedCascableCoreBasicAPI::BasicCameraProperty::setValueWithCompletion(const UnmanagedCascableCoreBasicAPI::BasicPropertyValue & newValue, std::function<void(bool)> completion) {
+    std::function<void(bool)> *arg1 = new std::function<void(bool)>(std::move(completion));
+    void (*arg2)(void *, bool) = [](void *context, bool value0) {
+        const std::function<void(bool)> &function = *static_cast<std::function<void(bool)> *>(context);
+        // Exceptions can't unwind through Swift, so they have to stop here.
+        try {
+            if (function) { function(value0); }
+        } catch (...) {}
+    };
+    void (*arg3)(void *) = [](void *context) {
+        delete static_cast<std::function<void(bool)> *>(context);
+    };
+    const CascableCoreBasicAPI::BasicPropertyValue & arg0 = *newValue.swiftObj.get();
+    swiftObj->setValueWithCompletion(arg0, arg1, arg2, arg3);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus UnmanagedCascableCoreBasicAPI::BasicCameraProperty::getSetStatus() {
+    CascableCoreBasicAPI::BasicPropertySetStatus swiftResult = swiftObj->getSetStatus();
+    return UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus(swiftResult);
+}
+
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicCameraProperty::getLastSetErrorDescription() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getLastSetErrorDescription();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
 
-UnmanagedCascableCoreBasicAPI::BasicDeviceInfo::BasicDeviceInfo(std::shared_ptr<CascableCoreBasicAPI::BasicDeviceInfo> swiftObj) {
-    this->swiftObj = swiftObj;
+int UnmanagedCascableCoreBasicAPI::BasicCameraProperty::getCoalescedSetCount() {
+    swift::Int swiftResult = swiftObj->getCoalescedSetCount();
+    return (int)swiftResult;
 }
 
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicDeviceInfo
+
+UnmanagedCascableCoreBasicAPI::BasicDeviceInfo::BasicDeviceInfo(std::shared_ptr<CascableCoreBasicAPI::BasicDeviceInfo> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
 UnmanagedCascableCoreBasicAPI::BasicDeviceInfo::~BasicDeviceInfo() {}
 
 std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicDeviceInfo::getManufacturer() {
@@ -726,12 +1344,234 @@ std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicDeviceInfo::getSe
     }
 }
 
-// Implementation of UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicFileStorage
+
+UnmanagedCascableCoreBasicAPI::BasicFileStorage::BasicFileStorage(std::shared_ptr<CascableCoreBasicAPI::BasicFileStorage> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
+UnmanagedCascableCoreBasicAPI::BasicFileStorage::~BasicFileStorage() {}
+
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicFileStorage::getDisplayName() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getDisplayName();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
+
+int64_t UnmanagedCascableCoreBasicAPI::BasicFileStorage::getAvailableSpace() {
+    int64_t swiftResult = swiftObj->getAvailableSpace();
+    return swiftResult;
+}
+
+int64_t UnmanagedCascableCoreBasicAPI::BasicFileStorage::getCapacity() {
+    int64_t swiftResult = swiftObj->getCapacity();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFileStorage::getAllowsWrite() {
+    bool swiftResult = swiftObj->getAllowsWrite();
+    return swiftResult;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolder UnmanagedCascableCoreBasicAPI::BasicFileStorage::getRootFolder() {
+    CascableCoreBasicAPI::BasicFolder swiftResult = swiftObj->getRootFolder();
+    return UnmanagedCascableCoreBasicAPI::BasicFolder(std::make_shared<CascableCoreBasicAPI::BasicFolder>(swiftResult));
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicFileSystemItem
+
+UnmanagedCascableCoreBasicAPI::BasicFileSystemItem::BasicFileSystemItem(std::shared_ptr<CascableCoreBasicAPI::BasicFileSystemItem> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
+UnmanagedCascableCoreBasicAPI::BasicFileSystemItem::~BasicFileSystemItem() {}
+
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicFileSystemItem::getName() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getName();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
+
+int64_t UnmanagedCascableCoreBasicAPI::BasicFileSystemItem::getSize() {
+    int64_t swiftResult = swiftObj->getSize();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFileSystemItem::isFolder() {
+    bool swiftResult = swiftObj->isFolder();
+    return swiftResult;
+}
 
-UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::BasicLiveViewFrame(std::shared_ptr<CascableCoreBasicAPI::BasicLiveViewFrame> swiftObj) {
-    this->swiftObj = swiftObj;
+UnmanagedCascableCoreBasicAPI::BasicFileTransfer UnmanagedCascableCoreBasicAPI::BasicFileSystemItem::beginTransfer(const std::string & localPath, int64_t offset, int64_t length) {
+    const swift::String & arg0 = (swift::String)localPath;
+    int64_t arg1 = offset;
+    int64_t arg2 = length;
+    CascableCoreBasicAPI::BasicFileTransfer swiftResult = swiftObj->beginTransfer(arg0, arg1, arg2);
+    return UnmanagedCascableCoreBasicAPI::BasicFileTransfer(std::make_shared<CascableCoreBasicAPI::BasicFileTransfer>(swiftResult));
 }
 
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicFileTransfer
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransfer::BasicFileTransfer(std::shared_ptr<CascableCoreBasicAPI::BasicFileTransfer> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransfer::~BasicFileTransfer() {}
+
+std::string UnmanagedCascableCoreBasicAPI::BasicFileTransfer::getLocalPath() {
+    swift::String swiftResult = swiftObj->getLocalPath();
+    return (std::string)swiftResult;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFileTransferState UnmanagedCascableCoreBasicAPI::BasicFileTransfer::getState() {
+    CascableCoreBasicAPI::BasicFileTransferState swiftResult = swiftObj->getState();
+    return UnmanagedCascableCoreBasicAPI::BasicFileTransferState(swiftResult);
+}
+
+int64_t UnmanagedCascableCoreBasicAPI::BasicFileTransfer::getTotalFileSize() {
+    int64_t swiftResult = swiftObj->getTotalFileSize();
+    return swiftResult;
+}
+
+int64_t UnmanagedCascableCoreBasicAPI::BasicFileTransfer::getRangeStart() {
+    int64_t swiftResult = swiftObj->getRangeStart();
+    return swiftResult;
+}
+
+int64_t UnmanagedCascableCoreBasicAPI::BasicFileTransfer::getRangeLength() {
+    int64_t swiftResult = swiftObj->getRangeLength();
+    return swiftResult;
+}
+
+int64_t UnmanagedCascableCoreBasicAPI::BasicFileTransfer::getBytesTransferred() {
+    int64_t swiftResult = swiftObj->getBytesTransferred();
+    return swiftResult;
+}
+
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicFileTransfer::getErrorDescription() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getErrorDescription();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicFileTransfer::cancel() {
+    swiftObj->cancel();
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicFolder
+
+UnmanagedCascableCoreBasicAPI::BasicFolder::BasicFolder(std::shared_ptr<CascableCoreBasicAPI::BasicFolder> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
+UnmanagedCascableCoreBasicAPI::BasicFolder::~BasicFolder() {}
+
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicFolder::getName() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getName();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFolder::getChildrenLoaded() {
+    bool swiftResult = swiftObj->getChildrenLoaded();
+    return swiftResult;
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicFolder::getChildrenLoading() {
+    bool swiftResult = swiftObj->getChildrenLoading();
+    return swiftResult;
+}
+
+std::optional<std::string> UnmanagedCascableCoreBasicAPI::BasicFolder::getLoadChildrenErrorDescription() {
+    swift::Optional<swift::String> swiftResult = swiftObj->getLoadChildrenErrorDescription();
+    if (swiftResult) {
+        swift::String unwrapped = swiftResult.get();
+        return std::optional<std::string>((std::string)unwrapped);
+    } else {
+        return std::nullopt;
+    }
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicFolder::loadChildren() {
+    swiftObj->loadChildren();
+}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListing UnmanagedCascableCoreBasicAPI::BasicFolder::listing() {
+    CascableCoreBasicAPI::BasicFolderListing swiftResult = swiftObj->listing();
+    return UnmanagedCascableCoreBasicAPI::BasicFolderListing(std::make_shared<CascableCoreBasicAPI::BasicFolderListing>(swiftResult));
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicFolderListing
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListing::BasicFolderListing(std::shared_ptr<CascableCoreBasicAPI::BasicFolderListing> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
+UnmanagedCascableCoreBasicAPI::BasicFolderListing::~BasicFolderListing() {}
+
+int UnmanagedCascableCoreBasicAPI::BasicFolderListing::getRecordStride() {
+    swift::Int swiftResult = swiftObj->getRecordStride();
+    return (int)swiftResult;
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicFolderListing::getCount() {
+    swift::Int swiftResult = swiftObj->getCount();
+    return (int)swiftResult;
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicFolderListing::getRecordBufferLength() {
+    swift::Int swiftResult = swiftObj->getRecordBufferLength();
+    return (int)swiftResult;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicByteBuffer UnmanagedCascableCoreBasicAPI::BasicFolderListing::getRecordBuffer() {
+    CascableCoreBasicAPI::BasicByteBuffer swiftResult = swiftObj->getRecordBuffer();
+    return UnmanagedCascableCoreBasicAPI::BasicByteBuffer(std::make_shared<CascableCoreBasicAPI::BasicByteBuffer>(swiftResult));
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicFolderListing::copyRecords(uint8_t * pointer) {
+    uint8_t * arg0 = pointer;
+    swiftObj->copyRecords(arg0);
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem> UnmanagedCascableCoreBasicAPI::BasicFolderListing::item(int handle) {
+    swift::Int arg0 = (swift::Int)handle;
+    swift::Optional<CascableCoreBasicAPI::BasicFileSystemItem> swiftResult = swiftObj->item(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicFileSystemItem unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem>(UnmanagedCascableCoreBasicAPI::BasicFileSystemItem(std::make_shared<CascableCoreBasicAPI::BasicFileSystemItem>(unwrapped)));
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<UnmanagedCascableCoreBasicAPI::BasicFolder> UnmanagedCascableCoreBasicAPI::BasicFolderListing::folder(int handle) {
+    swift::Int arg0 = (swift::Int)handle;
+    swift::Optional<CascableCoreBasicAPI::BasicFolder> swiftResult = swiftObj->folder(arg0);
+    if (swiftResult) {
+        CascableCoreBasicAPI::BasicFolder unwrapped = swiftResult.get();
+        return std::optional<UnmanagedCascableCoreBasicAPI::BasicFolder>(UnmanagedCascableCoreBasicAPI::BasicFolder(std::make_shared<CascableCoreBasicAPI::BasicFolder>(unwrapped)));
+    } else {
+        return std::nullopt;
+    }
+}
+
+// Implementation of UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame
+
+UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::BasicLiveViewFrame(std::shared_ptr<CascableCoreBasicAPI::BasicLiveViewFrame> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
+
 UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::~BasicLiveViewFrame() {}
 
 double UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::getDateProduced() {
@@ -744,21 +1584,25 @@ int UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::getRawPixelDataLength() {
     return (int)swiftResult;
 }
 
-void UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::copyPixelData(uint8_t* pointer) {
-    uint8_t* arg0 = pointer;
+void UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::copyPixelData(uint8_t * pointer) {
+    uint8_t * arg0 = pointer;
     swiftObj->copyPixelData(arg0);
 }
 
+UnmanagedCascableCoreBasicAPI::BasicByteBuffer UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::getRawPixelBuffer() {
+    CascableCoreBasicAPI::BasicByteBuffer swiftResult = swiftObj->getRawPixelBuffer();
+    return UnmanagedCascableCoreBasicAPI::BasicByteBuffer(std::make_shared<CascableCoreBasicAPI::BasicByteBuffer>(swiftResult));
+}
+
 UnmanagedCascableCoreBasicAPI::BasicSize UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame::getRawPixelSize() {
     CascableCoreBasicAPI::BasicSize swiftResult = swiftObj->getRawPixelSize();
-    return UnmanagedCascableCoreBasicAPI::BasicSize(std::make_shared<CascableCoreBasicAPI::BasicSize>(swiftResult));
+    return UnmanagedCascableCoreBasicAPI::BasicSize(swiftResult);
 }
 
 // Implementation of UnmanagedCascableCoreBasicAPI::BasicPropertyValue
 
-UnmanagedCascableCoreBasicAPI::BasicPropertyValue::BasicPropertyValue(std::shared_ptr<CascableCoreBasicAPI::BasicPropertyValue> swiftObj) {
-    this->swiftObj = swiftObj;
-}
+UnmanagedCascableCoreBasicAPI::BasicPropertyValue::BasicPropertyValue(std::shared_ptr<CascableCoreBasicAPI::BasicPropertyValue> swiftObj)
+    : swiftObj(std::move(swiftObj)) {}
 
 UnmanagedCascableCoreBasicAPI::BasicPropertyValue::~BasicPropertyValue() {}
 
@@ -779,76 +1623,176 @@ std::string UnmanagedCascableCoreBasicAPI::BasicPropertyValue::getStringValue()
 
 // Implementation of UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration
 
-UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::BasicSimulatedCameraConfiguration(std::shared_ptr<CascableCoreBasicAPI::BasicSimulatedCameraConfiguration> swiftObj) {
-    this->swiftObj = swiftObj;
+UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::BasicSimulatedCameraConfiguration(const CascableCoreBasicAPI::BasicSimulatedCameraConfiguration &value) {
+    static_assert(sizeof(CascableCoreBasicAPI::BasicSimulatedCameraConfiguration) <= 112 && alignof(CascableCoreBasicAPI::BasicSimulatedCameraConfiguration) <= 8, "Inline storage for BasicSimulatedCameraConfiguration is too small. Regenerate the wrapper.");
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicSimulatedCameraConfiguration(value);
 }
 
-UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::~BasicSimulatedCameraConfiguration() {}
+UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::BasicSimulatedCameraConfiguration(const UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration &other) {
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicSimulatedCameraConfiguration(other.swiftObj());
+}
+
+UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration &UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::operator=(const UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration &other) {
+    swiftObj() = other.swiftObj();
+    return *this;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::~BasicSimulatedCameraConfiguration() {
+    swiftObj().~BasicSimulatedCameraConfiguration();
+}
+
+const CascableCoreBasicAPI::BasicSimulatedCameraConfiguration &UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::swiftObj() const {
+    return *reinterpret_cast<const CascableCoreBasicAPI::BasicSimulatedCameraConfiguration *>(swiftObjStorage);
+}
+
+CascableCoreBasicAPI::BasicSimulatedCameraConfiguration &UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::swiftObj() {
+    return *reinterpret_cast<CascableCoreBasicAPI::BasicSimulatedCameraConfiguration *>(swiftObjStorage);
+}
 
 UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::defaultConfiguration() {
     CascableCoreBasicAPI::BasicSimulatedCameraConfiguration swiftResult = CascableCoreBasicAPI::BasicSimulatedCameraConfiguration::defaultConfiguration();
-    return UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration(std::make_shared<CascableCoreBasicAPI::BasicSimulatedCameraConfiguration>(swiftResult));
+    return UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration(swiftResult);
 }
 
 std::string UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getManufacturer() {
-    swift::String swiftResult = swiftObj->getManufacturer();
+    swift::String swiftResult = swiftObj().getManufacturer();
     return (std::string)swiftResult;
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setManufacturer(const std::string & value) {
     const swift::String & arg0 = (swift::String)value;
-    swiftObj->setManufacturer(arg0);
+    swiftObj().setManufacturer(arg0);
 }
 
 std::string UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getModel() {
-    swift::String swiftResult = swiftObj->getModel();
+    swift::String swiftResult = swiftObj().getModel();
     return (std::string)swiftResult;
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setModel(const std::string & value) {
     const swift::String & arg0 = (swift::String)value;
-    swiftObj->setModel(arg0);
+    swiftObj().setModel(arg0);
 }
 
 std::string UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getIdentifier() {
-    swift::String swiftResult = swiftObj->getIdentifier();
+    swift::String swiftResult = swiftObj().getIdentifier();
     return (std::string)swiftResult;
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setIdentifier(const std::string & value) {
     const swift::String & arg0 = (swift::String)value;
-    swiftObj->setIdentifier(arg0);
+    swiftObj().setIdentifier(arg0);
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getCameraCount() {
+    swift::Int swiftResult = swiftObj().getCameraCount();
+    return (int)swiftResult;
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setCameraCount(int value) {
+    swift::Int arg0 = (swift::Int)value;
+    swiftObj().setCameraCount(arg0);
 }
 
 std::string UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getLiveViewImageContainerPath() {
-    swift::String swiftResult = swiftObj->getLiveViewImageContainerPath();
+    swift::String swiftResult = swiftObj().getLiveViewImageContainerPath();
     return (std::string)swiftResult;
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setLiveViewImageContainerPath(const std::string & value) {
     const swift::String & arg0 = (swift::String)value;
-    swiftObj->setLiveViewImageContainerPath(arg0);
+    swiftObj().setLiveViewImageContainerPath(arg0);
+}
+
+double UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getBurstFramesPerSecond() {
+    double swiftResult = swiftObj().getBurstFramesPerSecond();
+    return swiftResult;
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setBurstFramesPerSecond(double value) {
+    double arg0 = value;
+    swiftObj().setBurstFramesPerSecond(arg0);
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getBurstLength() {
+    swift::Int swiftResult = swiftObj().getBurstLength();
+    return (int)swiftResult;
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setBurstLength(int value) {
+    swift::Int arg0 = (swift::Int)value;
+    swiftObj().setBurstLength(arg0);
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getSyntheticOriginalByteCount() {
+    swift::Int swiftResult = swiftObj().getSyntheticOriginalByteCount();
+    return (int)swiftResult;
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setSyntheticOriginalByteCount(int value) {
+    swift::Int arg0 = (swift::Int)value;
+    swiftObj().setSyntheticOriginalByteCount(arg0);
+}
+
+bool UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getDeliversLiveViewOnSeparateLane() {
+    bool swiftResult = swiftObj().getDeliversLiveViewOnSeparateLane();
+    return swiftResult;
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setDeliversLiveViewOnSeparateLane(bool value) {
+    bool arg0 = value;
+    swiftObj().setDeliversLiveViewOnSeparateLane(arg0);
+}
+
+int UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::getWorkerQueueCount() {
+    swift::Int swiftResult = swiftObj().getWorkerQueueCount();
+    return (int)swiftResult;
+}
+
+void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::setWorkerQueueCount(int value) {
+    swift::Int arg0 = (swift::Int)value;
+    swiftObj().setWorkerQueueCount(arg0);
 }
 
 void UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration::apply() {
-    swiftObj->apply();
+    swiftObj().apply();
 }
 
 // Implementation of UnmanagedCascableCoreBasicAPI::BasicSize
 
-UnmanagedCascableCoreBasicAPI::BasicSize::BasicSize(std::shared_ptr<CascableCoreBasicAPI::BasicSize> swiftObj) {
-    this->swiftObj = swiftObj;
+UnmanagedCascableCoreBasicAPI::BasicSize::BasicSize(const CascableCoreBasicAPI::BasicSize &value) {
+    static_assert(sizeof(CascableCoreBasicAPI::BasicSize) <= 16 && alignof(CascableCoreBasicAPI::BasicSize) <= 8, "Inline storage for BasicSize is too small. Regenerate the wrapper.");
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicSize(value);
+}
+
+UnmanagedCascableCoreBasicAPI::BasicSize::BasicSize(const UnmanagedCascableCoreBasicAPI::BasicSize &other) {
+    new (swiftObjStorage) CascableCoreBasicAPI::BasicSize(other.swiftObj());
 }
 
-UnmanagedCascableCoreBasicAPI::BasicSize::~BasicSize() {}
+UnmanagedCascableCoreBasicAPI::BasicSize &UnmanagedCascableCoreBasicAPI::BasicSize::operator=(const UnmanagedCascableCoreBasicAPI::BasicSize &other) {
+    swiftObj() = other.swiftObj();
+    return *this;
+}
+
+UnmanagedCascableCoreBasicAPI::BasicSize::~BasicSize() {
+    swiftObj().~BasicSize();
+}
+
+const CascableCoreBasicAPI::BasicSize &UnmanagedCascableCoreBasicAPI::BasicSize::swiftObj() const {
+    return *reinterpret_cast<const CascableCoreBasicAPI::BasicSize *>(swiftObjStorage);
+}
+
+CascableCoreBasicAPI::BasicSize &UnmanagedCascableCoreBasicAPI::BasicSize::swiftObj() {
+    return *reinterpret_cast<CascableCoreBasicAPI::BasicSize *>(swiftObjStorage);
+}
 
 double UnmanagedCascableCoreBasicAPI::BasicSize::getWidth() {
-    double swiftResult = swiftObj->getWidth();
+    double swiftResult = swiftObj().getWidth();
     return swiftResult;
 }
 
 double UnmanagedCascableCoreBasicAPI::BasicSize::getHeight() {
-    double swiftResult = swiftObj->getHeight();
+    double swiftResult = swiftObj().getHeight();
     return swiftResult;
 }
 
@@ -2,18 +2,40 @@
 
 #ifndef UnmanagedCascableCoreBasicAPI_hpp
 #define UnmanagedCascableCoreBasicAPI_hpp
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <optional>
 #include <vector>
 
+// Completion-handler methods get awaitable versions when compiling as C++20 or later.
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define UnmanagedCascableCoreBasicAPI_HAS_COROUTINES 1
+#else
+#define UnmanagedCascableCoreBasicAPI_HAS_COROUTINES 0
+#endif
+
 namespace CascableCoreBasicAPI {
     class BasicPropertyIdentifier;
+    class BasicFileTransferState;
+    class BasicFolderListingFlags;
+    class BasicCameraDiscoveryEventType;
+    class BasicPropertySetStatus;
+    class BasicByteBuffer;
     class BasicCamera;
     class BasicCameraDiscovery;
+    class BasicCameraDiscoveryEvent;
     class BasicCameraInitiatedTransferResult;
     class BasicCameraProperty;
     class BasicDeviceInfo;
+    class BasicFileStorage;
+    class BasicFileSystemItem;
+    class BasicFileTransfer;
+    class BasicFolder;
+    class BasicFolderListing;
     class BasicLiveViewFrame;
     class BasicPropertyValue;
     class BasicSimulatedCameraConfiguration;
@@ -23,23 +45,113 @@ namespace CascableCoreBasicAPI {
 namespace UnmanagedCascableCoreBasicAPI {
 
     class BasicPropertyIdentifier;
+    class BasicFileTransferState;
+    class BasicFolderListingFlags;
+    class BasicCameraDiscoveryEventType;
+    class BasicPropertySetStatus;
+    class BasicByteBuffer;
     class BasicCamera;
     class BasicCameraDiscovery;
+    class BasicCameraDiscoveryEvent;
     class BasicCameraInitiatedTransferResult;
     class BasicCameraProperty;
     class BasicDeviceInfo;
+    class BasicFileStorage;
+    class BasicFileSystemItem;
+    class BasicFileTransfer;
+    class BasicFolder;
+    class BasicFolderListing;
     class BasicLiveViewFrame;
     class BasicPropertyValue;
     class BasicSimulatedCameraConfiguration;
     class BasicSize;
 
+    struct ByteSpan {
+        const uint8_t *data;
+        size_t size;
+    
+        const uint8_t *begin() const { return data; }
+        const uint8_t *end() const { return data + size; }
+        bool empty() const { return size == 0; }
+    };
+
+#if UnmanagedCascableCoreBasicAPI_HAS_COROUTINES
+    // Resumes a coroutine awaiting a completion, on whichever thread it chooses.
+    using CompletionExecutor = std::function<void(std::coroutine_handle<>)>;
+
+    template <typename Result>
+    class CompletionAwaitable {
+    public:
+        using Completion = std::function<void(Result)>;
+        explicit CompletionAwaitable(std::function<void(Completion)> start) : start(std::move(start)) {}
+
+        // Returns the awaitable with the awaiting coroutine resumed by the given executor, rather than inline on
+        // the thread the completion is called on.
+        CompletionAwaitable resumingOn(CompletionExecutor executor) && {
+            this->executor = std::move(executor);
+            return std::move(*this);
+        }
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            // Once started, the coroutine may be resumed and this awaitable destroyed before we return, so we
+            // mustn't touch our members after that.
+            std::function<void(Completion)> starter = std::move(start);
+            starter([this, handle, executor = std::move(executor)](Result value) {
+                result.emplace(std::move(value));
+                if (executor) { executor(handle); } else { handle.resume(); }
+            });
+        }
+
+        Result await_resume() { return std::move(*result); }
+
+    private:
+        std::function<void(Completion)> start;
+        CompletionExecutor executor;
+        std::optional<Result> result;
+    };
+
+    template <>
+    class CompletionAwaitable<void> {
+    public:
+        using Completion = std::function<void()>;
+        explicit CompletionAwaitable(std::function<void(Completion)> start) : start(std::move(start)) {}
+
+        CompletionAwaitable resumingOn(CompletionExecutor executor) && {
+            this->executor = std::move(executor);
+            return std::move(*this);
+        }
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            std::function<void(Completion)> starter = std::move(start);
+            starter([handle, executor = std::move(executor)]() {
+                if (executor) { executor(handle); } else { handle.resume(); }
+            });
+        }
+
+        void await_resume() {}
+
+    private:
+        std::function<void(Completion)> start;
+        CompletionExecutor executor;
+    };
+#endif
+
     class BasicPropertyIdentifier {
     private:
+        alignas(1) unsigned char swiftObjStorage[1];
     public:
-        std::shared_ptr<CascableCoreBasicAPI::BasicPropertyIdentifier> swiftObj;
-        BasicPropertyIdentifier(std::shared_ptr<CascableCoreBasicAPI::BasicPropertyIdentifier> swiftObj);
+        BasicPropertyIdentifier(const CascableCoreBasicAPI::BasicPropertyIdentifier &value);
+        BasicPropertyIdentifier(const UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier &other);
+        UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier &operator=(const UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier &other);
         ~BasicPropertyIdentifier();
     
+        const CascableCoreBasicAPI::BasicPropertyIdentifier &swiftObj() const;
+        CascableCoreBasicAPI::BasicPropertyIdentifier &swiftObj();
+    
         static std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier> initWithRawValue(unsigned int rawValue);
     
         static UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier isoSpeed();
@@ -110,19 +222,154 @@ namespace UnmanagedCascableCoreBasicAPI {
         unsigned int getRawValue();
     };
 
+    class BasicFileTransferState {
+    private:
+        alignas(1) unsigned char swiftObjStorage[1];
+    public:
+        BasicFileTransferState(const CascableCoreBasicAPI::BasicFileTransferState &value);
+        BasicFileTransferState(const UnmanagedCascableCoreBasicAPI::BasicFileTransferState &other);
+        UnmanagedCascableCoreBasicAPI::BasicFileTransferState &operator=(const UnmanagedCascableCoreBasicAPI::BasicFileTransferState &other);
+        ~BasicFileTransferState();
+    
+        const CascableCoreBasicAPI::BasicFileTransferState &swiftObj() const;
+        CascableCoreBasicAPI::BasicFileTransferState &swiftObj();
+    
+        static std::optional<UnmanagedCascableCoreBasicAPI::BasicFileTransferState> initWithRawValue(unsigned int rawValue);
+    
+        static UnmanagedCascableCoreBasicAPI::BasicFileTransferState inProgress();
+        static UnmanagedCascableCoreBasicAPI::BasicFileTransferState completed();
+        static UnmanagedCascableCoreBasicAPI::BasicFileTransferState failed();
+        static UnmanagedCascableCoreBasicAPI::BasicFileTransferState cancelled();
+    
+        bool operator==(const UnmanagedCascableCoreBasicAPI::BasicFileTransferState &other) const;
+    
+        bool isInProgress();
+        bool isCompleted();
+        bool isFailed();
+        bool isCancelled();
+        unsigned int getRawValue();
+    };
+
+    class BasicFolderListingFlags {
+    private:
+        alignas(1) unsigned char swiftObjStorage[1];
+    public:
+        BasicFolderListingFlags(const CascableCoreBasicAPI::BasicFolderListingFlags &value);
+        BasicFolderListingFlags(const UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &other);
+        UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &operator=(const UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &other);
+        ~BasicFolderListingFlags();
+    
+        const CascableCoreBasicAPI::BasicFolderListingFlags &swiftObj() const;
+        CascableCoreBasicAPI::BasicFolderListingFlags &swiftObj();
+    
+        static std::optional<UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags> initWithRawValue(unsigned int rawValue);
+    
+        static UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags folder();
+        static UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags image();
+        static UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags video();
+    
+        bool operator==(const UnmanagedCascableCoreBasicAPI::BasicFolderListingFlags &other) const;
+    
+        bool isFolder();
+        bool isImage();
+        bool isVideo();
+        unsigned int getRawValue();
+    };
+
+    class BasicCameraDiscoveryEventType {
+    private:
+        alignas(1) unsigned char swiftObjStorage[1];
+    public:
+        BasicCameraDiscoveryEventType(const CascableCoreBasicAPI::BasicCameraDiscoveryEventType &value);
+        BasicCameraDiscoveryEventType(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &other);
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &operator=(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &other);
+        ~BasicCameraDiscoveryEventType();
+    
+        const CascableCoreBasicAPI::BasicCameraDiscoveryEventType &swiftObj() const;
+        CascableCoreBasicAPI::BasicCameraDiscoveryEventType &swiftObj();
+    
+        static std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType> initWithRawValue(unsigned int rawValue);
+    
+        static UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType appeared();
+        static UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType lost();
+        static UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType metadataResolved();
+    
+        bool operator==(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType &other) const;
+    
+        bool isAppeared();
+        bool isLost();
+        bool isMetadataResolved();
+        unsigned int getRawValue();
+    };
+
+    class BasicPropertySetStatus {
+    private:
+        alignas(1) unsigned char swiftObjStorage[1];
+    public:
+        BasicPropertySetStatus(const CascableCoreBasicAPI::BasicPropertySetStatus &value);
+        BasicPropertySetStatus(const UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &other);
+        UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &operator=(const UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &other);
+        ~BasicPropertySetStatus();
+    
+        const CascableCoreBasicAPI::BasicPropertySetStatus &swiftObj() const;
+        CascableCoreBasicAPI::BasicPropertySetStatus &swiftObj();
+    
+        static std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus> initWithRawValue(unsigned int rawValue);
+    
+        static UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus idle();
+        static UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus inProgress();
+        static UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus succeeded();
+        static UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus failed();
+    
+        bool operator==(const UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus &other) const;
+    
+        bool isIdle();
+        bool isInProgress();
+        bool isSucceeded();
+        bool isFailed();
+        unsigned int getRawValue();
+    };
+
+    class BasicByteBuffer {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicByteBuffer> swiftObj;
+        BasicByteBuffer(std::shared_ptr<CascableCoreBasicAPI::BasicByteBuffer> swiftObj);
+        BasicByteBuffer(const UnmanagedCascableCoreBasicAPI::BasicByteBuffer &other) = default;
+        BasicByteBuffer(UnmanagedCascableCoreBasicAPI::BasicByteBuffer &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicByteBuffer &operator=(const UnmanagedCascableCoreBasicAPI::BasicByteBuffer &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicByteBuffer &operator=(UnmanagedCascableCoreBasicAPI::BasicByteBuffer &&other) noexcept = default;
+        ~BasicByteBuffer();
+    
+        // The span is valid for as long as this object, or any copy of it, exists.
+        UnmanagedCascableCoreBasicAPI::ByteSpan span() const;
+    
+        const uint8_t * getBytes();
+        int getCount();
+    };
+
     class BasicCamera {
     private:
     public:
         std::shared_ptr<CascableCoreBasicAPI::BasicCamera> swiftObj;
         BasicCamera(std::shared_ptr<CascableCoreBasicAPI::BasicCamera> swiftObj);
+        BasicCamera(const UnmanagedCascableCoreBasicAPI::BasicCamera &other) = default;
+        BasicCamera(UnmanagedCascableCoreBasicAPI::BasicCamera &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicCamera &operator=(const UnmanagedCascableCoreBasicAPI::BasicCamera &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicCamera &operator=(UnmanagedCascableCoreBasicAPI::BasicCamera &&other) noexcept = default;
         ~BasicCamera();
     
+        int getHandle();
         std::optional<std::string> getFriendlyIdentifier();
         bool getConnected();
         std::optional<UnmanagedCascableCoreBasicAPI::BasicDeviceInfo> getDeviceInfo();
         std::optional<std::string> getFriendlyDisplayName();
         void connect();
+        void connectWithCompletion(std::function<void(bool)> completion);
         void disconnect();
+        void disconnectWithCompletion(std::function<void(bool)> completion);
+        std::vector<UnmanagedCascableCoreBasicAPI::BasicFileStorage> getStorageDevices();
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem> fileSystemItem(const std::string & path);
         bool getAutoFocusEngaged();
         void engageAutoFocus();
         void disengageAutoFocus();
@@ -130,8 +377,16 @@ namespace UnmanagedCascableCoreBasicAPI {
         void engageShutter();
         void disengageShutter();
         void invokeOneShotShutterExplicitlyEngagingAutoFocus(bool triggerAutoFocus);
-        std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> getLastReceivedPreview();
-        void setLastReceivedPreview(const std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> & value);
+        int getReceivedTransferCapacity();
+        void setReceivedTransferCapacity(int newValue);
+        int getPendingTransferCount();
+        int getReceivedTransferCount();
+        int getDroppedTransferCount();
+        int getFailedTransferCount();
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> dequeueTransfer();
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult> waitForTransfer(double timeout);
+        std::optional<std::string> getCameraInitiatedTransferDirectory();
+        void setCameraInitiatedTransferDirectory(const std::optional<std::string> & newValue);
         bool getHandleCameraInitiatedPreviews();
         void setHandleCameraInitiatedPreviews(bool newValue);
         void beginLiveViewStream();
@@ -139,8 +394,25 @@ namespace UnmanagedCascableCoreBasicAPI {
         bool getLiveViewStreamActive();
         std::optional<UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame> getLastLiveViewFrame();
         void setLastLiveViewFrame(const std::optional<UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame> & value);
+        void setLiveViewFrameCallback(std::function<void(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame)> callback);
+        void clearLiveViewFrameCallback();
         std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier> getKnownPropertyIdentifiers();
         UnmanagedCascableCoreBasicAPI::BasicCameraProperty property(const UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier & identifier);
+    
+#if UnmanagedCascableCoreBasicAPI_HAS_COROUTINES
+        // Awaitable versions of the methods taking a completion. The awaiting coroutine is resumed on the thread
+        // the completion is called on, unless the awaitable is given an executor with resumingOn().
+        UnmanagedCascableCoreBasicAPI::CompletionAwaitable<bool> connectAsync() {
+            return UnmanagedCascableCoreBasicAPI::CompletionAwaitable<bool>([self = *this](std::function<void(bool)> completion) mutable {
+                self.connectWithCompletion(std::move(completion));
+            });
+        }
+        UnmanagedCascableCoreBasicAPI::CompletionAwaitable<bool> disconnectAsync() {
+            return UnmanagedCascableCoreBasicAPI::CompletionAwaitable<bool>([self = *this](std::function<void(bool)> completion) mutable {
+                self.disconnectWithCompletion(std::move(completion));
+            });
+        }
+#endif
     };
 
     class BasicCameraDiscovery {
@@ -148,30 +420,62 @@ namespace UnmanagedCascableCoreBasicAPI {
     public:
         std::shared_ptr<CascableCoreBasicAPI::BasicCameraDiscovery> swiftObj;
         BasicCameraDiscovery(std::shared_ptr<CascableCoreBasicAPI::BasicCameraDiscovery> swiftObj);
+        BasicCameraDiscovery(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery &other) = default;
+        BasicCameraDiscovery(UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery &operator=(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery &operator=(UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery &&other) noexcept = default;
         ~BasicCameraDiscovery();
     
         static UnmanagedCascableCoreBasicAPI::BasicCameraDiscovery sharedInstance();
         bool getDiscoveryRunning();
         void setDiscoveryRunning(bool value);
         std::vector<UnmanagedCascableCoreBasicAPI::BasicCamera> getVisibleCameras();
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicCamera> camera(int handle);
+        int getPendingEventCount();
+        int getDroppedEventCount();
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent> dequeueEvent();
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent> waitForEvent(double timeout);
         void startDiscovery(const std::string & clientName);
         void stopDiscovery();
     };
 
+    class BasicCameraDiscoveryEvent {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicCameraDiscoveryEvent> swiftObj;
+        BasicCameraDiscoveryEvent(std::shared_ptr<CascableCoreBasicAPI::BasicCameraDiscoveryEvent> swiftObj);
+        BasicCameraDiscoveryEvent(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent &other) = default;
+        BasicCameraDiscoveryEvent(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent &operator=(const UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent &operator=(UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEvent &&other) noexcept = default;
+        ~BasicCameraDiscoveryEvent();
+    
+        UnmanagedCascableCoreBasicAPI::BasicCameraDiscoveryEventType getType();
+        UnmanagedCascableCoreBasicAPI::BasicCamera getCamera();
+        int getCameraHandle();
+    };
+
     class BasicCameraInitiatedTransferResult {
     private:
     public:
         std::shared_ptr<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> swiftObj;
         BasicCameraInitiatedTransferResult(std::shared_ptr<CascableCoreBasicAPI::BasicCameraInitiatedTransferResult> swiftObj);
+        BasicCameraInitiatedTransferResult(const UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult &other) = default;
+        BasicCameraInitiatedTransferResult(UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult &operator=(const UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult &operator=(UnmanagedCascableCoreBasicAPI::BasicCameraInitiatedTransferResult &&other) noexcept = default;
         ~BasicCameraInitiatedTransferResult();
     
+        int getSequenceNumber();
         double getDateProduced();
         bool isOnlyDestinationForImage();
         std::optional<std::string> getFileNameHint();
         std::optional<std::string> getSuggestedFileNameExtensionForRepresentation();
         std::optional<std::string> getUtiForRepresentation();
+        std::optional<std::string> getLocalPath();
         int getRawImageDataLength();
-        void copyPixelData(uint8_t* pointer);
+        UnmanagedCascableCoreBasicAPI::BasicByteBuffer getImageBuffer();
+        void copyPixelData(uint8_t * pointer);
     };
 
     class BasicCameraProperty {
@@ -179,6 +483,10 @@ namespace UnmanagedCascableCoreBasicAPI {
     public:
         std::shared_ptr<CascableCoreBasicAPI::BasicCameraProperty> swiftObj;
         BasicCameraProperty(std::shared_ptr<CascableCoreBasicAPI::BasicCameraProperty> swiftObj);
+        BasicCameraProperty(const UnmanagedCascableCoreBasicAPI::BasicCameraProperty &other) = default;
+        BasicCameraProperty(UnmanagedCascableCoreBasicAPI::BasicCameraProperty &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraProperty &operator=(const UnmanagedCascableCoreBasicAPI::BasicCameraProperty &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicCameraProperty &operator=(UnmanagedCascableCoreBasicAPI::BasicCameraProperty &&other) noexcept = default;
         ~BasicCameraProperty();
     
         UnmanagedCascableCoreBasicAPI::BasicPropertyIdentifier getIdentifier();
@@ -189,8 +497,22 @@ namespace UnmanagedCascableCoreBasicAPI {
         std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> getPendingValue();
         void setPendingValue(const std::optional<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> & value);
         std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> getValidSettableValues();
-        void setValidSettableValues(std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> value);
+        void setValidSettableValues(const std::vector<UnmanagedCascableCoreBasicAPI::BasicPropertyValue> & value);
         void setValue(const UnmanagedCascableCoreBasicAPI::BasicPropertyValue & newValue);
+        void setValueWithCompletion(const UnmanagedCascableCoreBasicAPI::BasicPropertyValue & newValue, std::function<void(bool)> completion);
+        UnmanagedCascableCoreBasicAPI::BasicPropertySetStatus getSetStatus();
+        std::optional<std::string> getLastSetErrorDescription();
+        int getCoalescedSetCount();
+    
+#if UnmanagedCascableCoreBasicAPI_HAS_COROUTINES
+        // Awaitable versions of the methods taking a completion. The awaiting coroutine is resumed on the thread
+        // the completion is called on, unless the awaitable is given an executor with resumingOn().
+        UnmanagedCascableCoreBasicAPI::CompletionAwaitable<bool> setValueAsync(const UnmanagedCascableCoreBasicAPI::BasicPropertyValue & newValue) {
+            return UnmanagedCascableCoreBasicAPI::CompletionAwaitable<bool>([self = *this, newValue](std::function<void(bool)> completion) mutable {
+                self.setValueWithCompletion(newValue, std::move(completion));
+            });
+        }
+#endif
     };
 
     class BasicDeviceInfo {
@@ -198,6 +520,10 @@ namespace UnmanagedCascableCoreBasicAPI {
     public:
         std::shared_ptr<CascableCoreBasicAPI::BasicDeviceInfo> swiftObj;
         BasicDeviceInfo(std::shared_ptr<CascableCoreBasicAPI::BasicDeviceInfo> swiftObj);
+        BasicDeviceInfo(const UnmanagedCascableCoreBasicAPI::BasicDeviceInfo &other) = default;
+        BasicDeviceInfo(UnmanagedCascableCoreBasicAPI::BasicDeviceInfo &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicDeviceInfo &operator=(const UnmanagedCascableCoreBasicAPI::BasicDeviceInfo &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicDeviceInfo &operator=(UnmanagedCascableCoreBasicAPI::BasicDeviceInfo &&other) noexcept = default;
         ~BasicDeviceInfo();
     
         std::optional<std::string> getManufacturer();
@@ -206,16 +532,116 @@ namespace UnmanagedCascableCoreBasicAPI {
         std::optional<std::string> getSerialNumber();
     };
 
+    class BasicFileStorage {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicFileStorage> swiftObj;
+        BasicFileStorage(std::shared_ptr<CascableCoreBasicAPI::BasicFileStorage> swiftObj);
+        BasicFileStorage(const UnmanagedCascableCoreBasicAPI::BasicFileStorage &other) = default;
+        BasicFileStorage(UnmanagedCascableCoreBasicAPI::BasicFileStorage &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicFileStorage &operator=(const UnmanagedCascableCoreBasicAPI::BasicFileStorage &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicFileStorage &operator=(UnmanagedCascableCoreBasicAPI::BasicFileStorage &&other) noexcept = default;
+        ~BasicFileStorage();
+    
+        std::optional<std::string> getDisplayName();
+        int64_t getAvailableSpace();
+        int64_t getCapacity();
+        bool getAllowsWrite();
+        UnmanagedCascableCoreBasicAPI::BasicFolder getRootFolder();
+    };
+
+    class BasicFileSystemItem {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicFileSystemItem> swiftObj;
+        BasicFileSystemItem(std::shared_ptr<CascableCoreBasicAPI::BasicFileSystemItem> swiftObj);
+        BasicFileSystemItem(const UnmanagedCascableCoreBasicAPI::BasicFileSystemItem &other) = default;
+        BasicFileSystemItem(UnmanagedCascableCoreBasicAPI::BasicFileSystemItem &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicFileSystemItem &operator=(const UnmanagedCascableCoreBasicAPI::BasicFileSystemItem &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicFileSystemItem &operator=(UnmanagedCascableCoreBasicAPI::BasicFileSystemItem &&other) noexcept = default;
+        ~BasicFileSystemItem();
+    
+        std::optional<std::string> getName();
+        int64_t getSize();
+        bool isFolder();
+        UnmanagedCascableCoreBasicAPI::BasicFileTransfer beginTransfer(const std::string & localPath, int64_t offset, int64_t length);
+    };
+
+    class BasicFileTransfer {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicFileTransfer> swiftObj;
+        BasicFileTransfer(std::shared_ptr<CascableCoreBasicAPI::BasicFileTransfer> swiftObj);
+        BasicFileTransfer(const UnmanagedCascableCoreBasicAPI::BasicFileTransfer &other) = default;
+        BasicFileTransfer(UnmanagedCascableCoreBasicAPI::BasicFileTransfer &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicFileTransfer &operator=(const UnmanagedCascableCoreBasicAPI::BasicFileTransfer &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicFileTransfer &operator=(UnmanagedCascableCoreBasicAPI::BasicFileTransfer &&other) noexcept = default;
+        ~BasicFileTransfer();
+    
+        std::string getLocalPath();
+        UnmanagedCascableCoreBasicAPI::BasicFileTransferState getState();
+        int64_t getTotalFileSize();
+        int64_t getRangeStart();
+        int64_t getRangeLength();
+        int64_t getBytesTransferred();
+        std::optional<std::string> getErrorDescription();
+        void cancel();
+    };
+
+    class BasicFolder {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicFolder> swiftObj;
+        BasicFolder(std::shared_ptr<CascableCoreBasicAPI::BasicFolder> swiftObj);
+        BasicFolder(const UnmanagedCascableCoreBasicAPI::BasicFolder &other) = default;
+        BasicFolder(UnmanagedCascableCoreBasicAPI::BasicFolder &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicFolder &operator=(const UnmanagedCascableCoreBasicAPI::BasicFolder &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicFolder &operator=(UnmanagedCascableCoreBasicAPI::BasicFolder &&other) noexcept = default;
+        ~BasicFolder();
+    
+        std::optional<std::string> getName();
+        bool getChildrenLoaded();
+        bool getChildrenLoading();
+        std::optional<std::string> getLoadChildrenErrorDescription();
+        void loadChildren();
+        UnmanagedCascableCoreBasicAPI::BasicFolderListing listing();
+    };
+
+    class BasicFolderListing {
+    private:
+    public:
+        std::shared_ptr<CascableCoreBasicAPI::BasicFolderListing> swiftObj;
+        BasicFolderListing(std::shared_ptr<CascableCoreBasicAPI::BasicFolderListing> swiftObj);
+        BasicFolderListing(const UnmanagedCascableCoreBasicAPI::BasicFolderListing &other) = default;
+        BasicFolderListing(UnmanagedCascableCoreBasicAPI::BasicFolderListing &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicFolderListing &operator=(const UnmanagedCascableCoreBasicAPI::BasicFolderListing &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicFolderListing &operator=(UnmanagedCascableCoreBasicAPI::BasicFolderListing &&other) noexcept = default;
+        ~BasicFolderListing();
+    
+        int getRecordStride();
+        int getCount();
+        int getRecordBufferLength();
+        UnmanagedCascableCoreBasicAPI::BasicByteBuffer getRecordBuffer();
+        void copyRecords(uint8_t * pointer);
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicFileSystemItem> item(int handle);
+        std::optional<UnmanagedCascableCoreBasicAPI::BasicFolder> folder(int handle);
+    };
+
     class BasicLiveViewFrame {
     private:
     public:
         std::shared_ptr<CascableCoreBasicAPI::BasicLiveViewFrame> swiftObj;
         BasicLiveViewFrame(std::shared_ptr<CascableCoreBasicAPI::BasicLiveViewFrame> swiftObj);
+        BasicLiveViewFrame(const UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame &other) = default;
+        BasicLiveViewFrame(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame &operator=(const UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame &operator=(UnmanagedCascableCoreBasicAPI::BasicLiveViewFrame &&other) noexcept = default;
         ~BasicLiveViewFrame();
     
         double getDateProduced();
         int getRawPixelDataLength();
-        void copyPixelData(uint8_t* pointer);
+        void copyPixelData(uint8_t * pointer);
+        UnmanagedCascableCoreBasicAPI::BasicByteBuffer getRawPixelBuffer();
         UnmanagedCascableCoreBasicAPI::BasicSize getRawPixelSize();
     };
 
@@ -224,6 +650,10 @@ namespace UnmanagedCascableCoreBasicAPI {
     public:
         std::shared_ptr<CascableCoreBasicAPI::BasicPropertyValue> swiftObj;
         BasicPropertyValue(std::shared_ptr<CascableCoreBasicAPI::BasicPropertyValue> swiftObj);
+        BasicPropertyValue(const UnmanagedCascableCoreBasicAPI::BasicPropertyValue &other) = default;
+        BasicPropertyValue(UnmanagedCascableCoreBasicAPI::BasicPropertyValue &&other) noexcept = default;
+        UnmanagedCascableCoreBasicAPI::BasicPropertyValue &operator=(const UnmanagedCascableCoreBasicAPI::BasicPropertyValue &other) = default;
+        UnmanagedCascableCoreBasicAPI::BasicPropertyValue &operator=(UnmanagedCascableCoreBasicAPI::BasicPropertyValue &&other) noexcept = default;
         ~BasicPropertyValue();
     
         std::optional<std::string> getLocalizedDisplayValue();
@@ -232,11 +662,16 @@ namespace UnmanagedCascableCoreBasicAPI {
 
     class BasicSimulatedCameraConfiguration {
     private:
+        alignas(8) unsigned char swiftObjStorage[112];
     public:
-        std::shared_ptr<CascableCoreBasicAPI::BasicSimulatedCameraConfiguration> swiftObj;
-        BasicSimulatedCameraConfiguration(std::shared_ptr<CascableCoreBasicAPI::BasicSimulatedCameraConfiguration> swiftObj);
+        BasicSimulatedCameraConfiguration(const CascableCoreBasicAPI::BasicSimulatedCameraConfiguration &value);
+        BasicSimulatedCameraConfiguration(const UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration &other);
+        UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration &operator=(const UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration &other);
         ~BasicSimulatedCameraConfiguration();
     
+        const CascableCoreBasicAPI::BasicSimulatedCameraConfiguration &swiftObj() const;
+        CascableCoreBasicAPI::BasicSimulatedCameraConfiguration &swiftObj();
+    
         static UnmanagedCascableCoreBasicAPI::BasicSimulatedCameraConfiguration defaultConfiguration();
         std::string getManufacturer();
         void setManufacturer(const std::string & value);
@@ -244,18 +679,35 @@ namespace UnmanagedCascableCoreBasicAPI {
         void setModel(const std::string & value);
         std::string getIdentifier();
         void setIdentifier(const std::string & value);
+        int getCameraCount();
+        void setCameraCount(int value);
         std::string getLiveViewImageContainerPath();
         void setLiveViewImageContainerPath(const std::string & value);
+        double getBurstFramesPerSecond();
+        void setBurstFramesPerSecond(double value);
+        int getBurstLength();
+        void setBurstLength(int value);
+        int getSyntheticOriginalByteCount();
+        void setSyntheticOriginalByteCount(int value);
+        bool getDeliversLiveViewOnSeparateLane();
+        void setDeliversLiveViewOnSeparateLane(bool value);
+        int getWorkerQueueCount();
+        void setWorkerQueueCount(int value);
         void apply();
     };
 
     class BasicSize {
     private:
+        alignas(8) unsigned char swiftObjStorage[16];
     public:
-        std::shared_ptr<CascableCoreBasicAPI::BasicSize> swiftObj;
-        BasicSize(std::shared_ptr<CascableCoreBasicAPI::BasicSize> swiftObj);
+        BasicSize(const CascableCoreBasicAPI::BasicSize &value);
+        BasicSize(const UnmanagedCascableCoreBasicAPI::BasicSize &other);
+        UnmanagedCascableCoreBasicAPI::BasicSize &operator=(const UnmanagedCascableCoreBasicAPI::BasicSize &other);
         ~BasicSize();
     
+        const CascableCoreBasicAPI::BasicSize &swiftObj() const;
+        CascableCoreBasicAPI::BasicSize &swiftObj();
+    
         double getWidth();
         double getHeight();
     };